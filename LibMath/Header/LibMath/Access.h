@@ -0,0 +1,19 @@
+#ifndef LIBMATH_ACCESS_H_
+#define LIBMATH_ACCESS_H_
+
+#include <stdexcept>
+
+/*
+* Bounds check of the unchecked accessors (at_unchecked)
+*
+* LIBMATH_CHECKED_ACCESS	-> throws std::out_of_range like operator[], set by cmake for debug builds
+* none						-> compiled out, the accessor is a plain array read
+*/
+
+#if defined(LIBMATH_CHECKED_ACCESS)
+#define LIBMATH_ACCESS_CHECK(condition) do { if (!(condition)) { throw std::out_of_range("Error: index out of range"); } } while (false)
+#else
+#define LIBMATH_ACCESS_CHECK(condition) ((void)0)
+#endif
+
+#endif // !LIBMATH_ACCESS_H_
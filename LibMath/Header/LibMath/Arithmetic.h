@@ -1,6 +1,8 @@
 #ifndef LIBMATH_ARITHMETIC_H_
 #define LIBMATH_ARITHMETIC_H_
 
+#include <span>
+
 namespace LibMath
 {
 	bool					almostEqual(float num1, float num2);		// Return if two floating value are similar enought to be considered equal
@@ -10,7 +12,8 @@ namespace LibMath
 	float					clamp(float num, float range_s, float range_e);	// Return parameter limited by the given range
 	float					floor(float num);					// Return highest integer value lower or equal to parameter
 	float					squareRoot(float num);			// Return square root of parameter
-	float					wrap(float num, float range_s, float range_e);	// Return parameter as value inside the given range
+	float					wrap(float num, float range_s, float range_e);	// Return parameter as value inside the given range [range_s, range_e[, constant time whatever the distance to the range
+	void					wrap(std::span<float> nums, float range_s, float range_e);	// Wrap every value in place, vectorized, same values as the single value wrap
 }
 
 #endif // !LIBMATH_ARITHMETIC_H_
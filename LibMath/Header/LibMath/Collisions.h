@@ -1,12 +1,34 @@
 #pragma once
 #pragma once
+#include <span>
+#include <utility>
+#include <vector>
+
 #include "GeometricObject3.h"
 #include "GeometricObject2.h"
+#include "DynamicAABBTree.h"
+#include "SweepAndPrune.h"
+#include "Vector/Vector3Batch.h"
 
 namespace LibMath
 {
 	namespace Collision2D
 	{
+		struct ContactPoint
+		{
+			Vector2				m_position;			// halfway between the two surfaces
+			float				m_depth = 0.f;
+		};
+
+		// Contact of two overlapping shapes, moving the second one by m_normal * m_depth separates them
+		struct Manifold
+		{
+			Vector2				m_normal;			// unit, from the first shape toward the second
+			float				m_depth = 0.f;		// deepest of the points
+			ContactPoint		m_points[2];
+			int					m_pointCount = 0;
+		};
+
 		// Line Collisions
 		bool				checkCollisionLinePoint(const Geometry2D::Line& line, const Geometry2D::Point& point);
 		bool				checkCollisionLineLine(const Geometry2D::Line& line1, const Geometry2D::Line& line2);
@@ -23,10 +45,51 @@ namespace LibMath
 		bool				checkCollisionCirclePoint(const Geometry2D::Circle& circle, const Geometry2D::Point& point);
 		bool				checkCollisionCircleLine(const Geometry2D::Circle& circle, const Geometry2D::Line& line);
 		bool				checkCollisionCircleCircle(const Geometry2D::Circle& circle1, const Geometry2D::Circle& circle2);
+		bool				checkCollisionCircleOBB(const Geometry2D::Circle& circle, const Geometry2D::OBB& obb);
+
+		// Manifolds, return false and leave manifold untouched when the shapes do not collide, touching shapes get a 0 depth contact
+		bool				getManifoldCircleOBB(const Geometry2D::Circle& circle, const Geometry2D::OBB& obb, Manifold& manifold);
 	}
 
 	namespace Collisions3D
 	{
+		struct ContactPoint
+		{
+			Vector3				m_position;			// halfway between the two surfaces
+			float				m_depth = 0.f;
+		};
+
+		// Contact of two overlapping shapes, moving the second one by m_normal * m_depth separates them
+		struct Manifold
+		{
+			Vector3				m_normal;			// unit, from the first shape toward the second
+			float				m_depth = 0.f;		// deepest of the points
+			ContactPoint		m_points[4];
+			int					m_pointCount = 0;
+		};
+
+		/*
+		* Structure of arrays copies of many shapes for the batched tests, loaded once and tested against many times
+		* Index i of a batch is the shape i of the span it was loaded from
+		*/
+		struct SphereBatch
+		{
+			void				load(std::span<Geometry3D::Sphere const> spheres);
+			size_t				size(void) const;
+
+			Vector3Batch		m_centers;
+			std::vector<float>	m_radii;
+		};
+
+		struct AABBBatch
+		{
+			void				load(std::span<Geometry3D::AABB const> aabbs);		// the extents are turned into bounds once here
+			size_t				size(void) const;
+
+			Vector3Batch		m_min;
+			Vector3Batch		m_max;
+		};
+
 		// Sphere Collisions
 		bool				checkCollisionSphereSphere(const Geometry3D::Sphere& sphere1, const Geometry3D::Sphere& sphere2);
 		bool				checkCollisionSpherePoint(const Geometry3D::Sphere& sphere, const Geometry3D::Point& point);
@@ -52,6 +115,32 @@ namespace LibMath
 		bool				checkCollisionAABBAABB(const Geometry3D::AABB& aabb1, const Geometry3D::AABB& aabb2);
 		bool				checkCollisionAABBPoint(const Geometry3D::AABB& aabb, const Geometry3D::Point& point);
 		bool				checkCollisionAABBShpere(const Geometry3D::AABB& aabb, const Geometry3D::Sphere& sphere);
+
+		// OBB Collisions, m_rotation must be a unit quaternion
+		bool				checkCollisionOBBOBB(const Geometry3D::OBB& obb1, const Geometry3D::OBB& obb2);		// separating axis test on the 15 axes
+		bool				checkCollisionOBBAABB(const Geometry3D::OBB& obb, const Geometry3D::AABB& aabb);
+		bool				checkCollisionOBBSphere(const Geometry3D::OBB& obb, const Geometry3D::Sphere& sphere);
+		bool				checkCollisionOBBCapsule(const Geometry3D::OBB& obb, const Geometry3D::Capsule& capsule);
+		bool				checkCollisionOBBLine(const Geometry3D::OBB& obb, const Geometry3D::Line& line);
+		bool				checkCollisionOBBPoint(const Geometry3D::OBB& obb, const Geometry3D::Point& point);
+
+		// Manifolds, return false and leave manifold untouched when the shapes do not collide, touching shapes get a 0 depth contact
+		bool				getManifoldSphereSphere(const Geometry3D::Sphere& sphere1, const Geometry3D::Sphere& sphere2, Manifold& manifold);
+		bool				getManifoldSphereCapsule(const Geometry3D::Sphere& sphere, const Geometry3D::Capsule& capsule, Manifold& manifold);
+		bool				getManifoldSphereAABB(const Geometry3D::Sphere& sphere, const Geometry3D::AABB& aabb, Manifold& manifold);
+		bool				getManifoldCapsuleCapsule(const Geometry3D::Capsule& capsule1, const Geometry3D::Capsule& capsule2, Manifold& manifold);		// 2 points when the capsules lie side by side
+		bool				getManifoldCapsulePlan(const Geometry3D::Capsule& capsule, const Geometry3D::Plan& plan, Manifold& manifold);		// the plan is 2 sided like checkCollisionCapsulePlan, 2 points when the capsule lies on it
+		bool				getManifoldAABBAABB(const Geometry3D::AABB& aabb1, const Geometry3D::AABB& aabb2, Manifold& manifold);		// corners of the overlap of the 2 faces, up to 4 points
+
+		/*
+		* Batched tests, same results as checkCollisionSphereSphere and checkCollisionAABBAABB on every pair, Collisions.cpp is built without implicit fused multiply add
+		* One shape against a batch appends the indices of the overlapping shapes in increasing order,
+		* a batch against a batch appends the overlapping pairs (index in batch1, index in batch2) block by block of batch2
+		*/
+		void				checkCollisionSphereSphere(const Geometry3D::Sphere& sphere, const SphereBatch& batch, std::vector<int>& result);
+		void				checkCollisionSphereSphere(const SphereBatch& batch1, const SphereBatch& batch2, std::vector<std::pair<int, int>>& result);
+		void				checkCollisionAABBAABB(const Geometry3D::AABB& aabb, const AABBBatch& batch, std::vector<int>& result);
+		void				checkCollisionAABBAABB(const AABBBatch& batch1, const AABBBatch& batch2, std::vector<std::pair<int, int>>& result);
 	}
 	
 }
\ No newline at end of file
@@ -0,0 +1,133 @@
+#ifndef LIBMATH_CONVEXCOLLISIONS_H_
+#define LIBMATH_CONVEXCOLLISIONS_H_
+
+#include <cmath>
+
+#include "LibMath/GeometricObject3.h"
+#include "LibMath/Vector/Vector3.h"
+
+namespace LibMath
+{
+	namespace Collisions3D
+	{
+		/*
+		* Non owning view of a convex shape through its support function, built implicitly from any Geometry3D shape
+		* (or any type with a Geometry3D::getSupportPoint overload), so a shape is passed as is to the functions below
+		* The shape must outlive the view
+		*
+		* Spheres and capsules are kept as a core (point, segment) grown by their radius :
+		* GJK runs on the cores and the radii are added back, which is exact where sampling a round surface is not
+		*/
+		class ConvexShape
+		{
+		public:
+			template <typename T>
+								ConvexShape(T const& shape);
+								ConvexShape(Geometry3D::Sphere const& sphere);
+								ConvexShape(Geometry3D::Capsule const& capsule);
+								~ConvexShape() = default;
+
+			Vector3				getSupportPoint(Vector3 const& direction) const;
+			Vector3				getCoreSupportPoint(Vector3 const& direction) const;		// support point of the shape without its radius
+			float				getRadius(void) const;
+			ConvexShape			translated(Vector3 const& offset) const;		// the same shape moved by offset, nothing is copied
+
+		private:
+			template <typename T>
+			static Vector3		support(void const* shape, Vector3 const& direction);
+
+			Vector3				(*m_support)(void const*, Vector3 const&) = nullptr;
+			void const*			m_shape = nullptr;
+			Vector3				m_offset;
+			float				m_radius = 0.f;
+		};
+
+		/*
+		* Simplex kept from one query to the next for the same pair of shapes
+		* The support directions of the last simplex are replayed first, a pair that barely moved
+		* since the previous frame is usually solved in 1 or 2 iterations
+		*/
+		struct GjkCache
+		{
+			Vector3				m_directions[4];
+			int					m_count = 0;		// 0 for a cold start
+		};
+
+		struct ConvexDistance
+		{
+			float				m_distance = 0.f;	// 0 when the shapes overlap or touch
+			Vector3				m_pointA;			// closest points, only meaningful when m_distance > 0
+			Vector3				m_pointB;
+			int					m_iterations = 0;
+		};
+
+		struct Penetration
+		{
+			Vector3				m_normal;			// unit, from A toward B : moving B by m_normal * m_depth separates the shapes
+			float				m_depth = 0.f;
+			Vector3				m_pointA;			// deepest point of A inside B
+			Vector3				m_pointB;			// deepest point of B inside A
+		};
+
+		// GJK over the Minkowski difference A - B, touching shapes collide
+		bool				checkCollisionConvex(ConvexShape const& shapeA, ConvexShape const& shapeB, GjkCache* cache = nullptr);
+		ConvexDistance		getDistanceConvex(ConvexShape const& shapeA, ConvexShape const& shapeB, GjkCache* cache = nullptr);
+
+		// GJK then EPA, return false and leave penetration untouched when the shapes do not overlap
+		// The depth is exact for spheres and capsules, EPA stops within 1e-4 of the depth (relative) on the other shapes
+		bool				getPenetrationConvex(ConvexShape const& shapeA, ConvexShape const& shapeB, Penetration& penetration, GjkCache* cache = nullptr);
+
+		/*
+		* Conservative advancement for shapes translated by velocityA and velocityB over the step (no rotation),
+		* the fallback of the pairs without a dedicated Intersection3D::sweep
+		* Return true and set time in [0, 1] to the first time the shapes come within tolerance of each other, time is left untouched on a miss
+		* Not converging within the iteration budget (grazing passes, a tolerance of 0) is reported as a miss too
+		*/
+		bool				getTimeOfImpactConvex(ConvexShape const& shapeA, Vector3 const& velocityA, ConvexShape const& shapeB, Vector3 const& velocityB, float& time, float const tolerance = 1e-3f);
+
+		template <typename T>
+		ConvexShape::ConvexShape(T const& shape)
+		{
+			m_support = &support<T>;
+			m_shape = &shape;
+		}
+
+		inline Vector3 ConvexShape::getSupportPoint(Vector3 const& direction) const
+		{
+			Vector3 point = getCoreSupportPoint(direction);
+
+			float lengthSquared = direction.magnitudeSquared();
+			if (m_radius > 0.f && lengthSquared > 0.f)
+			{
+				point += direction * (m_radius / std::sqrt(lengthSquared));
+			}
+
+			return point;
+		}
+
+		inline Vector3 ConvexShape::getCoreSupportPoint(Vector3 const& direction) const
+		{
+			return m_support(m_shape, direction) + m_offset;
+		}
+
+		inline float ConvexShape::getRadius(void) const
+		{
+			return m_radius;
+		}
+
+		inline ConvexShape ConvexShape::translated(Vector3 const& offset) const
+		{
+			ConvexShape result = *this;
+			result.m_offset += offset;
+			return result;
+		}
+
+		template <typename T>
+		Vector3 ConvexShape::support(void const* shape, Vector3 const& direction)
+		{
+			return Geometry3D::getSupportPoint(*static_cast<T const*>(shape), direction);
+		}
+	}
+}
+
+#endif // !LIBMATH_CONVEXCOLLISIONS_H_
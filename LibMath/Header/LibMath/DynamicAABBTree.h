@@ -0,0 +1,80 @@
+#ifndef LIBMATH_DYNAMICAABBTREE_H_
+#define LIBMATH_DYNAMICAABBTREE_H_
+
+#include <utility>
+#include <vector>
+
+#include "LibMath/GeometricObject3.h"
+#include "LibMath/Vector/Vector3.h"
+
+namespace LibMath
+{
+	namespace Collisions3D
+	{
+		/*
+		* Broad phase bounding volume hierarchy over Geometry3D shapes
+		* Every leaf stores a fat AABB (the shape bounds grown by a margin) so small moves do not touch the tree
+		* Leaves are placed with the surface area heuristic and the ancestors are rotated to reduce their area after each change
+		* The reported pairs and query results overlap on the fat bounds, the narrow phase checkCollision functions do the exact test
+		*/
+		class DynamicAABBTree
+		{
+		public:
+			static constexpr int	nullProxy = -1;
+
+			explicit				DynamicAABBTree(float const margin = 0.1f);		// margin added on every side of the fat AABB
+									~DynamicAABBTree() = default;
+
+			int						insert(Geometry3D::AABB const& bounds, void* object = nullptr);				// return the proxy id, object is user data (ex: the shape the bounds come from)
+			void					remove(int const proxy);																// throw std::out_of_range
+
+			// Return true when the proxy was reinserted, displacement extends the fat AABB in the direction of motion
+			bool					move(int const proxy, Geometry3D::AABB const& bounds, Vector3 const& displacement = Vector3::zero());
+
+			void*					getObject(int const proxy) const;				// throw std::out_of_range
+			Geometry3D::AABB		getFatAABB(int const proxy) const;				// throw std::out_of_range
+
+			void					query(Geometry3D::AABB const& bounds, std::vector<int>& result) const;	// append the proxies overlapping bounds
+			void					queryPairs(std::vector<std::pair<int, int>>& result) const;				// append each overlapping pair once, first < second
+
+			size_t					size(void) const;				// proxy count
+			int						height(void) const;				// 0 for a single leaf, -1 when empty
+			bool					validate(void) const;			// check links, heights and bounds, for tests
+			void					clear(void);
+
+		private:
+			struct Node
+			{
+				bool				isLeaf(void) const;
+
+				Vector3					m_min;
+				Vector3					m_max;
+				void*					m_object = nullptr;
+				int						m_parent = nullProxy;		// next free node when the node is unused
+				int						m_left = nullProxy;
+				int						m_right = nullProxy;
+				int						m_height = -1;				// -1 for a free node
+			};
+
+			int						allocateNode(void);
+			void					freeNode(int const index);
+
+			void					insertLeaf(int const leaf);
+			void					removeLeaf(int const leaf);
+			void					refitAncestors(int index);
+			void					refit(int const index);
+			void					rotate(int const index);
+
+			void					checkProxy(int const proxy) const;
+			bool					validateNode(int const index, int const parent, size_t& leafCount) const;
+
+			std::vector<Node>		m_nodes;
+			int						m_root = nullProxy;
+			int						m_freeList = nullProxy;
+			size_t					m_proxyCount = 0;
+			float					m_margin = 0.f;
+		};
+	}
+}
+
+#endif // !LIBMATH_DYNAMICAABBTREE_H_
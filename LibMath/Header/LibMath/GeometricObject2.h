@@ -138,6 +138,12 @@ namespace LibMath
 			
 
 		};
+
+		// Smallest AABB enclosing the shape, used as broad phase bounds
+		AABB				getBoundingAABB(Line const& line);
+		AABB				getBoundingAABB(AABB const& aabb);
+		AABB				getBoundingAABB(OBB const& obb);
+		AABB				getBoundingAABB(Circle const& circle);
 	}
 }
 
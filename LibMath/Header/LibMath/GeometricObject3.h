@@ -1,24 +1,26 @@
 #ifndef GEOMETRIC_OBJECT3_H
 #define	GEOMETRIC_OBJECT3_H
 
+#include <variant>
+#include <vector>
+
 #include "LibMath/Angle/Radian.h"
 #include "LibMath/Vector/Vector3.h"
 #include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Quaternion.h"
 
 namespace LibMath
 {
 	namespace Geometry3D
 	{
-		
-		class Object3D
-		{
-		public:
-			virtual void	update(LibMath::Matrix4& transMat);
-			virtual			~Object3D() = default;
-
-		};
-
-		class Point : public Object3D
+		/*
+		* The shapes are plain values without a common base nor a vptr, a Point is 3 floats
+		* Heterogeneous collections use Shape (a std::variant) or the per type pools of ShapeStorage
+		* update transforms the positions of a shape (center, origin, end points), its sizes and directions are kept
+		* except for the OBB which also turns with the rotation of the matrix
+		*/
+
+		class Point
 		{
 		public:
 							Point() = default;
@@ -31,7 +33,7 @@ namespace LibMath
 
 			Vector3			toVector3() const;
 
-			virtual void	update(LibMath::Matrix4& transMat) override;
+			void			update(LibMath::Matrix4 const& transMat);
 
 			float			getDistanceSquared(const Point&) const;
 			float			getDistance(const Point&) const;
@@ -47,7 +49,7 @@ namespace LibMath
 
 		};
 
-		class Line : public Object3D
+		class Line
 		{
 		public:
 							Line() = default;
@@ -62,7 +64,7 @@ namespace LibMath
 			Line&		operator=(const Line& other);
 			Line		operator*(const float& scalair);
 
-			virtual void	update(LibMath::Matrix4& transMat) override;
+			void			update(LibMath::Matrix4 const& transMat);
 
 			Point				m_origin;
 			LibMath::Vector3	m_direction;
@@ -71,7 +73,7 @@ namespace LibMath
 
 		};
 
-		class Plan : public Object3D
+		class Plan
 		{
 		public:
 							Plan() = default;
@@ -81,6 +83,7 @@ namespace LibMath
 
 			Plan&		operator=(const Plan& other);
 
+			void			update(LibMath::Matrix4 const& transMat);		// unbounded, left unchanged
 
 
 			Vector3	m_normal;
@@ -91,7 +94,7 @@ namespace LibMath
 
 		};
 
-		class AABB :public Object3D
+		class AABB
 		{
 		public:
 							AABB() = default;
@@ -101,7 +104,7 @@ namespace LibMath
 
 			AABB&		operator=(const AABB& other);
 
-			virtual void	update(LibMath::Matrix4& transMat) override;
+			void			update(LibMath::Matrix4 const& transMat);
 
 			float			extentX(void) const;
 			float			extentY(void) const;
@@ -122,29 +125,35 @@ namespace LibMath
 			
 		};
 
-		class OBB : public Object3D
+		class OBB
 		{
 		public:
 							OBB() = default;
-							OBB(const Point& center, const float& width, const float& height, const float& m_depth, const Radian& rotation);
+							OBB(const Point& center, const float& width, const float& height, const float& depth, const Radian& rotation);		// rotation around Z
+							OBB(const Point& center, const float& width, const float& height, const float& depth, const Quaternion& rotation);
 							OBB(const OBB& other);
 							~OBB() = default;
 
-			virtual void	update(LibMath::Matrix4& transMat) override;
+			void			update(LibMath::Matrix4 const& transMat);		// the scale of the matrix is ignored, a mirror is turned into a rotation
 
 			OBB&		operator=(const OBB& other);
 
+			//				local X, Y and Z axes in world space, unit vectors
+			void			getAxes(LibMath::Vector3& axisX, LibMath::Vector3& axisY, LibMath::Vector3& axisZ) const;
+
 			Point	m_center;
 			float	m_width = 0.f;
 			float	m_height = 0.f;
 			float	m_depth = 0.f;
-			Radian	m_rotation;
+
+			//		local to world, must stay a unit quaternion
+			Quaternion	m_rotation{ 0.f, 0.f, 0.f, 1.f };
 
 		private:
 			
 		};
 
-		class Sphere : public Object3D
+		class Sphere
 		{
 		public:
 							Sphere() = default;
@@ -152,7 +161,7 @@ namespace LibMath
 							Sphere(const Sphere& other);
 							~Sphere() = default;
 
-			virtual void	update(LibMath::Matrix4& transMat) override;
+			void			update(LibMath::Matrix4 const& transMat);
 
 			Sphere&		operator=(const Sphere& other);
 
@@ -163,7 +172,7 @@ namespace LibMath
 			
 		};
 
-		class Capsule :public Object3D
+		class Capsule
 		{
 		public:
 							Capsule() = default;
@@ -171,7 +180,7 @@ namespace LibMath
 							Capsule(const Capsule& other);
 							~Capsule() = default;
 
-			virtual void	update(LibMath::Matrix4& transMat) override;
+			void			update(LibMath::Matrix4 const& transMat);
 
 			Capsule&	operator=(const Capsule& other);
 
@@ -183,9 +192,46 @@ namespace LibMath
 
 		};
 
+		class ConvexHull
+		{
+		public:
+							ConvexHull() = default;
+			explicit		ConvexHull(std::vector<Point> const& points);
+							~ConvexHull() = default;
+
+			void			update(LibMath::Matrix4 const& transMat);
+
+			//		the shape is the convex hull of the points, interior points are allowed but cost time in getSupportPoint
+			std::vector<Point>	m_points;
+		};
+
+		// owns its points, so it is not one of the Shape alternatives
+		using Shape = std::variant<Point, Line, Plan, AABB, OBB, Sphere, Capsule>;
+
+		void				update(Shape& shape, LibMath::Matrix4 const& transMat);
+
 		Point				getClosestToAABB(const LibMath::Geometry3D::AABB&, const Point&);
 		Point				getClosestToSegment(const Point&, const Point&, const Point&);
 
+		// Smallest AABB enclosing the shape, used as broad phase bounds
+		AABB				getBoundingAABB(const Point& point);
+		AABB				getBoundingAABB(const Line& line);
+		AABB				getBoundingAABB(const AABB& aabb);
+		AABB				getBoundingAABB(const OBB& obb);
+		AABB				getBoundingAABB(const Sphere& sphere);
+		AABB				getBoundingAABB(const Capsule& capsule);
+		AABB				getBoundingAABB(const ConvexHull& hull);	// throw std::invalid_argument for an empty hull
+		AABB				getBoundingAABB(const Shape& shape);		// throw std::invalid_argument for unbounded shapes (Plan)
+
+		// Farthest point of the shape along direction (any length, not zero), the support function used by GJK
+		LibMath::Vector3	getSupportPoint(const Point& point, const LibMath::Vector3& direction);
+		LibMath::Vector3	getSupportPoint(const Line& line, const LibMath::Vector3& direction);		// segment of m_length
+		LibMath::Vector3	getSupportPoint(const AABB& aabb, const LibMath::Vector3& direction);
+		LibMath::Vector3	getSupportPoint(const OBB& obb, const LibMath::Vector3& direction);
+		LibMath::Vector3	getSupportPoint(const Sphere& sphere, const LibMath::Vector3& direction);
+		LibMath::Vector3	getSupportPoint(const Capsule& capsule, const LibMath::Vector3& direction);
+		LibMath::Vector3	getSupportPoint(const ConvexHull& hull, const LibMath::Vector3& direction);	// throw std::invalid_argument for an empty hull
+
 	}
 
 }
@@ -1,8 +1,63 @@
 #ifndef LIBMATH_INTERSECTION_H_
 #define LIBMATH_INTERSECTION_H_
 
+#include <limits>
+#include <span>
+
+#include "LibMath/GeometricObject3.h"
+#include "LibMath/Vector/Vector3.h"
+
 namespace LibMath
 {
+	namespace Intersection3D
+	{
+		struct RaycastHit
+		{
+			float				m_t = 0.f;			// distance from the ray origin along the unit direction
+			Geometry3D::Point	m_point;
+			Vector3				m_normal;			// unit surface normal facing the ray
+		};
+
+		float constexpr		noHit = std::numeric_limits<float>::infinity();		// m_t of the batched misses
+
+		struct SweepHit
+		{
+			float				m_time = 0.f;		// fraction of the velocity in [0, 1] at the first contact, 0 when the shapes start overlapping
+			Geometry3D::Point	m_point;			// contact point at m_time
+			Vector3				m_normal;			// unit surface normal of the static shape facing the moving one, opposite to the velocity on a start overlap
+		};
+
+		/*
+		* The ray starts at ray.m_origin and goes along ray.m_direction (expected to be a unit vector), ray.m_length is not used
+		* Return true and fill hit for the first hit in [0, maxDistance], hit is left untouched on a miss
+		* A ray starting inside a solid shape hits at t = 0 with the normal opposite to the direction
+		*/
+		bool				raycast(Geometry3D::Line const& ray, Geometry3D::Sphere const& sphere, RaycastHit& hit, float const maxDistance = noHit);
+		bool				raycast(Geometry3D::Line const& ray, Geometry3D::AABB const& aabb, RaycastHit& hit, float const maxDistance = noHit);
+		bool				raycast(Geometry3D::Line const& ray, Geometry3D::OBB const& obb, RaycastHit& hit, float const maxDistance = noHit);
+		bool				raycast(Geometry3D::Line const& ray, Geometry3D::Capsule const& capsule, RaycastHit& hit, float const maxDistance = noHit);
+		bool				raycast(Geometry3D::Line const& ray, Geometry3D::Plan const& plan, RaycastHit& hit, float const maxDistance = noHit);	// dot(normal, p) = distance, both sides
+		bool				raycast(Geometry3D::Line const& ray, Vector3 const& a, Vector3 const& b, Vector3 const& c, RaycastHit& hit, float const maxDistance = noHit);	// triangle, both sides
+
+		/*
+		* The first shape moves by velocity over the step, the second one stays (pass the relative velocity when both move)
+		* Return true and fill hit for the first contact during the step, hit is left untouched on a miss
+		* Each sweep is a ray cast from the center of the moving shape against the other shape grown by it, so thin walls are not tunneled through
+		*/
+		bool				sweep(Geometry3D::Sphere const& sphere, Vector3 const& velocity, Geometry3D::Sphere const& other, SweepHit& hit);
+		bool				sweep(Geometry3D::Sphere const& sphere, Vector3 const& velocity, Geometry3D::AABB const& aabb, SweepHit& hit);
+		bool				sweep(Geometry3D::Sphere const& sphere, Vector3 const& velocity, Geometry3D::Capsule const& capsule, SweepHit& hit);
+		bool				sweep(Geometry3D::Sphere const& sphere, Vector3 const& velocity, Geometry3D::Plan const& plan, SweepHit& hit);		// dot(normal, p) = distance like raycast, both sides
+		bool				sweep(Geometry3D::AABB const& aabb, Vector3 const& velocity, Geometry3D::AABB const& other, SweepHit& hit);
+
+		// Packets of rays against one shape, hits[i] is the hit of rays[i] or has m_t = noHit, return the hit count
+		size_t				raycast(std::span<Geometry3D::Line const> rays, Geometry3D::Sphere const& sphere, std::span<RaycastHit> hits, float const maxDistance = noHit);
+		size_t				raycast(std::span<Geometry3D::Line const> rays, Geometry3D::AABB const& aabb, std::span<RaycastHit> hits, float const maxDistance = noHit);
+		size_t				raycast(std::span<Geometry3D::Line const> rays, Geometry3D::OBB const& obb, std::span<RaycastHit> hits, float const maxDistance = noHit);
+		size_t				raycast(std::span<Geometry3D::Line const> rays, Geometry3D::Capsule const& capsule, std::span<RaycastHit> hits, float const maxDistance = noHit);
+		size_t				raycast(std::span<Geometry3D::Line const> rays, Geometry3D::Plan const& plan, std::span<RaycastHit> hits, float const maxDistance = noHit);
+		size_t				raycast(std::span<Geometry3D::Line const> rays, Vector3 const& a, Vector3 const& b, Vector3 const& c, std::span<RaycastHit> hits, float const maxDistance = noHit);
+	}
 }
 
 #endif // !LIBMATH_INTERSECTION_H_
@@ -6,6 +6,10 @@
 #include "Intersection.h"
 #include "Matrix.h"
 #include "Quaternion.h"
+#include "Serialization.h"
+#include "ShapeStorage.h"
+#include "Transform.h"
+#include "TransformHierarchy.h"
 #include "Trigonometry.h"
 #include "Vector.h"
 
@@ -10,6 +10,7 @@ namespace LibMath {
     class Vector4;
     class Matrix3;
     class Matrix4;
+    class Quaternion;
 
     namespace Geometry3D {
         class Point;
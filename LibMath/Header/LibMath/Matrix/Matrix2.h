@@ -4,6 +4,7 @@
 #include "LibMath/GeometricObject2.h"
 #include "LibMath/Vector/Vector3.h"
 #include "LibMath/Vector/Vector2.h"
+#include "LibMath/Access.h"
 
 namespace LibMath
 {
@@ -25,6 +26,11 @@ namespace LibMath
 		float*				operator[](size_t const row);
 		float const*		operator[](size_t const row) const;
 
+		float*				data(void) { return &m_elements[0][0]; };
+		float const*		data(void) const { return &m_elements[0][0]; };
+		float&				at_unchecked(size_t const row, size_t const col) { LIBMATH_ACCESS_CHECK(row < 2 && col < 2); return m_elements[row][col]; };	// same as [row][col], bounds checked only with LIBMATH_CHECKED_ACCESS
+		float				at_unchecked(size_t const row, size_t const col) const { LIBMATH_ACCESS_CHECK(row < 2 && col < 2); return m_elements[row][col]; };
+
 		float				determinant(void) const;
 		Matrix2Dx2			minors(void) const;
 		Matrix2Dx2			cofactors(void) const;
@@ -93,6 +99,11 @@ namespace LibMath
 		RowProxy		operator[](size_t const row);
 		RowProxy		operator[](size_t const row) const;
 
+		float*				data(void) { return &m_elements[0][0]; };
+		float const*		data(void) const { return &m_elements[0][0]; };
+		float&				at_unchecked(size_t const row, size_t const col) { LIBMATH_ACCESS_CHECK(row < 3 && col < 3); return m_elements[row][col]; };	// same as [row][col], bounds checked only with LIBMATH_CHECKED_ACCESS
+		float				at_unchecked(size_t const row, size_t const col) const { LIBMATH_ACCESS_CHECK(row < 3 && col < 3); return m_elements[row][col]; };
+
 		bool			operator==(Matrix2Dx3 const& m);
 
 		static Matrix2Dx3	createTranslation(LibMath::Vector2 const& translation);
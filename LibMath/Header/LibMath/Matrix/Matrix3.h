@@ -4,6 +4,7 @@
 #include "LibMath/Vector/Vector3.h"
 #include "LibMath/Vector/Vector2.h"
 #include "LibMath/LibMathFwd.h"
+#include "LibMath/Access.h"
 
 namespace LibMath
 {
@@ -61,6 +62,11 @@ namespace LibMath
 		RowProxy		operator[](size_t const row);					// alternative for operator[][] overload
 		RowProxy		operator[](size_t const row) const;
 
+		float*				data(void) { return &m_elements[0][0]; };
+		float const*		data(void) const { return &m_elements[0][0]; };
+		float&				at_unchecked(size_t const row, size_t const col) { LIBMATH_ACCESS_CHECK(row < 3 && col < 3); return m_elements[row][col]; };	// same as [row][col], bounds checked only with LIBMATH_CHECKED_ACCESS
+		float				at_unchecked(size_t const row, size_t const col) const { LIBMATH_ACCESS_CHECK(row < 3 && col < 3); return m_elements[row][col]; };
+
 		Matrix3				transpose(void) const;
 		float				determinant(void) const;
 		Matrix3				minors(void) const;
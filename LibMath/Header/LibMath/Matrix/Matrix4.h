@@ -1,9 +1,12 @@
 #ifndef LIBMATH_MATRIX_MATRIX4_H_
 #define LIBMATH_MATRIX_MATRIX4_H_
 
+#include <span>
+
 #include "LibMath/Vector/Vector4.h"
 #include "LibMath/Vector/Vector3.h"
 #include "LibMath/LibMathFwd.h"
+#include "LibMath/Access.h"
 
 namespace LibMath
 {
@@ -64,7 +67,17 @@ namespace LibMath
 		Matrix4				cofators(void) const;
 		Matrix4				adjugate(void) const;
 		Matrix4				inverse(void) const;
+		Matrix4				inverseAffine(void) const;		// last row must be (0, 0, 0, 1), e.g. createTransform with any scale
+		Matrix4				inverseRigid(void) const;		// rotation and translation only, scaled matrices need inverseAffine
+		void				decompose(LibMath::Vector3& translation, LibMath::Quaternion& rotation, LibMath::Vector3& scale) const;	// T * R * S without shear (e.g. createTransform), a mirror gives a negative x scale, throw std::runtime_error on a zero scale
+
+		void				transformPoints(std::span<LibMath::Vector3 const> points, std::span<LibMath::Vector3> result,		// w = 1, homogenize for a perspective divide
+											bool const homogenize = false) const;	// points and directions round like operator* with a Vector4, Matrix.cpp is built without implicit fused multiply add
+		void				transformDirections(std::span<LibMath::Vector3 const> directions, std::span<LibMath::Vector3> result) const;	// w = 0, translation is ignored
 		float*				data(void) { return &m_elements[0][0]; };
+		float const*		data(void) const { return &m_elements[0][0]; };
+		float&				at_unchecked(size_t const row, size_t const col) { LIBMATH_ACCESS_CHECK(row < 4 && col < 4); return m_elements[row][col]; };	// same as [row][col], bounds checked only with LIBMATH_CHECKED_ACCESS
+		float				at_unchecked(size_t const row, size_t const col) const { LIBMATH_ACCESS_CHECK(row < 4 && col < 4); return m_elements[row][col]; };
 
 		static Matrix4		perspective(float const fov, float const aspectRatio, 
 							float const near, float const far);
@@ -87,7 +100,7 @@ namespace LibMath
 
 
 	private:
-		float m_elements[4][4] = { 0.0f };
+		alignas(16) float m_elements[4][4] = { 0.0f };		// column major, each column can be loaded in a single register
 	};
 
 	Matrix4				operator+(Matrix4 const& mat1, Matrix4 const& mat2);
@@ -1,19 +1,21 @@
 #ifndef LIBMATH_QUATERNION_H_
 #define LIBMATH_QUATERNION_H_
 
+#include <span>
 
 namespace LibMath
 {
 	class Radian;
 	class Vector3;
 	class Matrix3;
+	class Matrix4;
 
 	class Quaternion
 	{
 	public:
 							Quaternion() = default;										// set all component to 0
 							Quaternion(float x, float y, float z, float w);				// set all component individually
-							Quaternion(Quaternion const& other);						// copy all component
+							Quaternion(Quaternion const& other) = default;				// copy all component, trivially copyable
 							Quaternion(Radian rad, Vector3 vec);						// create rotation from an angle and an axis
 							Quaternion(Vector3 vec);						
 							Quaternion(Radian rad_x, Radian rad_y, Radian rad_z);					// create rotation from euler angles
@@ -28,9 +30,11 @@ namespace LibMath
 
 		Quaternion			inverse(void) const;
 
-		Vector3				rotate(Vector3 const& vec) const;
+		Vector3				rotate(Vector3 const& vec) const;				// q v q^-1 expanded as v + 2w (q x v) + 2q x (q x v), scaled by 1 / |q|^2 when q is not unit
+		void				rotate(std::span<Vector3> vecs) const;			// rotate every vector in place, 4 at a time with SSE4.1
 
-		Matrix3				toMatrix(void);
+		Matrix3				toMatrix(void) const;						// rotation of the normalized quaternion, column major like glm::mat3_cast
+		Matrix4				toMatrix4(void) const;						// same rotation with a zero translation
 
 		bool				isUnit(void) const;
 		
@@ -38,8 +42,15 @@ namespace LibMath
 
 		static Radian		angleBetween(Quaternion const& qStart, Quaternion const& qEnd);
 		static Quaternion	identity();
+		static Quaternion	fromMatrix(Matrix3 const& mat);				// Shepperd's method, mat must be a rotation, the result is unit
+		static Quaternion	fromMatrix(Matrix4 const& mat);				// rotation part only, without scale (see Matrix4::decompose)
 		static Quaternion	slerp(Quaternion const& qStart, Quaternion const& qEnd, float t);
 		static Quaternion	nlerp(Quaternion const& qStart, Quaternion const& qEnd, float t);
+		static Quaternion	slerpFast(Quaternion const& qStart, Quaternion const& qEnd, float t);		// unit quaternions only, polynomial slerp without trigonometry nor branch, error below 3e-7 per component up to 100deg of rotation and 4e-5 at worst
+
+		// unit quaternions only, 4 (SSE4.1) or 8 (AVX2) interpolations per iteration, throw std::invalid_argument if the sizes differ
+		static void			slerp(std::span<Quaternion const> qStarts, std::span<Quaternion const> qEnds, std::span<float const> ts, std::span<Quaternion> results);	// same results as slerpFast
+		static void			nlerp(std::span<Quaternion const> qStarts, std::span<Quaternion const> qEnds, std::span<float const> ts, std::span<Quaternion> results);
 
 		float&				operator[](unsigned int index);
 
@@ -51,11 +62,16 @@ namespace LibMath
 		float				m_w = 0.f;				// Real part
 	};
 
-	Quaternion				operator*(Quaternion const& q1, Quaternion const& q2);
+	Quaternion				operator*(Quaternion const& q1, Quaternion const& q2);		// Hamilton product, a single register with SSE4.1
 	Quaternion				operator+(Quaternion const& q1, Quaternion const& q2);
 	Quaternion				operator*(Quaternion const& q, float const& scalair);
 	bool					operator==(Quaternion const& q1, Quaternion const& q2);
 
+	inline Quaternion::Quaternion(float x, float y, float z, float w)
+		: m_x(x), m_y(y), m_z(z), m_w(w)
+	{
+	}
+
 }
 
 #endif // !LIBMATH_QUATERNION_H_
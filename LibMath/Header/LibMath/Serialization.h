@@ -0,0 +1,203 @@
+#ifndef LIBMATH_SERIALIZATION_H_
+#define LIBMATH_SERIALIZATION_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "LibMath/Angle/Radian.h"
+#include "LibMath/GeometricObject2.h"
+#include "LibMath/GeometricObject3.h"
+#include "LibMath/Matrix/Matrix3.h"
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Vector/Vector2.h"
+#include "LibMath/Vector/Vector3.h"
+#include "LibMath/Vector/Vector4.h"
+
+namespace LibMath
+{
+	namespace Serialization
+	{
+		/*
+		* Little endian binary codec, the stream has no header nor type tag :
+		* it is read back with the same sequence of calls and the same precision it was written with
+		*
+		* Full		-> every float takes 4 bytes and reads back bit for bit
+		* Quantized	-> every float takes 2 bytes (IEEE half, 11 significant bits, overflow to infinity past 65504)
+		*			   and a quaternion 4 bytes (smallest three, at most 0.002 error per component), meant for network snapshots
+		*
+		* Components are written in declaration order, Matrix3 row by row and Matrix4 column by column like their storage
+		* Array counts are always written as 32 bit integers
+		*/
+		enum class Precision
+		{
+			Full,
+			Quantized
+		};
+
+		std::uint16_t		floatToHalf(float value);					// round to nearest even, NaN stays NaN
+		float				halfToFloat(std::uint16_t half);
+
+		std::uint32_t		packQuaternion(Quaternion const& quat);		// smallest three, the quaternion is normalized first, a zero quaternion packs as the identity
+		Quaternion			unpackQuaternion(std::uint32_t packed);		// unit quaternion with a positive largest component
+
+		// number of floats of the types stored as a plain float array, bulk arrays of those are copied in one go
+		template <typename T> inline constexpr size_t c_floatCount = 0;
+		template <> inline constexpr size_t c_floatCount<float> = 1;
+		template <> inline constexpr size_t c_floatCount<Vector2> = 2;
+		template <> inline constexpr size_t c_floatCount<Vector3> = 3;
+		template <> inline constexpr size_t c_floatCount<Vector4> = 4;
+		template <> inline constexpr size_t c_floatCount<Matrix3> = 9;
+		template <> inline constexpr size_t c_floatCount<Matrix4> = 16;
+		template <> inline constexpr size_t c_floatCount<Geometry2D::Point> = 2;
+		template <> inline constexpr size_t c_floatCount<Geometry3D::Point> = 3;
+		template <> inline constexpr size_t c_floatCount<Geometry3D::Line> = 7;
+		template <> inline constexpr size_t c_floatCount<Geometry3D::Plan> = 4;
+		template <> inline constexpr size_t c_floatCount<Geometry3D::AABB> = 6;
+		template <> inline constexpr size_t c_floatCount<Geometry3D::Sphere> = 4;
+		template <> inline constexpr size_t c_floatCount<Geometry3D::Capsule> = 7;
+
+		class BinaryWriter
+		{
+		public:
+			explicit				BinaryWriter(std::vector<std::byte>& buffer, Precision const precision = Precision::Full);	// append to buffer, which must outlive the writer
+									~BinaryWriter() = default;
+
+			void					write(float const value);
+			void					write(Radian const angle);
+			void					write(Vector2 const& vec);
+			void					write(Vector3 const& vec);
+			void					write(Vector4 const& vec);
+			void					write(Matrix3 const& mat);
+			void					write(Matrix4 const& mat);
+			void					write(Quaternion const& quat);
+
+			void					write(Geometry2D::Point const& point);
+			void					write(Geometry2D::Line const& line);
+			void					write(Geometry2D::AABB const& aabb);
+			void					write(Geometry2D::OBB const& obb);
+			void					write(Geometry2D::Circle const& circle);
+
+			void					write(Geometry3D::Point const& point);
+			void					write(Geometry3D::Line const& line);
+			void					write(Geometry3D::Plan const& plan);
+			void					write(Geometry3D::AABB const& aabb);
+			void					write(Geometry3D::OBB const& obb);
+			void					write(Geometry3D::Sphere const& sphere);
+			void					write(Geometry3D::Capsule const& capsule);
+
+			template <typename T>
+			void					writeArray(std::span<T const> values);		// count then elements
+
+			Precision				getPrecision(void) const;
+			size_t					size(void) const;							// bytes in the buffer
+
+		private:
+			void					writeCount(size_t const count);
+			void					writeFloats(float const* values, size_t const count);
+
+			std::vector<std::byte>&	m_buffer;
+			Precision				m_precision;
+		};
+
+		class BinaryReader
+		{
+		public:
+			explicit				BinaryReader(std::span<std::byte const> buffer, Precision const precision = Precision::Full);	// no copy, the buffer (ex: a memory mapped file) must outlive the reader
+									~BinaryReader() = default;
+
+			// throw std::out_of_range when the buffer ends before the value
+			void					read(float& value);
+			void					read(Radian& angle);
+			void					read(Vector2& vec);
+			void					read(Vector3& vec);
+			void					read(Vector4& vec);
+			void					read(Matrix3& mat);
+			void					read(Matrix4& mat);
+			void					read(Quaternion& quat);
+
+			void					read(Geometry2D::Point& point);
+			void					read(Geometry2D::Line& line);
+			void					read(Geometry2D::AABB& aabb);
+			void					read(Geometry2D::OBB& obb);
+			void					read(Geometry2D::Circle& circle);
+
+			void					read(Geometry3D::Point& point);
+			void					read(Geometry3D::Line& line);
+			void					read(Geometry3D::Plan& plan);
+			void					read(Geometry3D::AABB& aabb);
+			void					read(Geometry3D::OBB& obb);
+			void					read(Geometry3D::Sphere& sphere);
+			void					read(Geometry3D::Capsule& capsule);
+
+			template <typename T>
+			void					readArray(std::vector<T>& values);			// replace the content of values, decoded straight from the buffer
+
+			Precision				getPrecision(void) const;
+			size_t					position(void) const;						// bytes already read
+			size_t					remaining(void) const;
+
+		private:
+			size_t					readCount(size_t const elementSize);		// throw std::out_of_range when the count does not fit in the rest of the buffer
+			void					readFloats(float* values, size_t const count);
+			void					require(size_t const byteCount) const;
+
+			std::span<std::byte const>	m_buffer;
+			size_t					m_position = 0;
+			Precision				m_precision;
+		};
+
+		template <typename T>
+		void BinaryWriter::writeArray(std::span<T const> values)
+		{
+			writeCount(values.size());
+
+			if constexpr (c_floatCount<T> != 0)
+			{
+				static_assert(sizeof(T) == c_floatCount<T> * sizeof(float) && std::is_standard_layout_v<T>);
+				writeFloats(reinterpret_cast<float const*>(values.data()), values.size() * c_floatCount<T>);
+			}
+			else
+			{
+				for (T const& value : values)
+				{
+					write(value);
+				}
+			}
+		}
+
+		template <typename T>
+		void BinaryReader::readArray(std::vector<T>& values)
+		{
+			size_t const floatSize = m_precision == Precision::Full ? sizeof(float) : sizeof(std::uint16_t);
+			size_t count = 0;
+
+			if constexpr (c_floatCount<T> != 0)
+			{
+				static_assert(sizeof(T) == c_floatCount<T> * sizeof(float) && std::is_standard_layout_v<T>);
+				count = readCount(c_floatCount<T> * floatSize);
+
+				values.resize(count);
+				readFloats(reinterpret_cast<float*>(values.data()), count * c_floatCount<T>);
+			}
+			else
+			{
+				// smallest element of any type, a quantized quaternion is as big as 2 halves
+				count = readCount(floatSize);
+
+				values.resize(count);
+				for (T& value : values)
+				{
+					read(value);
+				}
+			}
+		}
+	}
+}
+
+#endif // !LIBMATH_SERIALIZATION_H_
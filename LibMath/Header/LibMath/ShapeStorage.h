@@ -0,0 +1,194 @@
+#ifndef LIBMATH_SHAPESTORAGE_H_
+#define LIBMATH_SHAPESTORAGE_H_
+
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include "LibMath/GeometricObject3.h"
+#include "LibMath/Matrix/Matrix4.h"
+
+namespace LibMath
+{
+	namespace Geometry3D
+	{
+		enum class ShapeType
+		{
+			Point,
+			Line,
+			Plan,
+			AABB,
+			OBB,
+			Sphere,
+			Capsule
+		};
+
+		// same order as the alternatives of Shape
+		template <typename T> inline constexpr ShapeType c_shapeType = ShapeType::Point;
+		template <> inline constexpr ShapeType c_shapeType<Line> = ShapeType::Line;
+		template <> inline constexpr ShapeType c_shapeType<Plan> = ShapeType::Plan;
+		template <> inline constexpr ShapeType c_shapeType<AABB> = ShapeType::AABB;
+		template <> inline constexpr ShapeType c_shapeType<OBB> = ShapeType::OBB;
+		template <> inline constexpr ShapeType c_shapeType<Sphere> = ShapeType::Sphere;
+		template <> inline constexpr ShapeType c_shapeType<Capsule> = ShapeType::Capsule;
+
+		struct ShapeHandle
+		{
+			ShapeType			m_type = ShapeType::Point;
+			int					m_id = -1;					// stable until the shape is removed, then reused
+		};
+
+		/*
+		* One dense array per shape type, iterated without any virtual call nor pointer to follow
+		* Removing a shape moves the last shape of its type into the hole, the handles stay valid through an id to slot table
+		*/
+		class ShapeStorage
+		{
+		public:
+								ShapeStorage() = default;
+								~ShapeStorage() = default;
+
+			template <typename T>
+			ShapeHandle			add(T const& shape);
+			ShapeHandle			add(Shape const& shape);
+			void				remove(ShapeHandle const handle);			// throw std::out_of_range
+
+			template <typename T>
+			T&					get(ShapeHandle const handle);				// throw std::out_of_range, also when T is not the type of the handle
+			template <typename T>
+			T const&			get(ShapeHandle const handle) const;
+			Shape				getShape(ShapeHandle const handle) const;	// copy, throw std::out_of_range
+
+			template <typename T>
+			std::span<T>		getAll(void);								// every shape of a type, the order changes on remove
+			template <typename T>
+			std::span<T const>	getAll(void) const;
+
+			template <typename Function>
+			void				forEach(Function&& function);				// function(shape) for every shape, one loop per type
+			template <typename Function>
+			void				forEach(Function&& function) const;
+
+			void				update(Matrix4 const& transMat);			// same as update on every shape
+
+			size_t				size(void) const;
+			void				clear(void);
+
+		private:
+			template <typename T>
+			struct Pool
+			{
+				std::vector<T>		m_shapes;
+				std::vector<int>	m_idOfSlot;
+				std::vector<int>	m_slotOfId;					// -1 for a free id
+				std::vector<int>	m_freeIds;
+			};
+
+			template <typename T>
+			Pool<T>&			pool(void) { return std::get<Pool<T>>(m_pools); }
+			template <typename T>
+			Pool<T> const&		pool(void) const { return std::get<Pool<T>>(m_pools); }
+
+			template <typename T>
+			int					slotOf(ShapeHandle const handle) const;
+
+			std::tuple<Pool<Point>, Pool<Line>, Pool<Plan>, Pool<AABB>, Pool<OBB>, Pool<Sphere>, Pool<Capsule>>	m_pools;
+		};
+
+		template <typename T>
+		ShapeHandle ShapeStorage::add(T const& shape)
+		{
+			Pool<T>& shapes = pool<T>();
+
+			int id;
+			if (shapes.m_freeIds.empty())
+			{
+				id = static_cast<int>(shapes.m_slotOfId.size());
+				shapes.m_slotOfId.push_back(-1);
+			}
+			else
+			{
+				id = shapes.m_freeIds.back();
+				shapes.m_freeIds.pop_back();
+			}
+
+			shapes.m_slotOfId[id] = static_cast<int>(shapes.m_shapes.size());
+			shapes.m_shapes.push_back(shape);
+			shapes.m_idOfSlot.push_back(id);
+
+			return ShapeHandle{ c_shapeType<T>, id };
+		}
+
+		template <typename T>
+		T& ShapeStorage::get(ShapeHandle const handle)
+		{
+			return pool<T>().m_shapes[slotOf<T>(handle)];
+		}
+
+		template <typename T>
+		T const& ShapeStorage::get(ShapeHandle const handle) const
+		{
+			return pool<T>().m_shapes[slotOf<T>(handle)];
+		}
+
+		template <typename T>
+		std::span<T> ShapeStorage::getAll(void)
+		{
+			return pool<T>().m_shapes;
+		}
+
+		template <typename T>
+		std::span<T const> ShapeStorage::getAll(void) const
+		{
+			return pool<T>().m_shapes;
+		}
+
+		template <typename Function>
+		void ShapeStorage::forEach(Function&& function)
+		{
+			std::apply([&function](auto&... pools)
+			{
+				(..., [&function](auto& shapes)
+				{
+					for (auto& shape : shapes.m_shapes)
+					{
+						function(shape);
+					}
+				}(pools));
+			}, m_pools);
+		}
+
+		template <typename Function>
+		void ShapeStorage::forEach(Function&& function) const
+		{
+			std::apply([&function](auto const&... pools)
+			{
+				(..., [&function](auto const& shapes)
+				{
+					for (auto const& shape : shapes.m_shapes)
+					{
+						function(shape);
+					}
+				}(pools));
+			}, m_pools);
+		}
+
+		template <typename T>
+		int ShapeStorage::slotOf(ShapeHandle const handle) const
+		{
+			Pool<T> const& shapes = pool<T>();
+
+			if (handle.m_type != c_shapeType<T> || handle.m_id < 0 || handle.m_id >= static_cast<int>(shapes.m_slotOfId.size()) ||
+				shapes.m_slotOfId[handle.m_id] == -1)
+			{
+				throw std::out_of_range("Error: invalid shape handle");
+			}
+
+			return shapes.m_slotOfId[handle.m_id];
+		}
+	}
+}
+
+#endif // !LIBMATH_SHAPESTORAGE_H_
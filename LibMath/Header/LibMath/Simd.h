@@ -0,0 +1,120 @@
+#ifndef LIBMATH_SIMD_H_
+#define LIBMATH_SIMD_H_
+
+#include <cmath>
+#include <cstddef>
+
+/*
+* Instruction set selected at configure time with the LIBMATH_SIMD cmake option
+*
+* LIBMATH_SIMD_AVX2	-> 256 bit kernels (also defines LIBMATH_SIMD_SSE41)
+* LIBMATH_SIMD_SSE41	-> 128 bit kernels
+* none				-> scalar fallback
+*/
+
+#if defined(LIBMATH_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(LIBMATH_SIMD_SSE41)
+#include <smmintrin.h>
+#endif
+
+namespace LibMath::Simd
+{
+	/*
+	* Lane helpers shared by the array kernels : 8 lanes per register with AVX2, 4 with SSE4.1, 1 with the scalar fallback
+	* mulAdd is fused with AVX2 only, the bit operations and selects have no scalar fallback
+	*/
+#if defined(LIBMATH_SIMD_AVX2)
+	using Lanes = __m256;
+	size_t constexpr c_width = 8;
+
+	inline Lanes		load(float const* src) { return _mm256_load_ps(src); }
+	inline Lanes		loadUnaligned(float const* src) { return _mm256_loadu_ps(src); }
+	inline void			store(float* dst, Lanes lanes) { _mm256_store_ps(dst, lanes); }
+	inline void			storeUnaligned(float* dst, Lanes lanes) { _mm256_storeu_ps(dst, lanes); }
+	inline Lanes		set(float val) { return _mm256_set1_ps(val); }
+	inline Lanes		add(Lanes lhs, Lanes rhs) { return _mm256_add_ps(lhs, rhs); }
+	inline Lanes		sub(Lanes lhs, Lanes rhs) { return _mm256_sub_ps(lhs, rhs); }
+	inline Lanes		mul(Lanes lhs, Lanes rhs) { return _mm256_mul_ps(lhs, rhs); }
+	inline Lanes		div(Lanes lhs, Lanes rhs) { return _mm256_div_ps(lhs, rhs); }
+	inline Lanes		mulAdd(Lanes lhs, Lanes rhs, Lanes add) { return _mm256_fmadd_ps(lhs, rhs, add); }			// lhs * rhs + add
+	inline Lanes		negMulAdd(Lanes lhs, Lanes rhs, Lanes add) { return _mm256_fnmadd_ps(lhs, rhs, add); }		// add - lhs * rhs
+	inline Lanes		sqrt(Lanes lanes) { return _mm256_sqrt_ps(lanes); }
+	inline Lanes		roundNearest(Lanes lanes) { return _mm256_round_ps(lanes, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	inline Lanes		bitAnd(Lanes lhs, Lanes rhs) { return _mm256_and_ps(lhs, rhs); }
+	inline Lanes		bitXor(Lanes lhs, Lanes rhs) { return _mm256_xor_ps(lhs, rhs); }
+	inline Lanes		select(Lanes mask, Lanes ifSet, Lanes ifClear) { return _mm256_blendv_ps(ifClear, ifSet, mask); }
+#elif defined(LIBMATH_SIMD_SSE41)
+	using Lanes = __m128;
+	size_t constexpr c_width = 4;
+
+	inline Lanes		load(float const* src) { return _mm_load_ps(src); }
+	inline Lanes		loadUnaligned(float const* src) { return _mm_loadu_ps(src); }
+	inline void			store(float* dst, Lanes lanes) { _mm_store_ps(dst, lanes); }
+	inline void			storeUnaligned(float* dst, Lanes lanes) { _mm_storeu_ps(dst, lanes); }
+	inline Lanes		set(float val) { return _mm_set1_ps(val); }
+	inline Lanes		add(Lanes lhs, Lanes rhs) { return _mm_add_ps(lhs, rhs); }
+	inline Lanes		sub(Lanes lhs, Lanes rhs) { return _mm_sub_ps(lhs, rhs); }
+	inline Lanes		mul(Lanes lhs, Lanes rhs) { return _mm_mul_ps(lhs, rhs); }
+	inline Lanes		div(Lanes lhs, Lanes rhs) { return _mm_div_ps(lhs, rhs); }
+	inline Lanes		mulAdd(Lanes lhs, Lanes rhs, Lanes add) { return _mm_add_ps(_mm_mul_ps(lhs, rhs), add); }
+	inline Lanes		negMulAdd(Lanes lhs, Lanes rhs, Lanes add) { return _mm_sub_ps(add, _mm_mul_ps(lhs, rhs)); }
+	inline Lanes		sqrt(Lanes lanes) { return _mm_sqrt_ps(lanes); }
+	inline Lanes		roundNearest(Lanes lanes) { return _mm_round_ps(lanes, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	inline Lanes		bitAnd(Lanes lhs, Lanes rhs) { return _mm_and_ps(lhs, rhs); }
+	inline Lanes		bitXor(Lanes lhs, Lanes rhs) { return _mm_xor_ps(lhs, rhs); }
+	inline Lanes		select(Lanes mask, Lanes ifSet, Lanes ifClear) { return _mm_blendv_ps(ifClear, ifSet, mask); }
+#else
+	using Lanes = float;
+	size_t constexpr c_width = 1;
+
+	inline Lanes		load(float const* src) { return *src; }
+	inline Lanes		loadUnaligned(float const* src) { return *src; }
+	inline void			store(float* dst, Lanes lanes) { *dst = lanes; }
+	inline void			storeUnaligned(float* dst, Lanes lanes) { *dst = lanes; }
+	inline Lanes		set(float val) { return val; }
+	inline Lanes		add(Lanes lhs, Lanes rhs) { return lhs + rhs; }
+	inline Lanes		sub(Lanes lhs, Lanes rhs) { return lhs - rhs; }
+	inline Lanes		mul(Lanes lhs, Lanes rhs) { return lhs * rhs; }
+	inline Lanes		div(Lanes lhs, Lanes rhs) { return lhs / rhs; }
+	inline Lanes		mulAdd(Lanes lhs, Lanes rhs, Lanes add) { return lhs * rhs + add; }
+	inline Lanes		negMulAdd(Lanes lhs, Lanes rhs, Lanes add) { return add - lhs * rhs; }
+	inline Lanes		sqrt(Lanes lanes) { return std::sqrt(lanes); }
+#endif
+
+#if defined(LIBMATH_SIMD_SSE41)
+	/*
+	* 4 packed Vector3 (12 floats in 3 registers) <-> 3 registers holding 4 x, 4 y and 4 z
+	*/
+	inline void loadVector3x4(float const* src, __m128& x, __m128& y, __m128& z)
+	{
+		__m128 xyzx = _mm_loadu_ps(src);
+		__m128 yzxy = _mm_loadu_ps(src + 4);
+		__m128 zxyz = _mm_loadu_ps(src + 8);
+
+		x = _mm_blend_ps(_mm_blend_ps(xyzx, yzxy, 0b0100), zxyz, 0b0010);
+		y = _mm_blend_ps(_mm_blend_ps(xyzx, yzxy, 0b1001), zxyz, 0b0100);
+		z = _mm_blend_ps(_mm_blend_ps(xyzx, yzxy, 0b0010), zxyz, 0b1001);
+
+		x = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+		y = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+		z = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+	}
+
+	inline void storeVector3x4(float* dst, __m128 x, __m128 y, __m128 z)
+	{
+		__m128 xyzx = _mm_blend_ps(_mm_blend_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(y, y, _MM_SHUFFLE(0, 0, 0, 0)), 0b0010),
+								   _mm_shuffle_ps(z, z, _MM_SHUFFLE(0, 0, 0, 0)), 0b0100);
+		__m128 yzxy = _mm_blend_ps(_mm_blend_ps(_mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 1, 1, 1)), _mm_shuffle_ps(z, z, _MM_SHUFFLE(1, 1, 1, 1)), 0b0010),
+								   _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 2, 2, 2)), 0b0100);
+		__m128 zxyz = _mm_blend_ps(_mm_blend_ps(_mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 2, 2, 2)), _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3)), 0b0010),
+								   _mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 3, 3, 3)), 0b0100);
+
+		_mm_storeu_ps(dst, xyzx);
+		_mm_storeu_ps(dst + 4, yzxy);
+		_mm_storeu_ps(dst + 8, zxyz);
+	}
+#endif
+}
+
+#endif // !LIBMATH_SIMD_H_
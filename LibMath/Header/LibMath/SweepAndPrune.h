@@ -0,0 +1,67 @@
+#ifndef LIBMATH_SWEEPANDPRUNE_H_
+#define LIBMATH_SWEEPANDPRUNE_H_
+
+#include <utility>
+#include <vector>
+
+#include "LibMath/GeometricObject2.h"
+
+namespace LibMath
+{
+	namespace Collision2D
+	{
+		/*
+		* Sort and sweep broad phase over Geometry2D bounds
+		* The intervals stay sorted on the sweep axis between frames, so the insertion sort of queryPairs
+		* only moves the few proxies that crossed a neighbour since the last call
+		* The candidate pairs overlap on both axes, the checkCollision functions do the exact test
+		*/
+		class SweepAndPrune
+		{
+		public:
+			enum class Axis
+			{
+				X,
+				Y
+			};
+
+			explicit				SweepAndPrune(Axis const axis = Axis::X);	// sweep along Y when the scene spreads vertically
+									~SweepAndPrune() = default;
+
+			int						insert(Geometry2D::AABB const& bounds);					// return the proxy id
+			void					remove(int const proxy);								// throw std::out_of_range
+			void					move(int const proxy, Geometry2D::AABB const& bounds);	// throw std::out_of_range, sorted again by queryPairs
+
+			void					queryPairs(std::vector<std::pair<int, int>>& result);	// append each overlapping pair once, first < second
+
+			Axis					getAxis(void) const;
+			void					setAxis(Axis const axis);								// full sort of the intervals
+
+			size_t					size(void) const;
+			void					clear(void);
+
+		private:
+			struct Interval
+			{
+				float				m_min = 0.f;				// on the sweep axis
+				float				m_max = 0.f;
+				float				m_crossMin = 0.f;			// on the other axis
+				float				m_crossMax = 0.f;
+				int					m_proxy = -1;
+			};
+
+			Interval				toInterval(Geometry2D::AABB const& bounds, int const proxy) const;
+			void					sort(void);
+			void					fullSort(void);
+			void					checkProxy(int const proxy) const;
+
+			std::vector<Interval>	m_intervals;				// sorted by m_min
+			std::vector<int>		m_intervalOfProxy;			// -1 for a free proxy id
+			std::vector<int>		m_freeProxies;
+			size_t					m_insertedCount = 0;		// proxies appended since the last sort
+			Axis					m_axis;
+		};
+	}
+}
+
+#endif // !LIBMATH_SWEEPANDPRUNE_H_
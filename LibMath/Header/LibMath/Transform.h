@@ -0,0 +1,45 @@
+#ifndef LIBMATH_TRANSFORM_H_
+#define LIBMATH_TRANSFORM_H_
+
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Vector/Vector3.h"
+
+namespace LibMath
+{
+	/*
+	* Translation, rotation and scale kept apart, applied to a point as T * R * S like Matrix4::createTransform
+	* Composing two transforms costs a Hamilton product and a rotated vector (about 40 multiplies against 64 for a Matrix4 product)
+	* and the inverse needs no determinant, the Matrix4 is only built by toMatrix when it is needed (ex: upload to the GPU)
+	*
+	* A non uniform scale under a rotated child is a shear, which a TRS cannot hold :
+	* compose and inverse are exact when the scale is uniform, otherwise the shear is dropped like in most engines
+	*/
+	class Transform
+	{
+	public:
+							Transform() = default;																			// identity
+							Transform(Vector3 const& translation, Quaternion const& rotation, Vector3 const& scale);		// rotation must be unit
+		explicit			Transform(Matrix4 const& mat);																	// see Matrix4::decompose, throw std::runtime_error on a zero scale
+							Transform(Transform const& other) = default;
+							~Transform() = default;
+
+		Transform&			operator=(Transform const& other) = default;
+
+		Transform			inverse(void) const;							// throw std::runtime_error on a zero scale
+		Matrix4				toMatrix(void) const;							// same matrix as T * R * S without any product
+
+		Vector3				transformPoint(Vector3 const& point) const;				// t + R (S p)
+		Vector3				transformDirection(Vector3 const& direction) const;		// R (S d), translation is ignored
+
+		static Transform	identity(void);
+
+		Vector3				m_translation;
+		Quaternion			m_rotation{ 0.f, 0.f, 0.f, 1.f };
+		Vector3				m_scale = Vector3::one();
+	};
+
+	Transform				operator*(Transform const& parent, Transform const& child);		// child in the parent space, same order as Matrix4 : (parent * child).toMatrix() == parent.toMatrix() * child.toMatrix()
+}
+
+#endif // !LIBMATH_TRANSFORM_H_
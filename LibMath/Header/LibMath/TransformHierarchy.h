@@ -0,0 +1,62 @@
+#ifndef LIBMATH_TRANSFORMHIERARCHY_H_
+#define LIBMATH_TRANSFORMHIERARCHY_H_
+
+#include <vector>
+
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Transform.h"
+
+namespace LibMath
+{
+	/*
+	* Flat scene graph of local to world matrices, world = parent world * local
+	* A node is only added after its parent, so the node ids are a topological order and every pass walks the arrays forward
+	* setLocal marks the node dirty, update recomputes the world matrices of the dirty nodes and of their descendants only
+	*
+	* The nodes below each root are an independent subtree : update skips the clean ones
+	* and updateParallel hands the dirty ones to worker threads, a scene under a single root gains nothing from it
+	* updateParallel starts and joins its threads on every call (tens of microseconds each), so every thread gets
+	* at least minNodesPerThread nodes of the dirty subtrees and smaller updates run on the calling thread only
+	*/
+	class TransformHierarchy
+	{
+	public:
+		static constexpr int	noParent = -1;
+		static constexpr size_t	minNodesPerThread = 2048;
+
+								TransformHierarchy() = default;
+								~TransformHierarchy() = default;
+
+		int						addNode(Matrix4 const& local, int const parent = noParent);	// return the node id, throw std::out_of_range for an unknown parent
+		void					setLocal(int const node, Matrix4 const& local);				// throw std::out_of_range
+		void					setLocal(int const node, Transform const& local);			// throw std::out_of_range
+
+		Matrix4 const&			getLocal(int const node) const;								// throw std::out_of_range
+		Matrix4 const&			getWorld(int const node) const;								// throw std::out_of_range, as of the last update
+		int						getParent(int const node) const;							// throw std::out_of_range
+		bool					isDirty(int const node) const;								// throw std::out_of_range, the subtree of a dirty node is stale as well
+
+		void					update(void);
+		void					updateParallel(unsigned int threadCount = 0);				// 0 for std::thread::hardware_concurrency, same result as update
+
+		size_t					size(void) const;
+		void					reserve(size_t const nodeCount);
+		void					clear(void);
+
+	private:
+		void					updateSubtree(int const subtree);
+		void					checkNode(int const node) const;
+
+		std::vector<Matrix4>	m_locals;
+		std::vector<Matrix4>	m_worlds;
+		std::vector<int>		m_parents;
+		std::vector<int>		m_subtreeOfNode;
+		std::vector<unsigned char>	m_dirty;								// not std::vector<bool>, the subtrees are updated from several threads
+
+		std::vector<std::vector<int>>	m_subtrees;							// node ids below each root, in topological order
+		std::vector<int>		m_dirtySubtrees;							// subtrees with at least a dirty node, each listed once
+		std::vector<unsigned char>	m_subtreeDirty;
+	};
+}
+
+#endif // !LIBMATH_TRANSFORMHIERARCHY_H_
@@ -1,6 +1,8 @@
 #ifndef LIBMATH_TRIGONOMETRY_H_
 #define LIBMATH_TRIGONOMETRY_H_
 
+#include <span>
+
 #include "Angle/Radian.h"
 
 namespace LibMath
@@ -15,6 +17,31 @@ namespace LibMath
 	Radian				acos(float val);		// Degree angle = acos(0.707107);		// Degree{44.99998}	// this make use implicit conversion
 	Radian				atan(float val);		// Radian angle = atan(0.546302);		// Radian{0.500000}
 	Radian				atan(float val1, float val2); // Radian angle = atan(1, -2);			// Radian{2.677945}
+
+	struct SinCos
+	{
+		float			m_sin = 0.f;
+		float			m_cos = 1.f;
+	};
+
+	SinCos				sincos(Radian rad);		// same values as sin(rad) and cos(rad), the angle is wrapped once
+
+	/*
+	* Opt-in polynomial approximations, no call into the C library
+	* The angle is reduced to [-pi/4, pi/4] around the closest quarter turn then evaluated with the minimax polynomials of Cephes
+	* Max absolute error against sin / cos in double : 1e-7 for |angle| <= 8192, larger angles are wrapped first like sin(Radian)
+	* Max absolute error against atan / atan2 in double : 2e-7 rad for atanFast(val), 3e-7 rad for atanFast(val1, val2)
+	*/
+	float				sinFast(Radian rad);
+	float				cosFast(Radian rad);
+	SinCos				sincosFast(Radian rad);
+	Radian				atanFast(float val);
+	Radian				atanFast(float val1, float val2);	// atan(val1 / val2) in the quadrant of (val2, val1) as atan(val1, val2), 0 for (0, 0)
+
+	// Arrays of angles with the polynomials of sinFast and cosFast, vectorized, throw std::invalid_argument on a size mismatch
+	void				sin(std::span<Radian const> rads, std::span<float> results);
+	void				cos(std::span<Radian const> rads, std::span<float> results);
+	void				sincos(std::span<Radian const> rads, std::span<float> sinResults, std::span<float> cosResults);
 }
 
 #endif // !LIBMATH_TRIGONOMETRY_H_
@@ -4,5 +4,6 @@
 #include "Vector/Vector2.h"
 #include "Vector/Vector3.h"
 #include "Vector/Vector4.h"
+#include "Vector/Vector3Batch.h"
 
 #endif // !LIBMATH_VECTOR_H_
@@ -5,6 +5,9 @@
 #include "LibMath/Angle/Radian.h"
 #endif // !LIBMATH_ANGLE_RADIAN_H_
 
+#include <cmath>
+#include <stdexcept>
+
 #include "LibMath/GeometricObject2.h"
 #include "LibMath/LibMathFwd.h"
 
@@ -13,42 +16,42 @@ namespace LibMath
 	class Vector2
 	{
 	public:
-							Vector2();
-		explicit			Vector2(float val);
-							Vector2(float valx, float valy);
-							Vector2(Vector2 const& other);
+		constexpr			Vector2();
+		constexpr explicit	Vector2(float val);
+		constexpr			Vector2(float valx, float valy);
+		constexpr			Vector2(Vector2 const& other);
 							Vector2(Geometry2D::Point const& point);
 							~Vector2() = default;
 	
 		
-		float&			operator[](int n);
-		float			operator[](int n) const;
-		Vector2&		operator=(const Vector2& other);
-		Vector2&		operator-(void);							//prefix -Vector2
-		Vector2&		operator+=(const Vector2& other);
-		Vector2&		operator-=(const Vector2& other);
-		Vector2&		operator*=(const Vector2& other);
-		Vector2&		operator*=(const float& val);
-		Vector2&		operator/=(const Vector2& other);
-		Vector2&		operator/=(const float& val);
+		constexpr float&	operator[](int n);
+		constexpr float		operator[](int n) const;
+		constexpr Vector2&	operator=(const Vector2& other);
+		constexpr Vector2&	operator-(void);							//prefix -Vector2
+		constexpr Vector2&	operator+=(const Vector2& other);
+		constexpr Vector2&	operator-=(const Vector2& other);
+		constexpr Vector2&	operator*=(const Vector2& other);
+		constexpr Vector2&	operator*=(const float& val);
+		constexpr Vector2&	operator/=(const Vector2& other);
+		constexpr Vector2&	operator/=(const float& val);
 
 		float				magnitude(void) const;
 		bool				isUnit(void) const;
-		float				dotProduct(Vector2 vec) const;
-		float				magnitudeSquare(void) const;
+		constexpr float		dotProduct(Vector2 vec) const;
+		constexpr float		magnitudeSquare(void) const;
 		void				normalize(void);
 		LibMath::Radian		angleBetween(Vector2 vec) const;
-		float				crossProduct(Vector2 vec) const;
+		constexpr float		crossProduct(Vector2 vec) const;
 		Vector2				projectOnto(Vector2 vec);
 		Vector2				reflectOnto(Vector2 vec);
 
-		friend bool		operator==(Vector2 vec1, Vector2 vec2);
-		friend Vector2	operator-(Vector2 vec1, Vector2 vec2);
-		friend Vector2	operator+(Vector2 vec1, Vector2 vec2);
-		friend Vector2	operator*(Vector2 vec, float val);
-		friend Vector2	operator*(Vector2 vec1, Vector2 vec2);
-		friend Vector2	operator/(Vector2 vec, float val);
-		friend Vector2	operator/(Vector2 vec1, Vector2 vec2);
+		friend constexpr bool		operator==(Vector2 vec1, Vector2 vec2);
+		friend constexpr Vector2	operator-(Vector2 vec1, Vector2 vec2);
+		friend constexpr Vector2	operator+(Vector2 vec1, Vector2 vec2);
+		friend constexpr Vector2	operator*(Vector2 vec, float val);
+		friend constexpr Vector2	operator*(Vector2 vec1, Vector2 vec2);
+		friend constexpr Vector2	operator/(Vector2 vec, float val);
+		friend constexpr Vector2	operator/(Vector2 vec1, Vector2 vec2);
 
 		float m_x = 0.f;
 		float m_y = 0.f;
@@ -57,13 +60,17 @@ namespace LibMath
 		 
 	};
 
-	bool				operator==(Vector2 vec1, Vector2 vec2);
-	Vector2				operator-(Vector2 vec1, Vector2 vec2);
-	Vector2				operator+(Vector2 vec1, Vector2 vec2);
-	Vector2				operator*(Vector2 vec, float val);
-	Vector2				operator/(Vector2 vec, float val);
+	constexpr bool		operator==(Vector2 vec1, Vector2 vec2);
+	constexpr Vector2	operator-(Vector2 vec1, Vector2 vec2);
+	constexpr Vector2	operator+(Vector2 vec1, Vector2 vec2);
+	constexpr Vector2	operator*(Vector2 vec, float val);
+	constexpr Vector2	operator*(Vector2 vec1, Vector2 vec2);
+	constexpr Vector2	operator/(Vector2 vec, float val);
+	constexpr Vector2	operator/(Vector2 vec1, Vector2 vec2);
 
 
 }
 
+#include "LibMath/Vector/Vector2.inl"
+
 #endif // !LIBMATH_VECTOR_VECTOR2_H_
\ No newline at end of file
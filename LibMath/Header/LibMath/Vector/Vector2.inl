@@ -0,0 +1,197 @@
+#ifndef LIBMATH_VECTOR_VECTOR2_INL_
+#define LIBMATH_VECTOR_VECTOR2_INL_
+
+// Inline definitions of the trivial Vector2 operations, included at the end of Vector2.h
+
+constexpr LibMath::Vector2::Vector2()
+	: m_x(0.0f), m_y(0.0f)
+{
+}
+
+constexpr LibMath::Vector2::Vector2(float val)
+	: m_x(val), m_y(val)
+{
+}
+
+constexpr LibMath::Vector2::Vector2(float valx, float valy)
+	: m_x(valx), m_y(valy)
+{
+}
+
+constexpr LibMath::Vector2::Vector2(Vector2 const& other)
+	: m_x(other.m_x), m_y(other.m_y)
+{
+}
+
+constexpr float& LibMath::Vector2::operator[](int n)
+{
+	if (n == 0)
+	{
+		return m_x;
+	}
+
+	if (n == 1)
+	{
+		return m_y;
+	}
+
+	throw(std::invalid_argument("Invalid argument"));
+}
+
+constexpr float LibMath::Vector2::operator[](int n) const
+{
+	if (n == 0)
+	{
+		return m_x;
+	}
+
+	if (n == 1)
+	{
+		return m_y;
+	}
+
+	throw(std::invalid_argument("Invalid argument"));
+}
+
+constexpr LibMath::Vector2& LibMath::Vector2::operator=(const Vector2& other)
+{
+	m_x = other.m_x;
+	m_y = other.m_y;
+
+	return *this;
+}
+
+constexpr LibMath::Vector2& LibMath::Vector2::operator-(void)
+{
+	m_x = -m_x;
+	m_y = -m_y;
+
+	return *this;
+}
+
+constexpr LibMath::Vector2& LibMath::Vector2::operator+=(const Vector2& other)
+{
+	m_x += other.m_x;
+	m_y += other.m_y;
+
+	return *this;
+}
+
+constexpr LibMath::Vector2& LibMath::Vector2::operator-=(const Vector2& other)
+{
+	m_x -= other.m_x;
+	m_y -= other.m_y;
+
+	return *this;
+}
+
+constexpr LibMath::Vector2& LibMath::Vector2::operator*=(const Vector2& other)
+{
+	m_x *= other.m_x;
+	m_y *= other.m_y;
+
+	return *this;
+}
+
+constexpr LibMath::Vector2& LibMath::Vector2::operator*=(const float& val)
+{
+	m_x *= val;
+	m_y *= val;
+
+	return *this;
+}
+
+constexpr LibMath::Vector2& LibMath::Vector2::operator/=(const Vector2& other)
+{
+	if (other.m_x == 0.f || other.m_y == 0.f)
+	{
+		throw std::runtime_error("Error: Division by zero \n x or y component is null.");
+	}
+
+	m_x /= other.m_x;
+	m_y /= other.m_y;
+
+	return *this;
+}
+
+constexpr LibMath::Vector2& LibMath::Vector2::operator/=(const float& val)
+{
+	if (val == 0.f)
+	{
+		throw std::runtime_error("Error: Division by zero");
+	}
+
+	m_x /= val;
+	m_y /= val;
+
+	return *this;
+}
+
+inline float LibMath::Vector2::magnitude(void) const
+{
+	return std::sqrt(magnitudeSquare());
+}
+
+constexpr float LibMath::Vector2::dotProduct(Vector2 vec) const
+{
+	return m_x * vec.m_x + m_y * vec.m_y;
+}
+
+constexpr float LibMath::Vector2::magnitudeSquare(void) const
+{
+	return m_x * m_x + m_y * m_y;
+}
+
+inline void LibMath::Vector2::normalize(void)
+{
+	float mag = magnitude();
+
+	m_x /= mag;
+	m_y /= mag;
+}
+
+constexpr float LibMath::Vector2::crossProduct(Vector2 vec) const
+{
+	return (m_x * vec.m_y - m_y * vec.m_x);
+}
+
+constexpr bool LibMath::operator==(Vector2 vec1, Vector2 vec2)
+{
+	return (vec1.m_x == vec2.m_x && vec1.m_y == vec2.m_y);
+}
+
+constexpr LibMath::Vector2 LibMath::operator-(Vector2 vec1, Vector2 vec2)
+{
+	return Vector2(vec1.m_x - vec2.m_x, vec1.m_y - vec2.m_y);
+}
+
+constexpr LibMath::Vector2 LibMath::operator+(Vector2 vec1, Vector2 vec2)
+{
+	return Vector2(vec1.m_x + vec2.m_x, vec1.m_y + vec2.m_y);
+}
+
+constexpr LibMath::Vector2 LibMath::operator*(Vector2 vec, float val)
+{
+	return Vector2(vec.m_x * val, vec.m_y * val);
+}
+
+constexpr LibMath::Vector2 LibMath::operator*(Vector2 vec1, Vector2 vec2)
+{
+	return Vector2(vec1.m_x * vec2.m_x, vec1.m_y * vec2.m_y);
+}
+
+constexpr LibMath::Vector2 LibMath::operator/(Vector2 vec, float val)
+{
+	if (val == 0.f)
+	{
+		throw(std::invalid_argument("Error: Division by zero"));
+	}
+	return Vector2(vec.m_x / val, vec.m_y / val);
+}
+
+constexpr LibMath::Vector2 LibMath::operator/(Vector2 vec1, Vector2 vec2)
+{
+	return Vector2(vec1.m_x / vec2.m_x, vec1.m_y / vec2.m_y);
+}
+
+#endif // !LIBMATH_VECTOR_VECTOR2_INL_
@@ -1,7 +1,11 @@
 #ifndef LIBMATH_VECTOR_VECTOR3_H_
 #define LIBMATH_VECTOR_VECTOR3_H_
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 #include "LibMath/LibMathFwd.h"
@@ -16,41 +20,41 @@ namespace LibMath
 	{
 	public:
 							Vector3() = default;										// set all component to 0
-		explicit			Vector3(float val);									// set all component to the same value
-							Vector3(float val_x, float val_y, float val_z);					// set all component individually
-							Vector3(Vector3 const& other);						// copy all component
+		constexpr explicit	Vector3(float val);									// set all component to the same value
+		constexpr			Vector3(float val_x, float val_y, float val_z);					// set all component individually
+		constexpr			Vector3(Vector3 const& other);						// copy all component
 							Vector3(LibMath::Geometry3D::Point const& point);
 							~Vector3() = default;
 		
 		operator			LibMath::Vector4() const;
 
-		static Vector3		zero(void);											// return a vector with all its component set to 0
-		static Vector3		one(void);											// return a vector with all its component set to 1
-		static Vector3		up(void);											// return a unit vector pointing upward
-		static Vector3		down(void);											// return a unit vector pointing downward
-		static Vector3		left(void);											// return a unit vector pointing left
-		static Vector3		right(void);										// return a unit vector pointing right
-		static Vector3		front(void);										// return a unit vector pointing forward
-		static Vector3		back(void);											// return a unit vector pointing backward
+		static constexpr Vector3	zero(void);											// return a vector with all its component set to 0
+		static constexpr Vector3	one(void);											// return a vector with all its component set to 1
+		static constexpr Vector3	up(void);											// return a unit vector pointing upward
+		static constexpr Vector3	down(void);											// return a unit vector pointing downward
+		static constexpr Vector3	left(void);											// return a unit vector pointing left
+		static constexpr Vector3	right(void);										// return a unit vector pointing right
+		static constexpr Vector3	front(void);										// return a unit vector pointing forward
+		static constexpr Vector3	back(void);											// return a unit vector pointing backward
 
-		static Vector3		lerp(Vector3 const& vec1, Vector3 const& vec2, float t);
+		static constexpr Vector3	lerp(Vector3 const& vec1, Vector3 const& vec2, float t);
 
 		Vector3&		operator=(Vector3 const& other) = default;
 
 
-		float&			operator[](int n);								// return this vector component value
-		float			operator[](int n) const;							// return this vector component value
+		constexpr float&	operator[](int n);								// return this vector component value
+		constexpr float		operator[](int n) const;							// return this vector component value
 
 		Radian				angleFrom(Vector3 const& vec) const;				// return smallest angle between 2 vector
 
-		Vector3				cross(Vector3 const& vec) const;					// return a copy of the cross product result
+		constexpr Vector3	cross(Vector3 const& vec) const;					// return a copy of the cross product result
 
 		float				distanceFrom(Vector3 const& vec) const;				// return distance between 2 points
-		float				distanceSquaredFrom(Vector3 const& vec) const;		// return square value of the distance between 2 points
+		constexpr float		distanceSquaredFrom(Vector3 const& vec) const;		// return square value of the distance between 2 points
 		float				distance2DFrom(Vector3 const& vec) const;			// return the distance between 2 points on the X-Y axis only
-		float				distance2DSquaredFrom(Vector3 const& vec) const;	// return the square value of the distance between 2 points points on the X-Y axis only
+		constexpr float		distance2DSquaredFrom(Vector3 const& vec) const;	// return the square value of the distance between 2 points points on the X-Y axis only
 
-		float				dot(Vector3 const& vec) const;						// return dot product result
+		constexpr float		dot(Vector3 const& vec) const;						// return dot product result
 
 		bool				isLongerThan(Vector3 const& vec) const;				// return true if this vector magnitude is greater than the other
 		bool				isShorterThan(Vector3 const& vec) const;			// return true if this vector magnitude is less than the other
@@ -58,7 +62,7 @@ namespace LibMath
 		bool				isUnitVector(void) const;							// return true if this vector magnitude is 1
 
 		float				magnitude(void) const;								// return vector magnitude
-		float				magnitudeSquared(void) const;						// return square value of the vector magnitude
+		constexpr float		magnitudeSquared(void) const;						// return square value of the vector magnitude
 
 		void				normalize(void);									// scale this vector to have a magnitude of 1
 
@@ -73,12 +77,14 @@ namespace LibMath
 		void				rotate(Radian angle, Vector3 const& vec);					// rotate this vector around an arbitrary axis
 		void				rotate(class Quaternion const&);					// rotate this vector using a quaternion rotor
 
-		void				scale(Vector3 const& vec);							// scale this vector by a given factor
+		constexpr void		scale(Vector3 const& vec);							// scale this vector by a given factor
 
 		std::string			string(void) const;									// return a string representation of this vector
 		std::string			stringLong(void) const;								// return a verbose string representation of this vector
 
-		void				translate(Vector3 const& vec);						// offset this vector by a given distance
+		constexpr void		translate(Vector3 const& vec);						// offset this vector by a given distance
+
+		static constexpr size_t	c_maxChars = 49;							// longest toChars output : 3 floats of at most 15 characters, 2 commas and the braces
 
 		float m_x = 0.0f;
 		float m_y = 0.0f;
@@ -90,27 +96,32 @@ namespace LibMath
 	Vector3					rotateArroundAxis(Vector3 const& vector, Vector3 const& axis, Radian angle);
 	std::string				formatNumber(float value);
 
-	bool				operator==(Vector3 const& vec1, Vector3 const& vec2);			// Vector3{ 1 } == Vector3::one()				// true					// return if 2 vectors have the same component
-	bool				operator!=(Vector3 const& vec1, Vector3 const& vec2);			// Vector3{ 1 } != Vector3::one()				// false				// return if 2 vectors differ by at least a component
+	std::to_chars_result	toChars(char* first, char* last, Vector3 const& vec);				// char buffer[Vector3::c_maxChars]; toChars(buffer, buffer + sizeof buffer, vec)	// write "{x,y,z}" with the shortest representation that reads back to the same floats, never allocate
+	std::from_chars_result	fromChars(char const* first, char const* last, Vector3& vec);		// fromChars(text.data(), text.data() + text.size(), vec)						// parse "{x,y,z}", blanks are allowed between the tokens, vec is left untouched on error
+
+	constexpr bool		operator==(Vector3 const& vec1, Vector3 const& vec2);			// Vector3{ 1 } == Vector3::one()				// true					// return if 2 vectors have the same component
+	constexpr bool		operator!=(Vector3 const& vec1, Vector3 const& vec2);			// Vector3{ 1 } != Vector3::one()				// false				// return if 2 vectors differ by at least a component
 
-	Vector3				operator-(Vector3 vec);									// - Vector3{ .5, 1.5, -2.5 }					// { -.5, -1.5, 2.5 }	// return a copy of a vector with all its component inverted
+	constexpr Vector3	operator-(Vector3 vec);									// - Vector3{ .5, 1.5, -2.5 }					// { -.5, -1.5, 2.5 }	// return a copy of a vector with all its component inverted
 
-	Vector3				operator+(Vector3 vec1, Vector3 const& vec2);					// Vector3{ .5, 1.5, -2.5 } + Vector3::one()	// { 1.5, 2.5, -1.5 }	// add 2 vectors component wise
-	Vector3				operator-(Vector3 vec1, Vector3 const& vec2);					// Vector3{ .5, 1.5, -2.5 } - Vector3{ 1 }		// { -.5, .5, -3.5 }	// subtract 2 vectors component wise
-	Vector3				operator*(Vector3 vec1, Vector3 const& vec2);					// Vector3{ .5, 1.5, -2.5 } * Vector3::zero()	// { 0, 0, 0 }			// multiply 2 vectors component wise
-	Vector3				operator*(Vector3 vec, float val);
-	Vector3				operator/(Vector3 vec1, Vector3 const& vec2);					// Vector3{ .5, 1.5, -2.5 } / Vector3{ 2 }		// { .25, .75, -1.25 }	// divide 2 vectors component wise
-	Vector3				operator/(Vector3 vec, float val);
+	constexpr Vector3	operator+(Vector3 vec1, Vector3 const& vec2);					// Vector3{ .5, 1.5, -2.5 } + Vector3::one()	// { 1.5, 2.5, -1.5 }	// add 2 vectors component wise
+	constexpr Vector3	operator-(Vector3 vec1, Vector3 const& vec2);					// Vector3{ .5, 1.5, -2.5 } - Vector3{ 1 }		// { -.5, .5, -3.5 }	// subtract 2 vectors component wise
+	constexpr Vector3	operator*(Vector3 vec1, Vector3 const& vec2);					// Vector3{ .5, 1.5, -2.5 } * Vector3::zero()	// { 0, 0, 0 }			// multiply 2 vectors component wise
+	constexpr Vector3	operator*(Vector3 vec, float val);
+	constexpr Vector3	operator/(Vector3 vec1, Vector3 const& vec2);					// Vector3{ .5, 1.5, -2.5 } / Vector3{ 2 }		// { .25, .75, -1.25 }	// divide 2 vectors component wise
+	constexpr Vector3	operator/(Vector3 vec, float val);
 
-	Vector3&			operator+=(Vector3& vec1, Vector3 const& vec2);				// addition component wise
-	Vector3&			operator-=(Vector3& vec1, Vector3 const& vec2);				// subtraction component wise
-	Vector3&			operator*=(Vector3& vec1, Vector3 const& vec2);				// multiplication component wise
-	Vector3&			operator*=(Vector3& vec, float val);
-	Vector3&			operator/=(Vector3& vec1, Vector3 const& vec2);				// division component wise
-	Vector3&			operator/=(Vector3& vec1, float val);
+	constexpr Vector3&	operator+=(Vector3& vec1, Vector3 const& vec2);				// addition component wise
+	constexpr Vector3&	operator-=(Vector3& vec1, Vector3 const& vec2);				// subtraction component wise
+	constexpr Vector3&	operator*=(Vector3& vec1, Vector3 const& vec2);				// multiplication component wise
+	constexpr Vector3&	operator*=(Vector3& vec, float val);
+	constexpr Vector3&	operator/=(Vector3& vec1, Vector3 const& vec2);				// division component wise
+	constexpr Vector3&	operator/=(Vector3& vec1, float val);
 
-	std::ostream&		operator<<(std::ostream& os, Vector3 const& vec);			// cout << Vector3{ .5, 1.5, -2.5 }				// add a vector string representation to an output stream
+	std::ostream&		operator<<(std::ostream& os, Vector3 const& vec);			// cout << Vector3{ .5, 1.5, -2.5 }				// add the toChars representation of a vector to an output stream
 	std::istream&		operator>>(std::istream& is, Vector3& vec);				// ifstream file{ save.txt }; file >> vector;	// parse a string representation from an input stream into a vector
 }
 
+#include "LibMath/Vector/Vector3.inl"
+
 #endif // !LIBMATH_VECTOR_VECTOR3_H_
@@ -0,0 +1,314 @@
+#ifndef LIBMATH_VECTOR_VECTOR3_INL_
+#define LIBMATH_VECTOR_VECTOR3_INL_
+
+// Inline definitions of the trivial Vector3 operations, included at the end of Vector3.h
+
+constexpr LibMath::Vector3::Vector3(float val)
+	: m_x(val), m_y(val), m_z(val)
+{
+}
+
+constexpr LibMath::Vector3::Vector3(float val_x, float val_y, float val_z)
+	: m_x(val_x), m_y(val_y), m_z(val_z)
+{
+}
+
+constexpr LibMath::Vector3::Vector3(Vector3 const& other)
+	: m_x(other.m_x), m_y(other.m_y), m_z(other.m_z)
+{
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::zero(void)
+{
+	return Vector3(0.0f);
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::one(void)
+{
+	return Vector3(1.0f);
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::up(void)
+{
+	return Vector3(0.0f, 1.0f, 0.0f);
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::down(void)
+{
+	return Vector3(0.0f, -1.0f, 0.0f);
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::left(void)
+{
+	return Vector3(-1.0f, 0.0f, 0.0f);
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::right(void)
+{
+	return Vector3(1.0f, 0.0f, 0.0f);
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::front(void)
+{
+	return Vector3(0.0f, 0.0f, 1.0f);
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::back(void)
+{
+	return Vector3(0.0f, 0.0f, -1.0f);
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::lerp(Vector3 const& vec1, Vector3 const& vec2, float t)
+{
+	// Clamp t between 0 and 1 to prevent extrapolation
+	t = std::max(0.0f, std::min(1.0f, t));
+	return Vector3(
+		vec1.m_x + (vec2.m_x - vec1.m_x) * t,
+		vec1.m_y + (vec2.m_y - vec1.m_y) * t,
+		vec1.m_z + (vec2.m_z - vec1.m_z) * t
+	);
+}
+
+constexpr float& LibMath::Vector3::operator[](int n)
+{
+	if (n == 0)
+	{
+		return m_x;
+	}
+
+	if (n == 1)
+	{
+		return m_y;
+	}
+
+	if (n == 2)
+	{
+		return m_z;
+	}
+
+	throw(std::out_of_range("Error: index out of range"));
+}
+
+constexpr float LibMath::Vector3::operator[](int n) const
+{
+	if (n == 0)
+	{
+		return m_x;
+	}
+
+	if (n == 1)
+	{
+		return m_y;
+	}
+
+	if (n == 2)
+	{
+		return m_z;
+	}
+
+	throw(std::out_of_range("Error: index out of range"));
+}
+
+constexpr LibMath::Vector3 LibMath::Vector3::cross(Vector3 const& vec) const
+{
+	float x = (m_y * vec.m_z) - (m_z * vec.m_y);
+	float y = -((m_x * vec.m_z) - (m_z * vec.m_x));
+	float z = (m_x * vec.m_y) - (m_y * vec.m_x);
+
+	return Vector3(x, y, z);
+}
+
+inline float LibMath::Vector3::distanceFrom(Vector3 const& vec) const
+{
+	return std::sqrt(distanceSquaredFrom(vec));
+}
+
+constexpr float LibMath::Vector3::distanceSquaredFrom(Vector3 const& vec) const
+{
+	float x_comp = vec.m_x - m_x;
+	float y_comp = vec.m_y - m_y;
+	float z_comp = vec.m_z - m_z;
+
+	return x_comp * x_comp + y_comp * y_comp + z_comp * z_comp;
+}
+
+inline float LibMath::Vector3::distance2DFrom(Vector3 const& vec) const
+{
+	return std::sqrt(distance2DSquaredFrom(vec));
+}
+
+constexpr float LibMath::Vector3::distance2DSquaredFrom(Vector3 const& vec) const
+{
+	float x_comp = vec.m_x - m_x;
+	float y_comp = vec.m_y - m_y;
+
+	return x_comp * x_comp + y_comp * y_comp;
+}
+
+constexpr float LibMath::Vector3::dot(Vector3 const& vec) const
+{
+	float x_comp = m_x * vec.m_x;
+	float y_comp = m_y * vec.m_y;
+	float z_comp = m_z * vec.m_z;
+
+	return x_comp + y_comp + z_comp;
+}
+
+inline float LibMath::Vector3::magnitude(void) const
+{
+	return std::sqrt(magnitudeSquared());
+}
+
+constexpr float LibMath::Vector3::magnitudeSquared(void) const
+{
+	return m_x * m_x + m_y * m_y + m_z * m_z;
+}
+
+inline void LibMath::Vector3::normalize(void)
+{
+	float mag = magnitude();
+
+	// Avoid division by zero
+
+	if (mag == 0.f)
+	{
+		throw(std::invalid_argument("Error: Can not normalize vector of Magnitude zero"));
+	}
+
+	if (mag == 1)
+	{
+		return;
+	}
+	m_x /= mag;
+	m_y /= mag;
+	m_z /= mag;
+}
+
+constexpr void LibMath::Vector3::scale(Vector3 const& vec)
+{
+	m_x *= vec.m_x;
+	m_y *= vec.m_y;
+	m_z *= vec.m_z;
+}
+
+constexpr void LibMath::Vector3::translate(Vector3 const& vec)
+{
+	m_x += vec.m_x;
+	m_y += vec.m_y;
+	m_z += vec.m_z;
+}
+
+constexpr bool LibMath::operator==(Vector3 const& vec1, Vector3 const& vec2)
+{
+	return (vec1.m_x == vec2.m_x && vec1.m_y == vec2.m_y && vec1.m_z == vec2.m_z);
+}
+
+constexpr bool LibMath::operator!=(Vector3 const& vec1, Vector3 const& vec2)
+{
+	return (vec1.m_x != vec2.m_x || vec1.m_y != vec2.m_y || vec1.m_z != vec2.m_z);
+}
+
+constexpr LibMath::Vector3 LibMath::operator-(Vector3 vec)
+{
+	return Vector3(-vec.m_x, -vec.m_y, -vec.m_z);
+}
+
+constexpr LibMath::Vector3 LibMath::operator+(Vector3 vec1, Vector3 const& vec2)
+{
+	return Vector3(vec1.m_x + vec2.m_x, vec1.m_y + vec2.m_y, vec1.m_z + vec2.m_z);
+}
+
+constexpr LibMath::Vector3 LibMath::operator-(Vector3 vec1, Vector3 const& vec2)
+{
+	return Vector3(vec1.m_x - vec2.m_x, vec1.m_y - vec2.m_y, vec1.m_z - vec2.m_z);
+}
+
+constexpr LibMath::Vector3 LibMath::operator*(Vector3 vec1, Vector3 const& vec2)
+{
+	return Vector3(vec1.m_x * vec2.m_x, vec1.m_y * vec2.m_y, vec1.m_z * vec2.m_z);
+}
+
+constexpr LibMath::Vector3 LibMath::operator*(Vector3 vec, float val)
+{
+	return Vector3(vec.m_x * val, vec.m_y * val, vec.m_z * val);
+}
+
+constexpr LibMath::Vector3 LibMath::operator/(Vector3 vec1, Vector3 const& vec2)
+{
+	return Vector3(vec1.m_x / vec2.m_x, vec1.m_y / vec2.m_y, vec1.m_z / vec2.m_z);
+}
+
+constexpr LibMath::Vector3 LibMath::operator/(Vector3 vec, float val)
+{
+	if (val == 0)
+	{
+		throw(std::invalid_argument("Division by zero"));
+	}
+	return Vector3(vec.m_x / val, vec.m_y / val, vec.m_z / val);
+}
+
+constexpr LibMath::Vector3& LibMath::operator+=(Vector3& vec1, Vector3 const& vec2)
+{
+	vec1.m_x += vec2.m_x;
+	vec1.m_y += vec2.m_y;
+	vec1.m_z += vec2.m_z;
+
+	return vec1;
+}
+
+constexpr LibMath::Vector3& LibMath::operator-=(Vector3& vec1, Vector3 const& vec2)
+{
+	vec1.m_x -= vec2.m_x;
+	vec1.m_y -= vec2.m_y;
+	vec1.m_z -= vec2.m_z;
+
+	return vec1;
+}
+
+constexpr LibMath::Vector3& LibMath::operator*=(Vector3& vec1, Vector3 const& vec2)
+{
+	vec1.m_x *= vec2.m_x;
+	vec1.m_y *= vec2.m_y;
+	vec1.m_z *= vec2.m_z;
+
+	return vec1;
+}
+
+constexpr LibMath::Vector3& LibMath::operator*=(Vector3& vec, float val)
+{
+	vec.m_x *= val;
+	vec.m_y *= val;
+	vec.m_z *= val;
+
+	return vec;
+}
+
+constexpr LibMath::Vector3& LibMath::operator/=(Vector3& vec1, Vector3 const& vec2)
+{
+	if (vec2.m_x == 0.f || vec2.m_y == 0.f || vec2.m_z == 0.f)
+	{
+		throw std::runtime_error("Error: Division by zero. \n x, y or z component is zero");
+	}
+
+	vec1.m_x /= vec2.m_x;
+	vec1.m_y /= vec2.m_y;
+	vec1.m_z /= vec2.m_z;
+
+	return vec1;
+}
+
+constexpr LibMath::Vector3& LibMath::operator/=(Vector3& vec, float val)
+{
+	if (val == 0.f)
+	{
+		throw std::runtime_error("Error: Division by zero");
+	}
+
+	vec.m_x /= val;
+	vec.m_y /= val;
+	vec.m_z /= val;
+
+	return vec;
+}
+
+#endif // !LIBMATH_VECTOR_VECTOR3_INL_
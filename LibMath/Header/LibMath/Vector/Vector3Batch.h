@@ -0,0 +1,63 @@
+#ifndef LIBMATH_VECTOR_VECTOR3BATCH_H_
+#define LIBMATH_VECTOR_VECTOR3BATCH_H_
+
+#include <span>
+
+#include "LibMath/Vector/Vector3.h"
+
+namespace LibMath
+{
+	/*
+	* Structure of arrays storage for many Vector3, the x, y and z components live in separate arrays
+	* Each array is 64 byte aligned and padded to a multiple of 16 lanes so the kernels never need a scalar tail
+	* Results may alias an operand, the bulk operations resize the result batch when needed
+	*/
+	class Vector3Batch
+	{
+	public:
+							Vector3Batch() = default;
+		explicit			Vector3Batch(size_t const count);							// count zero vectors
+		explicit			Vector3Batch(std::span<Vector3 const> vectors);				// copy of the vectors
+							Vector3Batch(Vector3Batch const& other);
+							Vector3Batch(Vector3Batch&& other) noexcept;
+							~Vector3Batch();
+
+		Vector3Batch&		operator=(Vector3Batch const& other);
+		Vector3Batch&		operator=(Vector3Batch&& other) noexcept;
+
+		size_t				size(void) const;
+		void				resize(size_t const count);									// new vectors are set to zero
+
+		Vector3				get(size_t const index) const;								// throw std::out_of_range
+		void				set(size_t const index, Vector3 const& vec);				// throw std::out_of_range
+
+		std::span<float>		x(void);
+		std::span<float const>	x(void) const;
+		std::span<float>		y(void);
+		std::span<float const>	y(void) const;
+		std::span<float>		z(void);
+		std::span<float const>	z(void) const;
+
+		void				load(std::span<Vector3 const> vectors);						// resize to the span and convert AoS -> SoA
+		void				store(std::span<Vector3> vectors) const;					// convert SoA -> AoS, the span must hold size() vectors
+
+		static void			add(Vector3Batch const& lhs, Vector3Batch const& rhs, Vector3Batch& result);
+		static void			subtract(Vector3Batch const& lhs, Vector3Batch const& rhs, Vector3Batch& result);
+		static void			scale(Vector3Batch const& batch, float const factor, Vector3Batch& result);
+		static void			cross(Vector3Batch const& lhs, Vector3Batch const& rhs, Vector3Batch& result);
+		static void			lerp(Vector3Batch const& from, Vector3Batch const& to, float t, Vector3Batch& result);	// t is clamped like Vector3::lerp
+		static void			normalize(Vector3Batch& batch);								// zero vectors are left to zero instead of throwing
+
+		static void			dot(Vector3Batch const& lhs, Vector3Batch const& rhs, std::span<float> result);		// result must hold size() values
+		static void			length(Vector3Batch const& batch, std::span<float> result);							// result must hold size() values
+
+	private:
+		void				reserve(size_t const count);
+
+		float*				m_data = nullptr;			// x lanes, then y lanes, then z lanes
+		size_t				m_size = 0;
+		size_t				m_stride = 0;				// lanes allocated per component
+	};
+}
+
+#endif // !LIBMATH_VECTOR_VECTOR3BATCH_H_
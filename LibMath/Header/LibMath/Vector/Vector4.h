@@ -1,37 +1,41 @@
 #ifndef LIBMATH_VECTOR_VECTOR4_H_
 #define LIBMATH_VECTOR_VECTOR4_H_
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
 #include "LibMath/LibMathFwd.h"
 #include "LibMath/Vector/Vector3.h"
 
 namespace LibMath
 {
-	class Vector4
+	class alignas(16) Vector4						// aligned so the matrix kernels can load it in a single register
 	{
 	public:
 							Vector4() = default;
-		explicit			Vector4(float val);
-							Vector4(float x, float y, float z, float k);
-							Vector4(Vector4 const& other);
-							Vector4(LibMath::Vector3 const& vec3, const float& val = 1.0);
+		constexpr explicit	Vector4(float val);
+		constexpr			Vector4(float x, float y, float z, float k);
+		constexpr			Vector4(Vector4 const& other);
+		constexpr			Vector4(LibMath::Vector3 const& vec3, const float& val = 1.0);
 
 		operator			LibMath::Vector3() const;
 
 		Vector4&			operator=(Vector4 const& other) = default;
 
-		Vector4				lerp(Vector4 const& vec1, Vector4 const& vec2, float t);
+		constexpr Vector4	lerp(Vector4 const& vec1, Vector4 const& vec2, float t);
 
-		float&				operator[](int n);								
-		float				operator[](int n) const;
+		constexpr float&	operator[](int n);
+		constexpr float		operator[](int n) const;
 
 		bool				isUnit(void) const;
 
-		float				dotProduct(Vector4 const& vec);
+		constexpr float		dotProduct(Vector4 const& vec);
 
 		float				magnitude(void) const;
-		float				magnitudeSquare(void) const;
+		constexpr float		magnitudeSquare(void) const;
 
-		void				homogenize(void);
+		constexpr void		homogenize(void);
 
 
 		float m_x = 0.0f;
@@ -42,18 +46,20 @@ namespace LibMath
 		
 	};
 
-	bool				operator==(Vector4 const& vec1, Vector4 const& vec2);
+	constexpr bool		operator==(Vector4 const& vec1, Vector4 const& vec2);
 
-	Vector4				operator-(Vector4 vec);
+	constexpr Vector4	operator-(Vector4 vec);
 
-	Vector4				operator+(Vector4 vec1, Vector4 vec2);
-	Vector4				operator-(Vector4 vec1, Vector4 vec2);
-	Vector4				operator*(Vector4 vec, float val);
-	Vector4				operator/(Vector4 vec, float val);
+	constexpr Vector4	operator+(Vector4 vec1, Vector4 vec2);
+	constexpr Vector4	operator-(Vector4 vec1, Vector4 vec2);
+	constexpr Vector4	operator*(Vector4 vec, float val);
+	constexpr Vector4	operator/(Vector4 vec, float val);
 
 
 }
 
+#include "LibMath/Vector/Vector4.inl"
+
 
 
 #endif // !LIBMATH_VECTOR_VECTOR4_H_
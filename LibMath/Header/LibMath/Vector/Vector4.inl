@@ -0,0 +1,150 @@
+#ifndef LIBMATH_VECTOR_VECTOR4_INL_
+#define LIBMATH_VECTOR_VECTOR4_INL_
+
+// Inline definitions of the trivial Vector4 operations, included at the end of Vector4.h
+
+constexpr LibMath::Vector4::Vector4(float val)
+	: m_x(val), m_y(val), m_z(val), m_w(val)
+{
+}
+
+constexpr LibMath::Vector4::Vector4(float x, float y, float z, float k)
+	: m_x(x), m_y(y), m_z(z), m_w(k)
+{
+}
+
+constexpr LibMath::Vector4::Vector4(Vector4 const& other)
+	: m_x(other.m_x), m_y(other.m_y), m_z(other.m_z), m_w(other.m_w)
+{
+}
+
+constexpr LibMath::Vector4::Vector4(LibMath::Vector3 const& vec3, const float& val)
+	: m_x(vec3.m_x), m_y(vec3.m_y), m_z(vec3.m_z), m_w(val)
+{
+}
+
+constexpr LibMath::Vector4 LibMath::Vector4::lerp(Vector4 const& vec1, Vector4 const& vec2, float t)
+{
+	// Clamp t between 0 and 1 to prevent extrapolation
+	t = std::max(0.0f, std::min(1.0f, t));
+	return Vector4(
+		vec1.m_x + (vec2.m_x - vec1.m_x) * t,
+		vec1.m_y + (vec2.m_y - vec1.m_y) * t,
+		vec1.m_z + (vec2.m_z - vec1.m_z) * t,
+		vec1.m_w + (vec2.m_w - vec1.m_w) * t
+	);
+}
+
+constexpr float& LibMath::Vector4::operator[](int n)
+{
+	if (n == 0)
+	{
+		return m_x;
+	}
+
+	if (n == 1)
+	{
+		return m_y;
+	}
+
+	if (n == 2)
+	{
+		return m_z;
+	}
+
+	if (n == 3)
+	{
+		return m_w;
+	}
+
+	throw(std::out_of_range("Error: Index out of range"));
+}
+
+constexpr float LibMath::Vector4::operator[](int n) const
+{
+	if (n == 0)
+	{
+		return m_x;
+	}
+
+	if (n == 1)
+	{
+		return m_y;
+	}
+
+	if (n == 2)
+	{
+		return m_z;
+	}
+
+	if (n == 3)
+	{
+		return m_w;
+	}
+
+	throw(std::out_of_range("Error: Index out of range"));
+}
+
+constexpr float LibMath::Vector4::dotProduct(Vector4 const& vec)
+{
+	float x_comp = m_x * vec.m_x;
+	float y_comp = m_y * vec.m_y;
+	float z_comp = m_z * vec.m_z;
+	float k_comp = m_w * vec.m_w;
+
+	return x_comp + y_comp + z_comp + k_comp;
+}
+
+inline float LibMath::Vector4::magnitude(void) const
+{
+	return std::sqrt(magnitudeSquare());
+}
+
+constexpr float LibMath::Vector4::magnitudeSquare(void) const
+{
+	return m_x * m_x + m_y * m_y + m_z * m_z + m_w * m_w;
+}
+
+constexpr void LibMath::Vector4::homogenize(void)
+{
+	m_x /= m_w;
+	m_y /= m_w;
+	m_z /= m_w;
+	m_w = 1;
+}
+
+constexpr bool LibMath::operator==(Vector4 const& vec1, Vector4 const& vec2)
+{
+	return ((vec1.m_x == vec2.m_x) && (vec1.m_y == vec2.m_y) && (vec1.m_z == vec2.m_z) && (vec1.m_w == vec2.m_w));
+}
+
+constexpr LibMath::Vector4 LibMath::operator-(Vector4 vec)
+{
+	return Vector4(-vec.m_x, -vec.m_y, -vec.m_z, -vec.m_w);
+}
+
+constexpr LibMath::Vector4 LibMath::operator+(Vector4 vec1, Vector4 vec2)
+{
+	return Vector4(vec1.m_x + vec2.m_x, vec1.m_y + vec2.m_y, vec1.m_z + vec2.m_z, vec1.m_w + vec2.m_w);
+}
+
+constexpr LibMath::Vector4 LibMath::operator-(Vector4 vec1, Vector4 vec2)
+{
+	return Vector4(vec1.m_x - vec2.m_x, vec1.m_y - vec2.m_y, vec1.m_z - vec2.m_z, vec1.m_w - vec2.m_w);
+}
+
+constexpr LibMath::Vector4 LibMath::operator*(Vector4 vec, float val)
+{
+	return Vector4(vec.m_x * val, vec.m_y * val, vec.m_z * val, vec.m_w * val);
+}
+
+constexpr LibMath::Vector4 LibMath::operator/(Vector4 vec, float val)
+{
+	if (val == 0)
+	{
+		throw(std::invalid_argument("Error: division by zero"));
+	}
+	return Vector4(vec.m_x / val, vec.m_y / val, vec.m_z / val, vec.m_w / val);
+}
+
+#endif // !LIBMATH_VECTOR_VECTOR4_INL_
@@ -1,6 +1,7 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <LibMath/Arithmetic.h>
+#include <LibMath/Simd.h>
 
 #define EPSILON 1e-6f
 
@@ -39,15 +40,115 @@ float LibMath::wrap(float num, float range_s, float range_e)
 {
 	float range = range_e - range_s;
 
-	while (num < range_s)
-	{ // increase until in interval
+	// One range away, the usual case of an angle accumulated over a frame, a single step keeps the exact result
+	if (num < range_s)
+	{
 		num += range;
 	}
-
-	while (num >= range_e)
-	{ // decrease until in interval
+	else if (num >= range_e)
+	{
 		num -= range;
 	}
 
+	while (num < range_s || num >= range_e)
+	{
+		/*
+		* Remove every range at once, the quotient can be one off on the range boundaries
+		* Past 2^24 ranges the quotient itself is rounded and the remainder needs another pass
+		* The explicit fma rounds once whether or not the compiler contracts, so the array wrap can match it
+		*/
+		num = std::fma(-std::floor((num - range_s) / range), range, num);
+
+		if (num >= range_e)
+		{
+			num -= range;
+		}
+
+		if (num < range_s)
+		{
+			num += range;
+		}
+
+		if (num >= range_e)
+		{
+			// rounded up to the excluded end
+			num = range_s;
+		}
+	}
+
 	return num;
 }
+
+static void wrapSlow(std::span<float> nums, float range_s, float range_e)
+{
+	for (float& num : nums)
+	{
+		num = LibMath::wrap(num, range_s, range_e);
+	}
+}
+
+void LibMath::wrap(std::span<float> nums, float range_s, float range_e)
+{
+	size_t i = 0;
+
+	// Same steps as the single value wrap on every lane, without the branches, so both give the same values
+#if defined(LIBMATH_SIMD_AVX2)
+	float range = range_e - range_s;
+	__m256 start = _mm256_set1_ps(range_s);
+	__m256 end = _mm256_set1_ps(range_e);
+	__m256 width = _mm256_set1_ps(range);
+
+	for (; i + 8 <= nums.size(); i += 8)
+	{
+		__m256 lanes = _mm256_loadu_ps(nums.data() + i);
+
+		// one range away
+		__m256 stepped = _mm256_blendv_ps(lanes, _mm256_add_ps(lanes, width), _mm256_cmp_ps(lanes, start, _CMP_LT_OQ));
+		stepped = _mm256_blendv_ps(stepped, _mm256_sub_ps(lanes, width), _mm256_cmp_ps(lanes, end, _CMP_GE_OQ));
+		__m256 inside = _mm256_and_ps(_mm256_cmp_ps(stepped, start, _CMP_GE_OQ), _mm256_cmp_ps(stepped, end, _CMP_LT_OQ));
+
+		// every range at once
+		__m256 turns = _mm256_floor_ps(_mm256_div_ps(_mm256_sub_ps(stepped, start), width));
+		__m256 reduced = _mm256_fnmadd_ps(turns, width, stepped);
+		reduced = _mm256_blendv_ps(reduced, _mm256_sub_ps(reduced, width), _mm256_cmp_ps(reduced, end, _CMP_GE_OQ));
+		reduced = _mm256_blendv_ps(reduced, _mm256_add_ps(reduced, width), _mm256_cmp_ps(reduced, start, _CMP_LT_OQ));
+		reduced = _mm256_blendv_ps(reduced, start, _mm256_cmp_ps(reduced, end, _CMP_GE_OQ));
+
+		lanes = _mm256_blendv_ps(reduced, stepped, inside);
+		if (_mm256_movemask_ps(_mm256_cmp_ps(lanes, start, _CMP_LT_OQ)) != 0)
+		{
+			// values past 2^24 ranges need more than one pass
+			wrapSlow(nums.subspan(i, 8), range_s, range_e);
+			continue;
+		}
+
+		_mm256_storeu_ps(nums.data() + i, lanes);
+	}
+#elif defined(LIBMATH_SIMD_SSE41)
+	float range = range_e - range_s;
+	__m128 start = _mm_set1_ps(range_s);
+	__m128 end = _mm_set1_ps(range_e);
+	__m128 width = _mm_set1_ps(range);
+
+	for (; i + 4 <= nums.size(); i += 4)
+	{
+		__m128 lanes = _mm_loadu_ps(nums.data() + i);
+
+		// one range away
+		__m128 stepped = _mm_blendv_ps(lanes, _mm_add_ps(lanes, width), _mm_cmplt_ps(lanes, start));
+		stepped = _mm_blendv_ps(stepped, _mm_sub_ps(lanes, width), _mm_cmpge_ps(lanes, end));
+
+		__m128 outside = _mm_or_ps(_mm_cmplt_ps(stepped, start), _mm_cmpge_ps(stepped, end));
+		if (_mm_movemask_ps(outside) != 0)
+		{
+			// removing every range at once needs the fma of the single value wrap, SSE4.1 has none
+			wrapSlow(nums.subspan(i, 4), range_s, range_e);
+			continue;
+		}
+
+		_mm_storeu_ps(nums.data() + i, stepped);
+	}
+#endif
+
+	wrapSlow(nums.subspan(i), range_s, range_e);
+}
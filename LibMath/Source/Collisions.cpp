@@ -1,5 +1,10 @@
 #include "LibMath/Collisions.h"
 #include "LibMath/Arithmetic.h"
+#include "LibMath/Simd.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
 
 
 #pragma region Collisions 2D
@@ -152,12 +157,12 @@ bool LibMath::Collision2D::checkCollisionAABBLine(const Geometry2D::AABB& aabb,
 
 bool LibMath::Collision2D::checkCollisionAABBAABB(const Geometry2D::AABB& aabb1, const Geometry2D::AABB& aabb2)
 {
-	if (abs(aabb1.m_center.m_x - aabb2.m_center.m_x) > (aabb1.extentX() + aabb2.extentX()))
+	if (std::abs(aabb1.m_center.m_x - aabb2.m_center.m_x) > (aabb1.extentX() + aabb2.extentX()))
 	{
 		return false;
 	}
 
-	if (abs(aabb1.m_center.m_y - aabb2.m_center.m_y) > (aabb1.extentY() + aabb2.extentY()))
+	if (std::abs(aabb1.m_center.m_y - aabb2.m_center.m_y) > (aabb1.extentY() + aabb2.extentY()))
 	{
 		return false;
 	}
@@ -253,6 +258,89 @@ bool LibMath::Collision2D::checkCollisionCircleCircle(const Geometry2D::Circle&
 	return distance <= circle1.m_radius + circle2.m_radius;
 }
 
+namespace
+{
+	// Circle center in the frame of the box, shared by the boolean test and the manifold
+	struct CircleInOBB
+	{
+		LibMath::Vector2	m_axisX;
+		LibMath::Vector2	m_axisY;
+		LibMath::Vector2	m_local;			// circle center
+		LibMath::Vector2	m_closest;			// closest point of the box to the center
+		LibMath::Vector2	m_halfSize;
+		float				m_distanceSquared = 0.f;
+	};
+}
+
+static CircleInOBB toOBBFrame(const LibMath::Geometry2D::Circle& circle, const LibMath::Geometry2D::OBB& obb)
+{
+	CircleInOBB frame;
+
+	auto [sinR, cosR] = LibMath::sincos(obb.m_rotation);
+	frame.m_axisX = LibMath::Vector2(cosR, sinR);
+	frame.m_axisY = LibMath::Vector2(-sinR, cosR);
+	frame.m_halfSize = LibMath::Vector2(obb.m_width * .5f, obb.m_height * .5f);
+
+	LibMath::Vector2 offset(circle.m_center.m_x - obb.m_center.m_x, circle.m_center.m_y - obb.m_center.m_y);
+	frame.m_local = LibMath::Vector2(offset.dotProduct(frame.m_axisX), offset.dotProduct(frame.m_axisY));
+	frame.m_closest = LibMath::Vector2(LibMath::clamp(frame.m_local.m_x, -frame.m_halfSize.m_x, frame.m_halfSize.m_x),
+		LibMath::clamp(frame.m_local.m_y, -frame.m_halfSize.m_y, frame.m_halfSize.m_y));
+	frame.m_distanceSquared = (frame.m_local - frame.m_closest).magnitudeSquare();
+
+	return frame;
+}
+
+bool LibMath::Collision2D::checkCollisionCircleOBB(const Geometry2D::Circle& circle, const Geometry2D::OBB& obb)
+{
+	return toOBBFrame(circle, obb).m_distanceSquared <= circle.m_radius * circle.m_radius;
+}
+
+bool LibMath::Collision2D::getManifoldCircleOBB(const Geometry2D::Circle& circle, const Geometry2D::OBB& obb, Manifold& manifold)
+{
+	CircleInOBB frame = toOBBFrame(circle, obb);
+
+	if (frame.m_distanceSquared > circle.m_radius * circle.m_radius)
+	{
+		return false;
+	}
+
+	LibMath::Vector2 center(circle.m_center.m_x, circle.m_center.m_y);
+	LibMath::Vector2 normal;
+	float depth = 0.f;
+	LibMath::Vector2 boxPoint;
+
+	if (frame.m_distanceSquared > 0.f)
+	{
+		// Center outside the box, the normal goes from the center to the closest point
+		float distance = sqrtf(frame.m_distanceSquared);
+		boxPoint = LibMath::Vector2(obb.m_center.m_x, obb.m_center.m_y) + frame.m_axisX * frame.m_closest.m_x + frame.m_axisY * frame.m_closest.m_y;
+		normal = (boxPoint - center) / distance;
+		depth = circle.m_radius - distance;
+	}
+	else
+	{
+		// Center inside the box, push it out through the nearest side
+		float toSideX = frame.m_halfSize.m_x - std::abs(frame.m_local.m_x);
+		float toSideY = frame.m_halfSize.m_y - std::abs(frame.m_local.m_y);
+
+		bool alongX = toSideX <= toSideY;
+		float side = alongX ? frame.m_local.m_x : frame.m_local.m_y;
+		float toSide = alongX ? toSideX : toSideY;
+
+		normal = (alongX ? frame.m_axisX : frame.m_axisY) * (side < 0.f ? 1.f : -1.f);
+		depth = circle.m_radius + toSide;
+		boxPoint = center - normal * toSide;
+	}
+
+	manifold.m_normal = normal;
+	manifold.m_depth = depth;
+	manifold.m_points[0].m_position = (center + normal * circle.m_radius + boxPoint) * .5f;
+	manifold.m_points[0].m_depth = depth;
+	manifold.m_pointCount = 1;
+
+	return true;
+}
+
 #pragma endregion
 
 #pragma endregion
@@ -263,21 +351,22 @@ bool LibMath::Collision2D::checkCollisionCircleCircle(const Geometry2D::Circle&
 bool LibMath::Collisions3D::checkCollisionSphereSphere(const Geometry3D::Sphere& sphere1, const Geometry3D::Sphere& sphere2)
 {
 	// Distance between the center of the two sphere
-	float distance_sq = powf(sphere1.m_center.m_x - sphere2.m_center.m_x, 2) +
-		powf(sphere1.m_center.m_y - sphere2.m_center.m_y, 2) +
-		powf(sphere1.m_center.m_z - sphere2.m_center.m_z, 2);
+	float distanceX = sphere1.m_center.m_x - sphere2.m_center.m_x;
+	float distanceY = sphere1.m_center.m_y - sphere2.m_center.m_y;
+	float distanceZ = sphere1.m_center.m_z - sphere2.m_center.m_z;
+	float radiusSum = sphere1.m_radius + sphere2.m_radius;
 
 	// Check if the distance is less than the sum of the radius of the two spheres
-
-	return distance_sq <= powf(sphere1.m_radius + sphere2.m_radius, 2);
+	return distanceX * distanceX + distanceY * distanceY + distanceZ * distanceZ <= radiusSum * radiusSum;
 }
 
 bool LibMath::Collisions3D::checkCollisionSpherePoint(const Geometry3D::Sphere& sphere, const Geometry3D::Point& point)
 {
 	// Distance between the center of the sphere and the point
-	float distance_sq = powf(sphere.m_center.m_x - point.m_x, 2) +
-		powf(sphere.m_center.m_y - point.m_y, 2) +
-		powf(sphere.m_center.m_z - point.m_z, 2);
+	float distanceX = sphere.m_center.m_x - point.m_x;
+	float distanceY = sphere.m_center.m_y - point.m_y;
+	float distanceZ = sphere.m_center.m_z - point.m_z;
+	float distance_sq = distanceX * distanceX + distanceY * distanceY + distanceZ * distanceZ;
 
 	// Check if the distance is less than the radius of the sphere
 	return distance_sq <= sphere.m_radius * sphere.m_radius;
@@ -396,6 +485,61 @@ bool LibMath::Collisions3D::checkCollisionPlanPoint(const Geometry3D::Plan& plan
 
 #pragma region Capsule Collision 3D
 
+/*
+* Parameters s and t of the closest points A1 + axis1 * s and A2 + axis2 * t of 2 segments, both clamped to [0, 1]
+* Degenerate segments are points, parallel ones take s = 0 (Real-Time Collision Detection 5.1.9)
+*/
+static void getClosestSegmentParameters(const LibMath::Vector3& pointA1, const LibMath::Vector3& axis1,
+	const LibMath::Vector3& pointA2, const LibMath::Vector3& axis2, float& s, float& t)
+{
+	float constexpr epsilon = 1e-12f;
+
+	LibMath::Vector3 offset = pointA1 - pointA2;
+	float lengthSquared1 = axis1.dot(axis1);
+	float lengthSquared2 = axis2.dot(axis2);
+	float projection2 = axis2.dot(offset);
+
+	if (lengthSquared1 <= epsilon && lengthSquared2 <= epsilon)
+	{
+		s = t = 0.f;
+		return;
+	}
+
+	if (lengthSquared1 <= epsilon)
+	{
+		s = 0.f;
+		t = LibMath::clamp(projection2 / lengthSquared2, 0.f, 1.f);
+		return;
+	}
+
+	float projection1 = axis1.dot(offset);
+
+	if (lengthSquared2 <= epsilon)
+	{
+		t = 0.f;
+		s = LibMath::clamp(-projection1 / lengthSquared1, 0.f, 1.f);
+		return;
+	}
+
+	float cross = axis1.dot(axis2);
+	float denominator = lengthSquared1 * lengthSquared2 - cross * cross;
+
+	s = denominator > 0.f ? LibMath::clamp((cross * projection2 - projection1 * lengthSquared2) / denominator, 0.f, 1.f) : 0.f;
+	t = (cross * s + projection2) / lengthSquared2;
+
+	// Past an end of the second segment, clamp t and recompute s for that end
+	if (t < 0.f)
+	{
+		t = 0.f;
+		s = LibMath::clamp(-projection1 / lengthSquared1, 0.f, 1.f);
+	}
+	else if (t > 1.f)
+	{
+		t = 1.f;
+		s = LibMath::clamp((cross - projection1) / lengthSquared1, 0.f, 1.f);
+	}
+}
+
 bool LibMath::Collisions3D::checkCollisionCapsulePoint(const Geometry3D::Capsule& capsule, const Geometry3D::Point& point)
 {
 	// Calculate the vector from point A to point B of the capsule's central axis
@@ -516,75 +660,19 @@ bool LibMath::Collisions3D::checkCollisionCapsuleAABB(const Geometry3D::Capsule&
 
 bool LibMath::Collisions3D::checkCollisionCapsuleCapsule(const Geometry3D::Capsule& capsule1, const Geometry3D::Capsule& capsule2)
 {
-	// First check: Test if capsule endpoints are inside the other capsule's cylindrical body
-	// This catches cases where one capsule penetrates the side of another
-	if (checkCollisionCapsulePoint(capsule1, capsule2.m_pointA) || checkCollisionCapsulePoint(capsule1, capsule2.m_pointB) ||
-		checkCollisionCapsulePoint(capsule2, capsule1.m_pointA) || checkCollisionCapsulePoint(capsule2, capsule1.m_pointB))
-	{
-		return true;
-	}
-
-	// Second check: Test collision between the spherical end caps
-	// Create spheres at each capsule endpoint with the capsule's radius
-	Geometry3D::Sphere firstEndCapSphere1(capsule1.m_pointA, capsule1.m_radius);
-	Geometry3D::Sphere secondEndCapSphere1(capsule1.m_pointB, capsule1.m_radius);
-	Geometry3D::Sphere firstEndCapSphere2(capsule2.m_pointA, capsule2.m_radius);
-	Geometry3D::Sphere secondEndCapSphere2(capsule2.m_pointB, capsule2.m_radius);
-
-	// Test all combinations of end cap sphere collisions
-	if (checkCollisionSphereSphere(firstEndCapSphere1, firstEndCapSphere2) ||
-		checkCollisionSphereSphere(firstEndCapSphere1, secondEndCapSphere2) ||
-		checkCollisionSphereSphere(secondEndCapSphere1, firstEndCapSphere2) ||
-		checkCollisionSphereSphere(secondEndCapSphere1, secondEndCapSphere2))
-	{
-		return true;
-	}
-
-	// Third check: Calculate minimum distance between the central line segments
-	// This is the core collision test - handles cases where capsules cross or run parallel
-
-	// Get the direction vectors (axes) of both capsules
 	Vector3 axis1 = capsule1.m_pointB.toVector3() - capsule1.m_pointA.toVector3();
 	Vector3 axis2 = capsule2.m_pointB.toVector3() - capsule2.m_pointA.toVector3();
-	Vector3 w = capsule1.m_pointA.toVector3() - capsule2.m_pointA.toVector3();
-
-	// Compute dot products for the closest point algorithm
-	float a = axis1.dot(axis1);  // Length squared of axis1
-	float b = axis1.dot(axis2);  // Dot product of both axes (measures parallelism)
-	float c = axis2.dot(axis2);  // Length squared of axis2
-	float d = axis1.dot(w);      // Projection of offset vector onto axis1
-	float e = axis2.dot(w);      // Projection of offset vector onto axis2
-
-	float denominator = a * c - b * b;  // Determinant
-	float s, t;  // Parameters for closest points on each line segment
-
-	// Handle parallel or nearly parallel segments
-	if (denominator < 1e-6f)
-	{
-		s = 0.0f;  // Use start of first segment
-		t = (b > c ? d / b : e / c);  // Find closest point on second segment
-	}
-	else
-	{
-		// Segments are not parallel - solve for closest approach points
-		s = (b * e - c * d) / denominator;
-		t = (a * e - b * d) / denominator;
-	}
 
-	// Clamp parameters to [0,1] to ensure points lie on the finite line segments
-	s = LibMath::clamp(s, 0.0f, 1.0f);
-	t = LibMath::clamp(t, 0.0f, 1.0f);
+	// Minimum distance between the central segments, the end caps and the crossing cases included
+	float s, t;
+	getClosestSegmentParameters(capsule1.m_pointA.toVector3(), axis1, capsule2.m_pointA.toVector3(), axis2, s, t);
 
-	// Calculate the actual closest points on both capsule axes
 	Vector3 closestPoint1 = capsule1.m_pointA.toVector3() + axis1 * s;
 	Vector3 closestPoint2 = capsule2.m_pointA.toVector3() + axis2 * t;
 
-	// Measure distance between the closest points
-	float distance = (closestPoint1 - closestPoint2).magnitude();
-
 	// Collision occurs if the distance is within the combined radii of both capsules
-	return distance <= (capsule1.m_radius + capsule2.m_radius);
-
+	float radius = capsule1.m_radius + capsule2.m_radius;
+	return (closestPoint1 - closestPoint2).magnitudeSquared() <= radius * radius;
 }
 
 bool LibMath::Collisions3D::checkCollisionCapsulePlan(const Geometry3D::Capsule& capsule, const Geometry3D::Plan& plan)
@@ -698,13 +786,20 @@ bool LibMath::Collisions3D::checkCollisionAABBLine(const Geometry3D::AABB& aabb,
 
 bool LibMath::Collisions3D::checkCollisionAABBAABB(const Geometry3D::AABB& aabb1, const Geometry3D::AABB& aabb2)
 {
+	float extentX1 = aabb1.extentX();
+	float extentY1 = aabb1.extentY();
+	float extentZ1 = aabb1.extentZ();
+	float extentX2 = aabb2.extentX();
+	float extentY2 = aabb2.extentY();
+	float extentZ2 = aabb2.extentZ();
+
 	// Check if the AABBs overlap on all axes
-	return (aabb1.m_center.m_x - aabb1.extentX() <= aabb2.m_center.m_x + aabb2.extentX() &&
-		aabb1.m_center.m_x + aabb1.extentX() >= aabb2.m_center.m_x - aabb2.extentX() &&
-		aabb1.m_center.m_y - aabb1.extentY() <= aabb2.m_center.m_y + aabb2.extentY() &&
-		aabb1.m_center.m_y + aabb1.extentY() >= aabb2.m_center.m_y - aabb2.extentY() &&
-		aabb1.m_center.m_z - aabb1.extentZ() <= aabb2.m_center.m_z + aabb2.extentZ() &&
-		aabb1.m_center.m_z + aabb1.extentZ() >= aabb2.m_center.m_z - aabb2.extentZ());
+	return (aabb1.m_center.m_x - extentX1 <= aabb2.m_center.m_x + extentX2 &&
+		aabb1.m_center.m_x + extentX1 >= aabb2.m_center.m_x - extentX2 &&
+		aabb1.m_center.m_y - extentY1 <= aabb2.m_center.m_y + extentY2 &&
+		aabb1.m_center.m_y + extentY1 >= aabb2.m_center.m_y - extentY2 &&
+		aabb1.m_center.m_z - extentZ1 <= aabb2.m_center.m_z + extentZ2 &&
+		aabb1.m_center.m_z + extentZ1 >= aabb2.m_center.m_z - extentZ2);
 }
 
 bool LibMath::Collisions3D::checkCollisionAABBPoint(const Geometry3D::AABB& aabb, const Geometry3D::Point& point)
@@ -731,4 +826,728 @@ bool LibMath::Collisions3D::checkCollisionAABBShpere(const Geometry3D::AABB& aab
 
 #pragma endregion 
 
+#pragma region OBB Collision 3D
+
+namespace
+{
+	// An OBB reduced to what the tests need, an AABB is the same box on the world axes
+	struct OrientedBox
+	{
+		LibMath::Vector3	m_center;
+		LibMath::Vector3	m_axes[3];					// unit local axes in world space
+		float				m_halfSize[3] = { 0.f, 0.f, 0.f };
+	};
+}
+
+static OrientedBox toOrientedBox(const LibMath::Geometry3D::OBB& obb)
+{
+	OrientedBox box;
+	box.m_center = obb.m_center.toVector3();
+	obb.getAxes(box.m_axes[0], box.m_axes[1], box.m_axes[2]);
+
+	box.m_halfSize[0] = obb.m_width * 0.5f;
+	box.m_halfSize[1] = obb.m_height * 0.5f;
+	box.m_halfSize[2] = obb.m_depth * 0.5f;
+
+	return box;
+}
+
+static OrientedBox toOrientedBox(const LibMath::Geometry3D::AABB& aabb)
+{
+	OrientedBox box;
+	box.m_center = aabb.m_center.toVector3();
+
+	box.m_axes[0] = LibMath::Vector3(1.f, 0.f, 0.f);
+	box.m_axes[1] = LibMath::Vector3(0.f, 1.f, 0.f);
+	box.m_axes[2] = LibMath::Vector3(0.f, 0.f, 1.f);
+
+	box.m_halfSize[0] = aabb.extentX();
+	box.m_halfSize[1] = aabb.extentY();
+	box.m_halfSize[2] = aabb.extentZ();
+
+	return box;
+}
+
+static LibMath::Vector3 toLocal(const OrientedBox& box, const LibMath::Vector3& point)
+{
+	// The transposed rotation, the box becomes an AABB centered on the origin
+	LibMath::Vector3 offset = point - box.m_center;
+
+	return LibMath::Vector3(offset.dot(box.m_axes[0]), offset.dot(box.m_axes[1]), offset.dot(box.m_axes[2]));
+}
+
+static bool checkSeparatingAxes(const OrientedBox& box1, const OrientedBox& box2)
+{
+	/*
+		Separating axis test (Ericson, Real-Time Collision Detection 4.4.1)
+		The boxes are disjoint when their projections on one of these 15 axes do not overlap:
+			- the 3 face normals of box1, then the 3 of box2, they separate most of the disjoint pairs
+			- the 9 cross products of an edge of box1 with an edge of box2, only reached by boxes close to each other
+		Everything is expressed in the frame of box1
+	*/
+	const float EPSILON = 1e-6f;
+
+	// rotation[i][j] = box1 axis i . box2 axis j
+	float rotation[3][3];
+
+	// The epsilon keeps the cross product of 2 parallel edges (a near zero axis) from reporting a separation
+	float absRotation[3][3];
+
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j)
+		{
+			rotation[i][j] = box1.m_axes[i].dot(box2.m_axes[j]);
+			absRotation[i][j] = std::abs(rotation[i][j]) + EPSILON;
+		}
+	}
+
+	LibMath::Vector3 offset = box2.m_center - box1.m_center;
+	float translation[3] = { offset.dot(box1.m_axes[0]), offset.dot(box1.m_axes[1]), offset.dot(box1.m_axes[2]) };
+
+	const float* halfSize1 = box1.m_halfSize;
+	const float* halfSize2 = box2.m_halfSize;
+
+	// Face normals of box1
+	for (int i = 0; i < 3; ++i)
+	{
+		float radius2 = halfSize2[0] * absRotation[i][0] + halfSize2[1] * absRotation[i][1] + halfSize2[2] * absRotation[i][2];
+
+		if (std::abs(translation[i]) > halfSize1[i] + radius2)
+			return false;
+	}
+
+	// Face normals of box2
+	for (int j = 0; j < 3; ++j)
+	{
+		float radius1 = halfSize1[0] * absRotation[0][j] + halfSize1[1] * absRotation[1][j] + halfSize1[2] * absRotation[2][j];
+		float distance = translation[0] * rotation[0][j] + translation[1] * rotation[1][j] + translation[2] * rotation[2][j];
+
+		if (std::abs(distance) > radius1 + halfSize2[j])
+			return false;
+	}
+
+	// Edge of box1 (axis i) cross edge of box2 (axis j)
+	for (int i = 0; i < 3; ++i)
+	{
+		int i1 = (i + 1) % 3;
+		int i2 = (i + 2) % 3;
+
+		for (int j = 0; j < 3; ++j)
+		{
+			int j1 = (j + 1) % 3;
+			int j2 = (j + 2) % 3;
+
+			float radius1 = halfSize1[i1] * absRotation[i2][j] + halfSize1[i2] * absRotation[i1][j];
+			float radius2 = halfSize2[j1] * absRotation[i][j2] + halfSize2[j2] * absRotation[i][j1];
+			float distance = translation[i2] * rotation[i1][j] - translation[i1] * rotation[i2][j];
+
+			if (std::abs(distance) > radius1 + radius2)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+bool LibMath::Collisions3D::checkCollisionOBBOBB(const Geometry3D::OBB& obb1, const Geometry3D::OBB& obb2)
+{
+	return checkSeparatingAxes(toOrientedBox(obb1), toOrientedBox(obb2));
+}
+
+bool LibMath::Collisions3D::checkCollisionOBBAABB(const Geometry3D::OBB& obb, const Geometry3D::AABB& aabb)
+{
+	return checkSeparatingAxes(toOrientedBox(obb), toOrientedBox(aabb));
+}
+
+bool LibMath::Collisions3D::checkCollisionOBBSphere(const Geometry3D::OBB& obb, const Geometry3D::Sphere& sphere)
+{
+	OrientedBox box = toOrientedBox(obb);
+	LibMath::Vector3 center = toLocal(box, sphere.m_center.toVector3());
+
+	// Distance from the center to the closest point of the box
+	float distanceSquared = 0.f;
+	for (int i = 0; i < 3; ++i)
+	{
+		float outside = std::abs(center[i]) - box.m_halfSize[i];
+
+		if (outside > 0.f)
+			distanceSquared += outside * outside;
+	}
+
+	return distanceSquared <= sphere.m_radius * sphere.m_radius;
+}
+
+bool LibMath::Collisions3D::checkCollisionOBBCapsule(const Geometry3D::OBB& obb, const Geometry3D::Capsule& capsule)
+{
+	// Same test as checkCollisionCapsuleAABB once the capsule is in the box frame
+	OrientedBox box = toOrientedBox(obb);
+
+	Geometry3D::Capsule localCapsule(toLocal(box, capsule.m_pointA.toVector3()), toLocal(box, capsule.m_pointB.toVector3()), capsule.m_radius);
+	Geometry3D::AABB localBox(Geometry3D::Point(0.f, 0.f, 0.f), obb.m_width, obb.m_height, obb.m_depth);
+
+	return checkCollisionCapsuleAABB(localCapsule, localBox);
+}
+
+bool LibMath::Collisions3D::checkCollisionOBBLine(const Geometry3D::OBB& obb, const Geometry3D::Line& line)
+{
+	OrientedBox box = toOrientedBox(obb);
+
+	// The direction turns with the box but keeps its length
+	Geometry3D::Line localLine;
+	localLine.m_origin = toLocal(box, line.m_origin.toVector3());
+	localLine.m_direction = LibMath::Vector3(line.m_direction.dot(box.m_axes[0]), line.m_direction.dot(box.m_axes[1]), line.m_direction.dot(box.m_axes[2]));
+	localLine.m_length = line.m_length;
+
+	Geometry3D::AABB localBox(Geometry3D::Point(0.f, 0.f, 0.f), obb.m_width, obb.m_height, obb.m_depth);
+
+	return checkCollisionAABBLine(localBox, localLine);
+}
+
+bool LibMath::Collisions3D::checkCollisionOBBPoint(const Geometry3D::OBB& obb, const Geometry3D::Point& point)
+{
+	OrientedBox box = toOrientedBox(obb);
+	LibMath::Vector3 local = toLocal(box, point.toVector3());
+
+	return std::abs(local.m_x) <= box.m_halfSize[0] &&
+		std::abs(local.m_y) <= box.m_halfSize[1] &&
+		std::abs(local.m_z) <= box.m_halfSize[2];
+}
+
+#pragma endregion
+
+#pragma region Manifold 3D
+
+// Any unit vector, the normal of shapes whose centers coincide
+static LibMath::Vector3 getFallbackNormal(const LibMath::Vector3& axis)
+{
+	// Perpendicular to the axis when there is one, so capsules lying on each other separate sideways
+	LibMath::Vector3 normal = axis.cross(std::abs(axis.m_x) < .577f ? LibMath::Vector3::right() : LibMath::Vector3::up());
+	float lengthSquared = normal.magnitudeSquared();
+
+	return lengthSquared > 0.f ? normal / sqrtf(lengthSquared) : LibMath::Vector3::up();
+}
+
+/*
+* Single contact of 2 spheres, the core of every sphere and capsule manifold
+* distanceSquared is the one the boolean test already computed
+*/
+static void setSphereContact(const LibMath::Vector3& center1, float radius1, const LibMath::Vector3& center2, float radius2,
+	float distanceSquared, const LibMath::Vector3& fallbackAxis, LibMath::Collisions3D::Manifold& manifold)
+{
+	float distance = sqrtf(distanceSquared);
+	LibMath::Vector3 normal = distance > 1e-6f ? (center2 - center1) / distance : getFallbackNormal(fallbackAxis);
+	float depth = radius1 + radius2 - distance;
+
+	manifold.m_normal = normal;
+	manifold.m_depth = depth;
+	manifold.m_points[0].m_position = center1 + normal * (radius1 - depth * .5f);
+	manifold.m_points[0].m_depth = depth;
+	manifold.m_pointCount = 1;
+}
+
+bool LibMath::Collisions3D::getManifoldSphereSphere(const Geometry3D::Sphere& sphere1, const Geometry3D::Sphere& sphere2, Manifold& manifold)
+{
+	Vector3 center1 = sphere1.m_center.toVector3();
+	Vector3 center2 = sphere2.m_center.toVector3();
+	float radius = sphere1.m_radius + sphere2.m_radius;
+	float distanceSquared = (center2 - center1).magnitudeSquared();
+
+	if (distanceSquared > radius * radius)
+	{
+		return false;
+	}
+
+	setSphereContact(center1, sphere1.m_radius, center2, sphere2.m_radius, distanceSquared, Vector3::zero(), manifold);
+	return true;
+}
+
+bool LibMath::Collisions3D::getManifoldSphereCapsule(const Geometry3D::Sphere& sphere, const Geometry3D::Capsule& capsule, Manifold& manifold)
+{
+	// Sphere against the sphere of the capsule centered on the closest point of its segment
+	Vector3 center = sphere.m_center.toVector3();
+	Vector3 closest = Geometry3D::getClosestToSegment(capsule.m_pointA, capsule.m_pointB, sphere.m_center).toVector3();
+	float radius = sphere.m_radius + capsule.m_radius;
+	float distanceSquared = (closest - center).magnitudeSquared();
+
+	if (distanceSquared > radius * radius)
+	{
+		return false;
+	}
+
+	setSphereContact(center, sphere.m_radius, closest, capsule.m_radius, distanceSquared, capsule.m_pointB.toVector3() - capsule.m_pointA.toVector3(), manifold);
+	return true;
+}
+
+bool LibMath::Collisions3D::getManifoldSphereAABB(const Geometry3D::Sphere& sphere, const Geometry3D::AABB& aabb, Manifold& manifold)
+{
+	Vector3 center = sphere.m_center.toVector3();
+	Vector3 closest = Geometry3D::getClosestToAABB(aabb, sphere.m_center).toVector3();
+	float distanceSquared = (closest - center).magnitudeSquared();
+
+	if (distanceSquared > sphere.m_radius * sphere.m_radius)
+	{
+		return false;
+	}
+
+	Vector3 normal;
+	float depth = 0.f;
+
+	if (distanceSquared > 0.f)
+	{
+		// Center outside the box, the normal goes from the center to the closest point
+		float distance = sqrtf(distanceSquared);
+		normal = (closest - center) / distance;
+		depth = sphere.m_radius - distance;
+	}
+	else
+	{
+		// Center inside the box, push it out through the nearest face
+		Vector3 offset = center - aabb.m_center.toVector3();
+		float toFace[3] = { aabb.extentX() - std::abs(offset.m_x), aabb.extentY() - std::abs(offset.m_y), aabb.extentZ() - std::abs(offset.m_z) };
+		int axis = toFace[0] <= toFace[1] ? (toFace[0] <= toFace[2] ? 0 : 2) : (toFace[1] <= toFace[2] ? 1 : 2);
+
+		normal = Vector3::zero();
+		normal[axis] = offset[axis] < 0.f ? 1.f : -1.f;
+		depth = sphere.m_radius + toFace[axis];
+		closest = center - normal * toFace[axis];
+	}
+
+	manifold.m_normal = normal;
+	manifold.m_depth = depth;
+	manifold.m_points[0].m_position = (center + normal * sphere.m_radius + closest) * .5f;
+	manifold.m_points[0].m_depth = depth;
+	manifold.m_pointCount = 1;
+
+	return true;
+}
+
+bool LibMath::Collisions3D::getManifoldCapsuleCapsule(const Geometry3D::Capsule& capsule1, const Geometry3D::Capsule& capsule2, Manifold& manifold)
+{
+	Vector3 pointA1 = capsule1.m_pointA.toVector3();
+	Vector3 pointA2 = capsule2.m_pointA.toVector3();
+	Vector3 axis1 = capsule1.m_pointB.toVector3() - pointA1;
+	Vector3 axis2 = capsule2.m_pointB.toVector3() - pointA2;
+
+	// Same closest points as checkCollisionCapsuleCapsule
+	float s, t;
+	getClosestSegmentParameters(pointA1, axis1, pointA2, axis2, s, t);
+
+	Vector3 closestPoint1 = pointA1 + axis1 * s;
+	Vector3 closestPoint2 = pointA2 + axis2 * t;
+	float radius = capsule1.m_radius + capsule2.m_radius;
+	float distanceSquared = (closestPoint2 - closestPoint1).magnitudeSquared();
+
+	if (distanceSquared > radius * radius)
+	{
+		return false;
+	}
+
+	setSphereContact(closestPoint1, capsule1.m_radius, closestPoint2, capsule2.m_radius, distanceSquared, axis1, manifold);
+
+	// Side by side (less than about 1 degree apart), a single point would let the capsules spin around it
+	float lengthSquared1 = axis1.magnitudeSquared();
+	float lengthSquared2 = axis2.magnitudeSquared();
+	float cross = axis1.dot(axis2);
+
+	if (lengthSquared1 * lengthSquared2 - cross * cross > 3e-4f * lengthSquared1 * lengthSquared2 || lengthSquared2 == 0.f)
+	{
+		return true;
+	}
+
+	// Range of the first segment facing the second one, its ends are the 2 contacts
+	float start = (pointA2 - pointA1).dot(axis1) / lengthSquared1;
+	float end = start + cross / lengthSquared1;
+	float first = std::max(std::min(start, end), 0.f);
+	float last = std::min(std::max(start, end), 1.f);
+
+	if (last - first <= 1e-4f)
+	{
+		return true;
+	}
+
+	float depth = 0.f;
+	int pointCount = 0;
+
+	for (float along : { first, last })
+	{
+		Vector3 point1 = pointA1 + axis1 * along;
+		Vector3 point2 = pointA2 + axis2 * LibMath::clamp((point1 - pointA2).dot(axis2) / lengthSquared2, 0.f, 1.f);
+		float pointDepth = radius - (point2 - point1).dot(manifold.m_normal);
+
+		if (pointDepth >= 0.f)
+		{
+			manifold.m_points[pointCount].m_position = point1 + manifold.m_normal * (capsule1.m_radius - pointDepth * .5f);
+			manifold.m_points[pointCount].m_depth = pointDepth;
+			depth = std::max(depth, pointDepth);
+			++pointCount;
+		}
+	}
+
+	if (pointCount != 0)
+	{
+		manifold.m_depth = depth;
+		manifold.m_pointCount = pointCount;
+	}
+
+	return true;
+}
+
+bool LibMath::Collisions3D::getManifoldCapsulePlan(const Geometry3D::Capsule& capsule, const Geometry3D::Plan& plan, Manifold& manifold)
+{
+	Vector3 ends[2] = { capsule.m_pointA.toVector3(), capsule.m_pointB.toVector3() };
+	float distances[2] = { ends[0].dot(plan.m_normal) + plan.m_distance, ends[1].dot(plan.m_normal) + plan.m_distance };
+
+	// The capsule is pushed back toward the side its middle is on
+	// the distance to the plan is linear along the segment, so the deepest points are the ends
+	float side = distances[0] + distances[1] >= 0.f ? 1.f : -1.f;
+	float depths[2] = { capsule.m_radius - side * distances[0], capsule.m_radius - side * distances[1] };
+
+	if (depths[0] < 0.f && depths[1] < 0.f)
+	{
+		return false;
+	}
+
+	Vector3 normal = plan.m_normal * -side;
+
+	manifold.m_normal = normal;
+	manifold.m_depth = std::max(depths[0], depths[1]);
+	manifold.m_pointCount = 0;
+
+	for (int i = 0; i < 2; ++i)
+	{
+		if (depths[i] >= 0.f)
+		{
+			// Halfway between the bottom of the capsule and its projection on the plan
+			Vector3 capsulePoint = ends[i] + normal * capsule.m_radius;
+			Vector3 planPoint = ends[i] - plan.m_normal * distances[i];
+
+			manifold.m_points[manifold.m_pointCount].m_position = (capsulePoint + planPoint) * .5f;
+			manifold.m_points[manifold.m_pointCount].m_depth = depths[i];
+			++manifold.m_pointCount;
+		}
+	}
+
+	return true;
+}
+
+bool LibMath::Collisions3D::getManifoldAABBAABB(const Geometry3D::AABB& aabb1, const Geometry3D::AABB& aabb2, Manifold& manifold)
+{
+	Vector3 center1 = aabb1.m_center.toVector3();
+	Vector3 center2 = aabb2.m_center.toVector3();
+	Vector3 extent1(aabb1.extentX(), aabb1.extentY(), aabb1.extentZ());
+	Vector3 extent2(aabb2.extentX(), aabb2.extentY(), aabb2.extentZ());
+	Vector3 offset = center2 - center1;
+
+	// Overlap on every axis, the same comparisons as checkCollisionAABBAABB
+	float overlap[3];
+	int axis = 0;
+
+	for (int i = 0; i < 3; ++i)
+	{
+		overlap[i] = extent1[i] + extent2[i] - std::abs(offset[i]);
+
+		if (overlap[i] < 0.f)
+		{
+			return false;
+		}
+
+		if (overlap[i] < overlap[axis])
+		{
+			axis = i;
+		}
+	}
+
+	float sign = offset[axis] < 0.f ? -1.f : 1.f;
+
+	manifold.m_normal = Vector3::zero();
+	manifold.m_normal[axis] = sign;
+	manifold.m_depth = overlap[axis];
+
+	// Corners of the overlap of the 2 faces, on the plane halfway between them
+	int const axisU = (axis + 1) % 3;
+	int const axisV = (axis + 2) % 3;
+	float faceMiddle = (center1[axis] + sign * extent1[axis] + center2[axis] - sign * extent2[axis]) * .5f;
+
+	float rangeU[2] = { std::max(center1[axisU] - extent1[axisU], center2[axisU] - extent2[axisU]), std::min(center1[axisU] + extent1[axisU], center2[axisU] + extent2[axisU]) };
+	float rangeV[2] = { std::max(center1[axisV] - extent1[axisV], center2[axisV] - extent2[axisV]), std::min(center1[axisV] + extent1[axisV], center2[axisV] + extent2[axisV]) };
+
+	// Boxes touching by an edge or a corner give 2 or 1 point instead of duplicates
+	int countU = rangeU[1] - rangeU[0] > 1e-6f ? 2 : 1;
+	int countV = rangeV[1] - rangeV[0] > 1e-6f ? 2 : 1;
+
+	manifold.m_pointCount = 0;
+
+	for (int u = 0; u < countU; ++u)
+	{
+		for (int v = 0; v < countV; ++v)
+		{
+			ContactPoint& contact = manifold.m_points[manifold.m_pointCount++];
+
+			contact.m_position[axis] = faceMiddle;
+			contact.m_position[axisU] = rangeU[u];
+			contact.m_position[axisV] = rangeV[v];
+			contact.m_depth = overlap[axis];
+		}
+	}
+
+	return true;
+}
+
+#pragma endregion
+
+#pragma region Batch 3D
+
+/*
+* The kernels test 8 shapes per iteration with AVX2 and 4 with SSE4.1, the scalar loop takes the tail (or everything without SIMD)
+* The lane mask of a comparison is turned into indices one set bit at a time, a miss costs no branch
+*/
+
+namespace
+{
+	size_t constexpr	c_batchBlockSize = 2048;		// shapes of the second batch kept in cache while the whole first batch is tested against them
+}
+
+template <typename Report>
+static void reportMask(unsigned mask, size_t first, Report& report)
+{
+	while (mask != 0)
+	{
+		report(static_cast<int>(first) + std::countr_zero(mask));
+		mask &= mask - 1;
+	}
+}
+
+template <typename Report>
+static void overlapSphereBatch(float centerX, float centerY, float centerZ, float radius, LibMath::Collisions3D::SphereBatch const& batch,
+	size_t begin, size_t end, Report& report)
+{
+	float const* batchX = batch.m_centers.x().data();
+	float const* batchY = batch.m_centers.y().data();
+	float const* batchZ = batch.m_centers.z().data();
+	float const* radii = batch.m_radii.data();
+
+	size_t i = begin;
+
+#if defined(LIBMATH_SIMD_AVX2)
+	__m256 x = _mm256_set1_ps(centerX);
+	__m256 y = _mm256_set1_ps(centerY);
+	__m256 z = _mm256_set1_ps(centerZ);
+	__m256 r = _mm256_set1_ps(radius);
+
+	for (; i + 8 <= end; i += 8)
+	{
+		__m256 distanceX = _mm256_sub_ps(x, _mm256_loadu_ps(batchX + i));
+		__m256 distanceY = _mm256_sub_ps(y, _mm256_loadu_ps(batchY + i));
+		__m256 distanceZ = _mm256_sub_ps(z, _mm256_loadu_ps(batchZ + i));
+		__m256 radiusSum = _mm256_add_ps(r, _mm256_loadu_ps(radii + i));
+
+		// same operations in the same order as the scalar test, -ffp-contract=off keeps the compiler from fusing either, so both agree on touching spheres
+		__m256 distanceSquared = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(distanceX, distanceX), _mm256_mul_ps(distanceY, distanceY)), _mm256_mul_ps(distanceZ, distanceZ));
+		__m256 hits = _mm256_cmp_ps(distanceSquared, _mm256_mul_ps(radiusSum, radiusSum), _CMP_LE_OQ);
+
+		reportMask(static_cast<unsigned>(_mm256_movemask_ps(hits)), i, report);
+	}
+#elif defined(LIBMATH_SIMD_SSE41)
+	__m128 x = _mm_set1_ps(centerX);
+	__m128 y = _mm_set1_ps(centerY);
+	__m128 z = _mm_set1_ps(centerZ);
+	__m128 r = _mm_set1_ps(radius);
+
+	for (; i + 4 <= end; i += 4)
+	{
+		__m128 distanceX = _mm_sub_ps(x, _mm_loadu_ps(batchX + i));
+		__m128 distanceY = _mm_sub_ps(y, _mm_loadu_ps(batchY + i));
+		__m128 distanceZ = _mm_sub_ps(z, _mm_loadu_ps(batchZ + i));
+		__m128 radiusSum = _mm_add_ps(r, _mm_loadu_ps(radii + i));
+
+		__m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(distanceX, distanceX), _mm_mul_ps(distanceY, distanceY)), _mm_mul_ps(distanceZ, distanceZ));
+		__m128 hits = _mm_cmple_ps(distanceSquared, _mm_mul_ps(radiusSum, radiusSum));
+
+		reportMask(static_cast<unsigned>(_mm_movemask_ps(hits)), i, report);
+	}
+#endif
+
+	for (; i < end; ++i)
+	{
+		float distanceX = centerX - batchX[i];
+		float distanceY = centerY - batchY[i];
+		float distanceZ = centerZ - batchZ[i];
+		float radiusSum = radius + radii[i];
+
+		if (distanceX * distanceX + distanceY * distanceY + distanceZ * distanceZ <= radiusSum * radiusSum)
+		{
+			report(static_cast<int>(i));
+		}
+	}
+}
+
+template <typename Report>
+static void overlapAABBBatch(LibMath::Vector3 const& min, LibMath::Vector3 const& max, LibMath::Collisions3D::AABBBatch const& batch,
+	size_t begin, size_t end, Report& report)
+{
+	float const* minX = batch.m_min.x().data();
+	float const* minY = batch.m_min.y().data();
+	float const* minZ = batch.m_min.z().data();
+	float const* maxX = batch.m_max.x().data();
+	float const* maxY = batch.m_max.y().data();
+	float const* maxZ = batch.m_max.z().data();
+
+	size_t i = begin;
+
+#if defined(LIBMATH_SIMD_AVX2)
+	__m256 lowX = _mm256_set1_ps(min.m_x);
+	__m256 lowY = _mm256_set1_ps(min.m_y);
+	__m256 lowZ = _mm256_set1_ps(min.m_z);
+	__m256 highX = _mm256_set1_ps(max.m_x);
+	__m256 highY = _mm256_set1_ps(max.m_y);
+	__m256 highZ = _mm256_set1_ps(max.m_z);
+
+	for (; i + 8 <= end; i += 8)
+	{
+		__m256 hitsX = _mm256_and_ps(_mm256_cmp_ps(lowX, _mm256_loadu_ps(maxX + i), _CMP_LE_OQ), _mm256_cmp_ps(highX, _mm256_loadu_ps(minX + i), _CMP_GE_OQ));
+		__m256 hitsY = _mm256_and_ps(_mm256_cmp_ps(lowY, _mm256_loadu_ps(maxY + i), _CMP_LE_OQ), _mm256_cmp_ps(highY, _mm256_loadu_ps(minY + i), _CMP_GE_OQ));
+		__m256 hitsZ = _mm256_and_ps(_mm256_cmp_ps(lowZ, _mm256_loadu_ps(maxZ + i), _CMP_LE_OQ), _mm256_cmp_ps(highZ, _mm256_loadu_ps(minZ + i), _CMP_GE_OQ));
+
+		reportMask(static_cast<unsigned>(_mm256_movemask_ps(_mm256_and_ps(hitsX, _mm256_and_ps(hitsY, hitsZ)))), i, report);
+	}
+#elif defined(LIBMATH_SIMD_SSE41)
+	__m128 lowX = _mm_set1_ps(min.m_x);
+	__m128 lowY = _mm_set1_ps(min.m_y);
+	__m128 lowZ = _mm_set1_ps(min.m_z);
+	__m128 highX = _mm_set1_ps(max.m_x);
+	__m128 highY = _mm_set1_ps(max.m_y);
+	__m128 highZ = _mm_set1_ps(max.m_z);
+
+	for (; i + 4 <= end; i += 4)
+	{
+		__m128 hitsX = _mm_and_ps(_mm_cmple_ps(lowX, _mm_loadu_ps(maxX + i)), _mm_cmpge_ps(highX, _mm_loadu_ps(minX + i)));
+		__m128 hitsY = _mm_and_ps(_mm_cmple_ps(lowY, _mm_loadu_ps(maxY + i)), _mm_cmpge_ps(highY, _mm_loadu_ps(minY + i)));
+		__m128 hitsZ = _mm_and_ps(_mm_cmple_ps(lowZ, _mm_loadu_ps(maxZ + i)), _mm_cmpge_ps(highZ, _mm_loadu_ps(minZ + i)));
+
+		reportMask(static_cast<unsigned>(_mm_movemask_ps(_mm_and_ps(hitsX, _mm_and_ps(hitsY, hitsZ)))), i, report);
+	}
+#endif
+
+	for (; i < end; ++i)
+	{
+		if (min.m_x <= maxX[i] && max.m_x >= minX[i] &&
+			min.m_y <= maxY[i] && max.m_y >= minY[i] &&
+			min.m_z <= maxZ[i] && max.m_z >= minZ[i])
+		{
+			report(static_cast<int>(i));
+		}
+	}
+}
+
+static void getBounds(LibMath::Geometry3D::AABB const& aabb, LibMath::Vector3& min, LibMath::Vector3& max)
+{
+	// same rounding as checkCollisionAABBAABB : center - extent and center + extent
+	LibMath::Vector3 center(aabb.m_center.m_x, aabb.m_center.m_y, aabb.m_center.m_z);
+	LibMath::Vector3 extent(aabb.extentX(), aabb.extentY(), aabb.extentZ());
+
+	min = center - extent;
+	max = center + extent;
+}
+
+void LibMath::Collisions3D::SphereBatch::load(std::span<Geometry3D::Sphere const> spheres)
+{
+	m_centers.resize(spheres.size());
+	m_radii.resize(spheres.size());
+
+	std::span<float> x = m_centers.x();
+	std::span<float> y = m_centers.y();
+	std::span<float> z = m_centers.z();
+
+	for (size_t i = 0; i < spheres.size(); ++i)
+	{
+		x[i] = spheres[i].m_center.m_x;
+		y[i] = spheres[i].m_center.m_y;
+		z[i] = spheres[i].m_center.m_z;
+		m_radii[i] = spheres[i].m_radius;
+	}
+}
+
+size_t LibMath::Collisions3D::SphereBatch::size(void) const
+{
+	return m_radii.size();
+}
+
+void LibMath::Collisions3D::AABBBatch::load(std::span<Geometry3D::AABB const> aabbs)
+{
+	m_min.resize(aabbs.size());
+	m_max.resize(aabbs.size());
+
+	for (size_t i = 0; i < aabbs.size(); ++i)
+	{
+		Vector3 min;
+		Vector3 max;
+		getBounds(aabbs[i], min, max);
+
+		m_min.set(i, min);
+		m_max.set(i, max);
+	}
+}
+
+size_t LibMath::Collisions3D::AABBBatch::size(void) const
+{
+	return m_min.size();
+}
+
+void LibMath::Collisions3D::checkCollisionSphereSphere(const Geometry3D::Sphere& sphere, const SphereBatch& batch, std::vector<int>& result)
+{
+	auto report = [&result](int index) { result.push_back(index); };
+
+	overlapSphereBatch(sphere.m_center.m_x, sphere.m_center.m_y, sphere.m_center.m_z, sphere.m_radius, batch, 0, batch.size(), report);
+}
+
+void LibMath::Collisions3D::checkCollisionSphereSphere(const SphereBatch& batch1, const SphereBatch& batch2, std::vector<std::pair<int, int>>& result)
+{
+	std::span<float const> x = batch1.m_centers.x();
+	std::span<float const> y = batch1.m_centers.y();
+	std::span<float const> z = batch1.m_centers.z();
+
+	for (size_t begin = 0; begin < batch2.size(); begin += c_batchBlockSize)
+	{
+		size_t end = std::min(begin + c_batchBlockSize, batch2.size());
+
+		for (size_t i = 0; i < batch1.size(); ++i)
+		{
+			int first = static_cast<int>(i);
+			auto report = [&result, first](int second) { result.emplace_back(first, second); };
+
+			overlapSphereBatch(x[i], y[i], z[i], batch1.m_radii[i], batch2, begin, end, report);
+		}
+	}
+}
+
+void LibMath::Collisions3D::checkCollisionAABBAABB(const Geometry3D::AABB& aabb, const AABBBatch& batch, std::vector<int>& result)
+{
+	Vector3 min;
+	Vector3 max;
+	getBounds(aabb, min, max);
+
+	auto report = [&result](int index) { result.push_back(index); };
+
+	overlapAABBBatch(min, max, batch, 0, batch.size(), report);
+}
+
+void LibMath::Collisions3D::checkCollisionAABBAABB(const AABBBatch& batch1, const AABBBatch& batch2, std::vector<std::pair<int, int>>& result)
+{
+	for (size_t begin = 0; begin < batch2.size(); begin += c_batchBlockSize)
+	{
+		size_t end = std::min(begin + c_batchBlockSize, batch2.size());
+
+		for (size_t i = 0; i < batch1.size(); ++i)
+		{
+			int first = static_cast<int>(i);
+			auto report = [&result, first](int second) { result.emplace_back(first, second); };
+
+			overlapAABBBatch(batch1.m_min.get(i), batch1.m_max.get(i), batch2, begin, end, report);
+		}
+	}
+}
+
+#pragma endregion
+
 #pragma endregion
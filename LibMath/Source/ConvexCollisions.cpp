@@ -0,0 +1,808 @@
+#include "LibMath/ConvexCollisions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/*
+* GJK walks a simplex (1 to 4 points of the Minkowski difference A - B) toward the origin,
+* the shapes overlap when the origin ends inside, otherwise the last closest point is their distance
+* EPA then grows the final tetrahedron into a polytope until its face closest to the origin lies on A - B
+* Both only see the cores of the round shapes (the center of a sphere, the segment of a capsule), the radii are added to their results
+*/
+
+#pragma region Shape
+
+static LibMath::Vector3 sphereCore(void const* shape, LibMath::Vector3 const&)
+{
+	return LibMath::Vector3(static_cast<LibMath::Geometry3D::Sphere const*>(shape)->m_center);
+}
+
+static LibMath::Vector3 capsuleCore(void const* shape, LibMath::Vector3 const& direction)
+{
+	LibMath::Geometry3D::Capsule const& capsule = *static_cast<LibMath::Geometry3D::Capsule const*>(shape);
+
+	LibMath::Vector3 pointA(capsule.m_pointA);
+	LibMath::Vector3 pointB(capsule.m_pointB);
+
+	return direction.dot(pointB - pointA) > 0.f ? pointB : pointA;
+}
+
+LibMath::Collisions3D::ConvexShape::ConvexShape(Geometry3D::Sphere const& sphere)
+{
+	m_support = &sphereCore;
+	m_shape = &sphere;
+	m_radius = sphere.m_radius;
+}
+
+LibMath::Collisions3D::ConvexShape::ConvexShape(Geometry3D::Capsule const& capsule)
+{
+	m_support = &capsuleCore;
+	m_shape = &capsule;
+	m_radius = capsule.m_radius;
+}
+
+#pragma endregion
+
+#pragma region Simplex
+
+namespace
+{
+	int constexpr	c_maxIterations = 64;
+	float constexpr	c_gjkTolerance = 1e-5f;			// relative progress of the squared distance below which GJK stops
+	float constexpr	c_contactTolerance = 1e-10f;	// squared distance counted as a contact
+	float constexpr	c_epaTolerance = 1e-4f;			// relative distance between the closest face and the surface
+	float constexpr	c_flatTolerance = 1e-5f;		// tetrahedron volume relative to the product of its edges below which it is flat
+
+	int constexpr	c_maxVertices = c_maxIterations + 4;
+	int constexpr	c_maxFaces = 2 * c_maxVertices;	// closed triangle mesh : F = 2V - 4
+
+	float constexpr	c_infinity = std::numeric_limits<float>::infinity();
+
+	struct SimplexVertex
+	{
+		LibMath::Vector3	m_point;				// m_pointA - m_pointB
+		LibMath::Vector3	m_pointA;
+		LibMath::Vector3	m_pointB;
+		LibMath::Vector3	m_direction;			// support direction the vertex comes from, kept for the cache
+	};
+
+	struct Simplex
+	{
+		SimplexVertex		m_vertices[4];
+		float				m_weights[4] = { 0.f, 0.f, 0.f, 0.f };	// barycentric coordinates of the closest point
+		int					m_count = 0;
+	};
+
+	enum class GjkStop
+	{
+		Never,									// run to the closest points
+		WhenSeparated,							// stop once the shapes are known to be apart
+		WhenDecided								// stop once the shapes are known to be apart or to overlap
+	};
+
+	struct Face
+	{
+		int					m_a = 0;				// counterclockwise seen from outside
+		int					m_b = 0;
+		int					m_c = 0;
+		LibMath::Vector3	m_normal;				// unit, outward
+		float				m_distance = 0.f;		// from the origin to the plane of the face
+	};
+}
+
+static SimplexVertex getSupportVertex(LibMath::Collisions3D::ConvexShape const& shapeA, LibMath::Collisions3D::ConvexShape const& shapeB, LibMath::Vector3 const& direction)
+{
+	// GJK and EPA only see the cores, the radii are added to their results
+	LibMath::Vector3 pointA = shapeA.getCoreSupportPoint(direction);
+	LibMath::Vector3 pointB = shapeB.getCoreSupportPoint(-direction);
+
+	return SimplexVertex{ pointA - pointB, pointA, pointB, direction };
+}
+
+static LibMath::Vector3 getClosest(Simplex const& simplex)
+{
+	LibMath::Vector3 closest;
+	for (int i = 0; i < simplex.m_count; ++i)
+	{
+		closest += simplex.m_vertices[i].m_point * simplex.m_weights[i];
+	}
+
+	return closest;
+}
+
+static void setVertex(Simplex& result, SimplexVertex const& a)
+{
+	result.m_vertices[0] = a;
+	result.m_weights[0] = 1.f;
+	result.m_count = 1;
+}
+
+static void setSegment(Simplex& result, SimplexVertex const& a, SimplexVertex const& b, float t)
+{
+	// t is the weight of b
+	result.m_vertices[0] = a;
+	result.m_vertices[1] = b;
+	result.m_weights[0] = 1.f - t;
+	result.m_weights[1] = t;
+	result.m_count = 2;
+}
+
+static void solveSegment(SimplexVertex const& a, SimplexVertex const& b, Simplex& result)
+{
+	LibMath::Vector3 ab = b.m_point - a.m_point;
+
+	float t = -a.m_point.dot(ab);
+	float lengthSquared = ab.dot(ab);
+
+	if (t <= 0.f || lengthSquared == 0.f)
+	{
+		setVertex(result, a);
+	}
+	else if (t >= lengthSquared)
+	{
+		setVertex(result, b);
+	}
+	else
+	{
+		setSegment(result, a, b, t / lengthSquared);
+	}
+}
+
+static void solveTriangle(SimplexVertex const& a, SimplexVertex const& b, SimplexVertex const& c, Simplex& result)
+{
+	// Voronoi regions of the triangle seen from the origin (Ericson, Real-Time Collision Detection 5.1.5)
+	// The edge regions go through solveSegment, a face of a flat tetrahedron may have a zero length edge
+	LibMath::Vector3 ab = b.m_point - a.m_point;
+	LibMath::Vector3 ac = c.m_point - a.m_point;
+
+	float d1 = -ab.dot(a.m_point);
+	float d2 = -ac.dot(a.m_point);
+	if (d1 <= 0.f && d2 <= 0.f)
+	{
+		setVertex(result, a);
+		return;
+	}
+
+	float d3 = -ab.dot(b.m_point);
+	float d4 = -ac.dot(b.m_point);
+	if (d3 >= 0.f && d4 <= d3)
+	{
+		setVertex(result, b);
+		return;
+	}
+
+	float vc = d1 * d4 - d3 * d2;
+	if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+	{
+		solveSegment(a, b, result);
+		return;
+	}
+
+	float d5 = -ab.dot(c.m_point);
+	float d6 = -ac.dot(c.m_point);
+	if (d6 >= 0.f && d5 <= d6)
+	{
+		setVertex(result, c);
+		return;
+	}
+
+	float vb = d5 * d2 - d1 * d6;
+	if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+	{
+		solveSegment(a, c, result);
+		return;
+	}
+
+	float va = d3 * d6 - d5 * d4;
+	if (va <= 0.f && d4 - d3 >= 0.f && d5 - d6 >= 0.f)
+	{
+		solveSegment(b, c, result);
+		return;
+	}
+
+	float sum = va + vb + vc;
+
+	// Flat triangle : the closest point is on one of its edges
+	if (sum <= 0.f)
+	{
+		Simplex edges[3];
+		solveSegment(a, b, edges[0]);
+		solveSegment(b, c, edges[1]);
+		solveSegment(c, a, edges[2]);
+
+		float best = getClosest(edges[0]).magnitudeSquared();
+		result = edges[0];
+
+		for (int i = 1; i < 3; ++i)
+		{
+			float distance = getClosest(edges[i]).magnitudeSquared();
+			if (distance < best)
+			{
+				best = distance;
+				result = edges[i];
+			}
+		}
+		return;
+	}
+
+	result.m_vertices[0] = a;
+	result.m_vertices[1] = b;
+	result.m_vertices[2] = c;
+	result.m_weights[1] = vb / sum;
+	result.m_weights[2] = vc / sum;
+	result.m_weights[0] = 1.f - result.m_weights[1] - result.m_weights[2];
+	result.m_count = 3;
+}
+
+static bool isOriginOutside(LibMath::Vector3 const& a, LibMath::Vector3 const& b, LibMath::Vector3 const& c, LibMath::Vector3 const& opposite)
+{
+	// The origin and the 4th vertex on both sides of the face, a flat tetrahedron counts as outside
+	LibMath::Vector3 normal = (b - a).cross(c - a);
+
+	return (-a).dot(normal) * (opposite - a).dot(normal) <= 0.f;
+}
+
+static void solveTetrahedron(Simplex& simplex)
+{
+	SimplexVertex const& a = simplex.m_vertices[0];
+	SimplexVertex const& b = simplex.m_vertices[1];
+	SimplexVertex const& c = simplex.m_vertices[2];
+	SimplexVertex const& d = simplex.m_vertices[3];
+
+	LibMath::Vector3 ab = b.m_point - a.m_point;
+	LibMath::Vector3 ac = c.m_point - a.m_point;
+	LibMath::Vector3 ad = d.m_point - a.m_point;
+
+	// A flat tetrahedron encloses nothing, rounding would otherwise put the origin inside every face
+	float volume = ab.cross(ac).dot(ad);
+	bool flat = std::abs(volume) <= c_flatTolerance * ab.magnitude() * ac.magnitude() * ad.magnitude();
+
+	SimplexVertex const* faces[4][4] = { { &a, &b, &c, &d }, { &a, &c, &d, &b }, { &a, &d, &b, &c }, { &b, &d, &c, &a } };
+
+	Simplex best;
+	float bestDistance = c_infinity;
+
+	for (auto const& face : faces)
+	{
+		if (!flat && !isOriginOutside(face[0]->m_point, face[1]->m_point, face[2]->m_point, face[3]->m_point))
+		{
+			continue;
+		}
+
+		Simplex candidate;
+		solveTriangle(*face[0], *face[1], *face[2], candidate);
+
+		float distance = getClosest(candidate).magnitudeSquared();
+		if (distance < bestDistance)
+		{
+			bestDistance = distance;
+			best = candidate;
+		}
+	}
+
+	// Inside every face : the origin is in the tetrahedron, its weights are the volumes of the opposite sub tetrahedra
+	if (best.m_count == 0)
+	{
+		LibMath::Vector3 ao = -a.m_point;
+
+		simplex.m_weights[1] = ao.cross(ac).dot(ad) / volume;
+		simplex.m_weights[2] = ab.cross(ao).dot(ad) / volume;
+		simplex.m_weights[3] = ab.cross(ac).dot(ao) / volume;
+		simplex.m_weights[0] = 1.f - simplex.m_weights[1] - simplex.m_weights[2] - simplex.m_weights[3];
+		return;
+	}
+
+	simplex = best;
+}
+
+static void solve(Simplex& simplex)
+{
+	// Keep the smallest feature holding the point closest to the origin
+	Simplex result;
+
+	switch (simplex.m_count)
+	{
+	case 1:
+		simplex.m_weights[0] = 1.f;
+		return;
+	case 2:
+		solveSegment(simplex.m_vertices[0], simplex.m_vertices[1], result);
+		break;
+	case 3:
+		solveTriangle(simplex.m_vertices[0], simplex.m_vertices[1], simplex.m_vertices[2], result);
+		break;
+	default:
+		solveTetrahedron(simplex);
+		return;
+	}
+
+	simplex = result;
+}
+
+#pragma endregion
+
+#pragma region GJK
+
+static bool runGjk(LibMath::Collisions3D::ConvexShape const& shapeA, LibMath::Collisions3D::ConvexShape const& shapeB, LibMath::Collisions3D::GjkCache* cache,
+	GjkStop stop, Simplex& simplex, int& iterations)
+{
+	// True when the cores overlap, otherwise the simplex holds their closest points
+	// The radii only matter to stop early : cores apart by more than the radii, or closer than the radii
+	float radius = shapeA.getRadius() + shapeB.getRadius();
+
+	// Warm start from the directions of the previous simplex, a cold start from any direction
+	if (cache != nullptr && cache->m_count > 0)
+	{
+		simplex.m_count = 0;
+		for (int i = 0; i < cache->m_count; ++i)
+		{
+			simplex.m_vertices[simplex.m_count++] = getSupportVertex(shapeA, shapeB, cache->m_directions[i]);
+		}
+
+		solve(simplex);
+	}
+	else
+	{
+		setVertex(simplex, getSupportVertex(shapeA, shapeB, LibMath::Vector3(1.f, 0.f, 0.f)));
+	}
+
+	LibMath::Vector3 closest = getClosest(simplex);
+	float closestSquared = closest.dot(closest);
+	bool overlap = false;
+
+	for (iterations = 0; iterations < c_maxIterations; ++iterations)
+	{
+		if (simplex.m_count == 4 || closestSquared <= c_contactTolerance)
+		{
+			overlap = true;
+			break;
+		}
+
+		// Already within the radii, the shapes overlap whatever the exact distance
+		if (stop == GjkStop::WhenDecided && closestSquared <= radius * radius)
+		{
+			break;
+		}
+
+		SimplexVertex vertex = getSupportVertex(shapeA, shapeB, -closest);
+		float reach = closest.dot(vertex.m_point);
+
+		// The farthest point toward the origin stops more than radius before it, the shapes are apart
+		if (stop != GjkStop::Never && reach > 0.f && reach * reach > radius * radius * closestSquared)
+		{
+			break;
+		}
+
+		// The new vertex brings the simplex no closer, closest is the distance
+		if (closestSquared - reach <= c_gjkTolerance * closestSquared)
+		{
+			break;
+		}
+
+		Simplex previous = simplex;
+		simplex.m_vertices[simplex.m_count++] = vertex;
+		solve(simplex);
+
+		LibMath::Vector3 next = getClosest(simplex);
+		float nextSquared = next.dot(next);
+
+		// Rounding errors only (a new vertex that only flattens the simplex included), keep the last progress
+		if (nextSquared >= closestSquared)
+		{
+			simplex = previous;
+			break;
+		}
+
+		closest = next;
+		closestSquared = nextSquared;
+	}
+
+	if (cache != nullptr)
+	{
+		cache->m_count = simplex.m_count;
+		for (int i = 0; i < simplex.m_count; ++i)
+		{
+			cache->m_directions[i] = simplex.m_vertices[i].m_direction;
+		}
+	}
+
+	return overlap;
+}
+
+bool LibMath::Collisions3D::checkCollisionConvex(ConvexShape const& shapeA, ConvexShape const& shapeB, GjkCache* cache)
+{
+	Simplex simplex;
+	int iterations = 0;
+
+	if (runGjk(shapeA, shapeB, cache, GjkStop::WhenDecided, simplex, iterations))
+	{
+		return true;
+	}
+
+	float radius = shapeA.getRadius() + shapeB.getRadius();
+	return getClosest(simplex).magnitudeSquared() <= radius * radius;
+}
+
+LibMath::Collisions3D::ConvexDistance LibMath::Collisions3D::getDistanceConvex(ConvexShape const& shapeA, ConvexShape const& shapeB, GjkCache* cache)
+{
+	Simplex simplex;
+	ConvexDistance result;
+
+	bool overlap = runGjk(shapeA, shapeB, cache, GjkStop::Never, simplex, result.m_iterations);
+
+	for (int i = 0; i < simplex.m_count; ++i)
+	{
+		result.m_pointA += simplex.m_vertices[i].m_pointA * simplex.m_weights[i];
+		result.m_pointB += simplex.m_vertices[i].m_pointB * simplex.m_weights[i];
+	}
+
+	float radius = shapeA.getRadius() + shapeB.getRadius();
+	float coreDistance = overlap ? 0.f : (result.m_pointB - result.m_pointA).magnitude();
+
+	if (coreDistance <= radius)
+	{
+		return result;
+	}
+
+	// Closest points of the cores moved out to the surfaces
+	Vector3 normal = (result.m_pointB - result.m_pointA) / coreDistance;
+
+	result.m_pointA += normal * shapeA.getRadius();
+	result.m_pointB -= normal * shapeB.getRadius();
+	result.m_distance = coreDistance - radius;
+
+	return result;
+}
+
+#pragma endregion
+
+#pragma region EPA
+
+static bool completeTetrahedron(LibMath::Collisions3D::ConvexShape const& shapeA, LibMath::Collisions3D::ConvexShape const& shapeB, Simplex& simplex)
+{
+	// GJK may stop on a vertex, an edge or a face holding the origin, the missing vertices are searched around it
+	float constexpr minimum = 1e-6f;
+
+	LibMath::Vector3 const axes[3] = { LibMath::Vector3(1.f, 0.f, 0.f), LibMath::Vector3(0.f, 1.f, 0.f), LibMath::Vector3(0.f, 0.f, 1.f) };
+
+	if (simplex.m_count == 1)
+	{
+		for (int i = 0; i < 6 && simplex.m_count == 1; ++i)
+		{
+			SimplexVertex vertex = getSupportVertex(shapeA, shapeB, i < 3 ? axes[i] : -axes[i - 3]);
+
+			if ((vertex.m_point - simplex.m_vertices[0].m_point).magnitudeSquared() > minimum)
+			{
+				simplex.m_vertices[simplex.m_count++] = vertex;
+			}
+		}
+	}
+
+	if (simplex.m_count == 2)
+	{
+		LibMath::Vector3 edge = simplex.m_vertices[1].m_point - simplex.m_vertices[0].m_point;
+
+		// Axis least aligned with the edge, then around the edge by quarter turns
+		int axis = 0;
+		for (int i = 1; i < 3; ++i)
+		{
+			if (std::abs(edge[i]) < std::abs(edge[axis]))
+			{
+				axis = i;
+			}
+		}
+
+		LibMath::Vector3 side = edge.cross(axes[axis]);
+		LibMath::Vector3 directions[4] = { side, edge.cross(side), -side, -edge.cross(side) };
+
+		for (int i = 0; i < 4 && simplex.m_count == 2; ++i)
+		{
+			SimplexVertex vertex = getSupportVertex(shapeA, shapeB, directions[i]);
+
+			if (edge.cross(vertex.m_point - simplex.m_vertices[0].m_point).magnitudeSquared() > minimum * edge.magnitudeSquared())
+			{
+				simplex.m_vertices[simplex.m_count++] = vertex;
+			}
+		}
+	}
+
+	if (simplex.m_count == 3)
+	{
+		LibMath::Vector3 normal = (simplex.m_vertices[1].m_point - simplex.m_vertices[0].m_point).cross(simplex.m_vertices[2].m_point - simplex.m_vertices[0].m_point);
+
+		for (int i = 0; i < 2 && simplex.m_count == 3; ++i)
+		{
+			SimplexVertex vertex = getSupportVertex(shapeA, shapeB, i == 0 ? normal : -normal);
+
+			if (std::abs((vertex.m_point - simplex.m_vertices[0].m_point).dot(normal)) > minimum * normal.magnitude())
+			{
+				simplex.m_vertices[simplex.m_count++] = vertex;
+			}
+		}
+	}
+
+	// A flat Minkowski difference (ex: 2 segments) has no volume to expand
+	return simplex.m_count == 4;
+}
+
+static Face makeFace(SimplexVertex const* vertices, int a, int b, int c)
+{
+	Face face{ a, b, c, LibMath::Vector3(), 0.f };
+
+	LibMath::Vector3 normal = (vertices[b].m_point - vertices[a].m_point).cross(vertices[c].m_point - vertices[a].m_point);
+	float length = normal.magnitude();
+
+	// A sliver face is never the closest one
+	if (length == 0.f)
+	{
+		face.m_distance = c_infinity;
+		return face;
+	}
+
+	face.m_normal = normal / length;
+	face.m_distance = face.m_normal.dot(vertices[a].m_point);
+
+	return face;
+}
+
+static void getBarycentric(LibMath::Vector3 const& point, LibMath::Vector3 const& a, LibMath::Vector3 const& b, LibMath::Vector3 const& c, float& u, float& v, float& w)
+{
+	// point in the plane of the triangle (Ericson 3.4)
+	LibMath::Vector3 ab = b - a;
+	LibMath::Vector3 ac = c - a;
+	LibMath::Vector3 ap = point - a;
+
+	float d00 = ab.dot(ab);
+	float d01 = ab.dot(ac);
+	float d11 = ac.dot(ac);
+	float d20 = ap.dot(ab);
+	float d21 = ap.dot(ac);
+	float denominator = d00 * d11 - d01 * d01;
+
+	if (denominator == 0.f)
+	{
+		u = 1.f;
+		v = w = 0.f;
+		return;
+	}
+
+	v = (d11 * d20 - d01 * d21) / denominator;
+	w = (d00 * d21 - d01 * d20) / denominator;
+	u = 1.f - v - w;
+}
+
+static LibMath::Vector3 getFlatNormal(Simplex const& simplex)
+{
+	// Normal of the plane holding a simplex that completeTetrahedron could not grow, any unit vector for a single point
+	LibMath::Vector3 normal(1.f, 0.f, 0.f);
+
+	if (simplex.m_count == 2)
+	{
+		LibMath::Vector3 edge = simplex.m_vertices[1].m_point - simplex.m_vertices[0].m_point;
+		LibMath::Vector3 axis = std::abs(edge.m_x) < std::abs(edge.m_y) ? LibMath::Vector3(1.f, 0.f, 0.f) : LibMath::Vector3(0.f, 1.f, 0.f);
+
+		normal = edge.cross(axis);
+	}
+	else if (simplex.m_count == 3)
+	{
+		normal = (simplex.m_vertices[1].m_point - simplex.m_vertices[0].m_point).cross(simplex.m_vertices[2].m_point - simplex.m_vertices[0].m_point);
+	}
+
+	float length = normal.magnitude();
+	return length > 0.f ? normal / length : LibMath::Vector3(1.f, 0.f, 0.f);
+}
+
+bool LibMath::Collisions3D::getPenetrationConvex(ConvexShape const& shapeA, ConvexShape const& shapeB, Penetration& penetration, GjkCache* cache)
+{
+	Simplex simplex;
+	int iterations = 0;
+
+	float radius = shapeA.getRadius() + shapeB.getRadius();
+
+	if (!runGjk(shapeA, shapeB, cache, GjkStop::WhenSeparated, simplex, iterations))
+	{
+		// Shallow : the cores are apart, the contact is along the line joining their closest points
+		Vector3 coreA;
+		Vector3 coreB;
+		for (int i = 0; i < simplex.m_count; ++i)
+		{
+			coreA += simplex.m_vertices[i].m_pointA * simplex.m_weights[i];
+			coreB += simplex.m_vertices[i].m_pointB * simplex.m_weights[i];
+		}
+
+		float coreDistance = (coreB - coreA).magnitude();
+		if (coreDistance > radius || coreDistance == 0.f)
+		{
+			return false;
+		}
+
+		Vector3 normal = (coreB - coreA) / coreDistance;
+
+		penetration.m_normal = normal;
+		penetration.m_depth = radius - coreDistance;
+		penetration.m_pointA = coreA + normal * shapeA.getRadius();
+		penetration.m_pointB = coreB - normal * shapeB.getRadius();
+		return true;
+	}
+
+	// Deep : the cores overlap, EPA runs on the cores and the radii are added to its depth
+	// EPA on the whole round shapes would have to approximate a curved surface with its polytope
+	Vector3 coreA;
+	Vector3 coreB;
+	for (int i = 0; i < simplex.m_count; ++i)
+	{
+		coreA += simplex.m_vertices[i].m_pointA * simplex.m_weights[i];
+		coreB += simplex.m_vertices[i].m_pointB * simplex.m_weights[i];
+	}
+
+	if (!completeTetrahedron(shapeA, shapeB, simplex))
+	{
+		// Cores without volume (ex: 2 points, 2 segments) : any direction out of their plane leaves them touching, only the radii overlap
+		penetration.m_normal = getFlatNormal(simplex);
+		penetration.m_depth = radius;
+		penetration.m_pointA = coreA + penetration.m_normal * shapeA.getRadius();
+		penetration.m_pointB = coreB - penetration.m_normal * shapeB.getRadius();
+		return true;
+	}
+
+	SimplexVertex vertices[c_maxVertices];
+	Face faces[c_maxFaces];
+	int edges[c_maxFaces * 3][2];
+
+	int vertexCount = 4;
+	int faceCount = 0;
+
+	for (int i = 0; i < 4; ++i)
+	{
+		vertices[i] = simplex.m_vertices[i];
+	}
+
+	// Wind the tetrahedron faces outward, away from their opposite vertex
+	int const tetrahedron[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+	for (auto const& indices : tetrahedron)
+	{
+		Face face = makeFace(vertices, indices[0], indices[1], indices[2]);
+
+		if (face.m_distance != c_infinity && face.m_normal.dot(vertices[indices[3]].m_point - vertices[indices[0]].m_point) > 0.f)
+		{
+			face = makeFace(vertices, indices[0], indices[2], indices[1]);
+		}
+
+		faces[faceCount++] = face;
+	}
+
+	auto findClosest = [&faces, &faceCount]()
+	{
+		int closest = 0;
+		for (int i = 1; i < faceCount; ++i)
+		{
+			if (faces[i].m_distance < faces[closest].m_distance)
+			{
+				closest = i;
+			}
+		}
+		return closest;
+	};
+
+	for (int iteration = 0; iteration < c_maxIterations; ++iteration)
+	{
+		Face const& face = faces[findClosest()];
+		SimplexVertex vertex = getSupportVertex(shapeA, shapeB, face.m_normal);
+
+		// The face lies on the surface of A - B
+		if (vertex.m_point.dot(face.m_normal) - face.m_distance <= c_epaTolerance * std::max(1.f, face.m_distance) || vertexCount == c_maxVertices)
+		{
+			break;
+		}
+
+		int newVertex = vertexCount;
+		vertices[vertexCount++] = vertex;
+
+		// Remove the faces the new vertex sees, their outline (edges used once) is the horizon
+		int edgeCount = 0;
+		for (int i = 0; i < faceCount;)
+		{
+			Face const& visible = faces[i];
+
+			if (visible.m_distance == c_infinity || visible.m_normal.dot(vertex.m_point - vertices[visible.m_a].m_point) <= 0.f)
+			{
+				++i;
+				continue;
+			}
+
+			int const faceEdges[3][2] = { { visible.m_a, visible.m_b }, { visible.m_b, visible.m_c }, { visible.m_c, visible.m_a } };
+			for (auto const& edge : faceEdges)
+			{
+				int shared = -1;
+				for (int j = 0; j < edgeCount && shared == -1; ++j)
+				{
+					if (edges[j][0] == edge[1] && edges[j][1] == edge[0])
+					{
+						shared = j;
+					}
+				}
+
+				if (shared == -1)
+				{
+					edges[edgeCount][0] = edge[0];
+					edges[edgeCount][1] = edge[1];
+					++edgeCount;
+				}
+				else
+				{
+					--edgeCount;
+					edges[shared][0] = edges[edgeCount][0];
+					edges[shared][1] = edges[edgeCount][1];
+				}
+			}
+
+			faces[i] = faces[--faceCount];
+		}
+
+		for (int i = 0; i < edgeCount && faceCount < c_maxFaces; ++i)
+		{
+			faces[faceCount++] = makeFace(vertices, edges[i][0], edges[i][1], newVertex);
+		}
+	}
+
+	// Origin projected on the closest face, mapped back on both shapes
+	Face const& face = faces[findClosest()];
+	Vector3 contact = face.m_normal * face.m_distance;
+
+	float u, v, w;
+	getBarycentric(contact, vertices[face.m_a].m_point, vertices[face.m_b].m_point, vertices[face.m_c].m_point, u, v, w);
+
+	penetration.m_normal = face.m_normal;
+	penetration.m_depth = std::max(face.m_distance, 0.f) + radius;
+	penetration.m_pointA = vertices[face.m_a].m_pointA * u + vertices[face.m_b].m_pointA * v + vertices[face.m_c].m_pointA * w + face.m_normal * shapeA.getRadius();
+	penetration.m_pointB = vertices[face.m_a].m_pointB * u + vertices[face.m_b].m_pointB * v + vertices[face.m_c].m_pointB * w - face.m_normal * shapeB.getRadius();
+
+	return true;
+}
+
+#pragma endregion
+
+#pragma region Time of impact
+
+bool LibMath::Collisions3D::getTimeOfImpactConvex(ConvexShape const& shapeA, Vector3 const& velocityA, ConvexShape const& shapeB, Vector3 const& velocityB,
+	float& time, float const tolerance)
+{
+	// Conservative advancement : B stays still and A moves by the relative velocity,
+	// each step covers the distance left divided by the speed at which it closes, so A never passes through B
+	Vector3 velocity = velocityA - velocityB;
+
+	GjkCache cache;
+	float current = 0.f;
+
+	for (int iteration = 0; iteration < c_maxIterations; ++iteration)
+	{
+		ConvexDistance distance = getDistanceConvex(shapeA.translated(velocity * current), shapeB, &cache);
+
+		if (distance.m_distance <= tolerance)
+		{
+			time = current;
+			return true;
+		}
+
+		Vector3 normal = (distance.m_pointB - distance.m_pointA) / distance.m_distance;
+		float closingSpeed = velocity.dot(normal);
+
+		// Moving apart along the separating axis, they never meet
+		if (closingSpeed <= 0.f)
+		{
+			return false;
+		}
+
+		current += (distance.m_distance - tolerance * 0.5f) / closingSpeed;
+		if (current > 1.f)
+		{
+			return false;
+		}
+	}
+
+	// Not converged (grazing contact or a tolerance below the distance precision), reported as a miss
+	return false;
+}
+
+#pragma endregion
@@ -0,0 +1,565 @@
+#include "LibMath/DynamicAABBTree.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#pragma region Bounds helpers
+
+static LibMath::Vector3 boundsMin(LibMath::Geometry3D::AABB const& aabb)
+{
+	return LibMath::Vector3(aabb.m_center.m_x - aabb.extentX(), aabb.m_center.m_y - aabb.extentY(), aabb.m_center.m_z - aabb.extentZ());
+}
+
+static LibMath::Vector3 boundsMax(LibMath::Geometry3D::AABB const& aabb)
+{
+	return LibMath::Vector3(aabb.m_center.m_x + aabb.extentX(), aabb.m_center.m_y + aabb.extentY(), aabb.m_center.m_z + aabb.extentZ());
+}
+
+static LibMath::Vector3 minimum(LibMath::Vector3 const& a, LibMath::Vector3 const& b)
+{
+	return LibMath::Vector3(std::min(a.m_x, b.m_x), std::min(a.m_y, b.m_y), std::min(a.m_z, b.m_z));
+}
+
+static LibMath::Vector3 maximum(LibMath::Vector3 const& a, LibMath::Vector3 const& b)
+{
+	return LibMath::Vector3(std::max(a.m_x, b.m_x), std::max(a.m_y, b.m_y), std::max(a.m_z, b.m_z));
+}
+
+static float surfaceArea(LibMath::Vector3 const& min, LibMath::Vector3 const& max)
+{
+	LibMath::Vector3 size = max - min;
+
+	return 2.f * (size.m_x * size.m_y + size.m_y * size.m_z + size.m_z * size.m_x);
+}
+
+static float unionArea(LibMath::Vector3 const& minA, LibMath::Vector3 const& maxA, LibMath::Vector3 const& minB, LibMath::Vector3 const& maxB)
+{
+	return surfaceArea(minimum(minA, minB), maximum(maxA, maxB));
+}
+
+static bool contains(LibMath::Vector3 const& outerMin, LibMath::Vector3 const& outerMax, LibMath::Vector3 const& innerMin, LibMath::Vector3 const& innerMax)
+{
+	return outerMin.m_x <= innerMin.m_x && outerMin.m_y <= innerMin.m_y && outerMin.m_z <= innerMin.m_z &&
+		innerMax.m_x <= outerMax.m_x && innerMax.m_y <= outerMax.m_y && innerMax.m_z <= outerMax.m_z;
+}
+
+static bool overlaps(LibMath::Vector3 const& minA, LibMath::Vector3 const& maxA, LibMath::Vector3 const& minB, LibMath::Vector3 const& maxB)
+{
+	return minA.m_x <= maxB.m_x && minB.m_x <= maxA.m_x &&
+		minA.m_y <= maxB.m_y && minB.m_y <= maxA.m_y &&
+		minA.m_z <= maxB.m_z && minB.m_z <= maxA.m_z;
+}
+
+#pragma endregion
+
+#pragma region Dynamic AABB Tree
+
+bool LibMath::Collisions3D::DynamicAABBTree::Node::isLeaf(void) const
+{
+	return m_left == nullProxy;
+}
+
+LibMath::Collisions3D::DynamicAABBTree::DynamicAABBTree(float const margin)
+	: m_margin(margin)
+{
+	if (margin < 0.f)
+	{
+		throw std::invalid_argument("Error: the fat AABB margin can not be negative");
+	}
+}
+
+int LibMath::Collisions3D::DynamicAABBTree::insert(Geometry3D::AABB const& bounds, void* object)
+{
+	int proxy = allocateNode();
+
+	Vector3 margin(m_margin);
+
+	Node& leaf = m_nodes[proxy];
+	leaf.m_min = boundsMin(bounds) - margin;
+	leaf.m_max = boundsMax(bounds) + margin;
+	leaf.m_object = object;
+
+	insertLeaf(proxy);
+	++m_proxyCount;
+
+	return proxy;
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::remove(int const proxy)
+{
+	checkProxy(proxy);
+
+	removeLeaf(proxy);
+	freeNode(proxy);
+	--m_proxyCount;
+}
+
+bool LibMath::Collisions3D::DynamicAABBTree::move(int const proxy, Geometry3D::AABB const& bounds, Vector3 const& displacement)
+{
+	checkProxy(proxy);
+
+	Vector3 margin(m_margin);
+	Vector3 min = boundsMin(bounds);
+	Vector3 max = boundsMax(bounds);
+
+	Vector3 fatMin = min - margin;
+	Vector3 fatMax = max + margin;
+
+	// Predict the motion so the proxy stays in its fat AABB for the next moves
+	(displacement.m_x < 0.f ? fatMin.m_x : fatMax.m_x) += displacement.m_x;
+	(displacement.m_y < 0.f ? fatMin.m_y : fatMax.m_y) += displacement.m_y;
+	(displacement.m_z < 0.f ? fatMin.m_z : fatMax.m_z) += displacement.m_z;
+
+	Node& leaf = m_nodes[proxy];
+
+	if (contains(leaf.m_min, leaf.m_max, min, max))
+	{
+		// Still inside, reinsert only when the fat AABB became much larger than needed
+		Vector3 hugeMargin(4.f * m_margin);
+
+		if (contains(fatMin - hugeMargin, fatMax + hugeMargin, leaf.m_min, leaf.m_max))
+		{
+			return false;
+		}
+	}
+
+	removeLeaf(proxy);
+
+	m_nodes[proxy].m_min = fatMin;
+	m_nodes[proxy].m_max = fatMax;
+
+	insertLeaf(proxy);
+
+	return true;
+}
+
+void* LibMath::Collisions3D::DynamicAABBTree::getObject(int const proxy) const
+{
+	checkProxy(proxy);
+
+	return m_nodes[proxy].m_object;
+}
+
+LibMath::Geometry3D::AABB LibMath::Collisions3D::DynamicAABBTree::getFatAABB(int const proxy) const
+{
+	checkProxy(proxy);
+
+	Node const& leaf = m_nodes[proxy];
+	Vector3 center = (leaf.m_min + leaf.m_max) * 0.5f;
+	Vector3 size = leaf.m_max - leaf.m_min;
+
+	return Geometry3D::AABB(Geometry3D::Point(center), size.m_x, size.m_y, size.m_z);
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::query(Geometry3D::AABB const& bounds, std::vector<int>& result) const
+{
+	if (m_root == nullProxy)
+	{
+		return;
+	}
+
+	Vector3 min = boundsMin(bounds);
+	Vector3 max = boundsMax(bounds);
+
+	std::vector<int> stack;
+	stack.push_back(m_root);
+
+	while (!stack.empty())
+	{
+		Node const& node = m_nodes[stack.back()];
+		int index = stack.back();
+		stack.pop_back();
+
+		if (!overlaps(node.m_min, node.m_max, min, max))
+		{
+			continue;
+		}
+
+		if (node.isLeaf())
+		{
+			result.push_back(index);
+		}
+		else
+		{
+			stack.push_back(node.m_left);
+			stack.push_back(node.m_right);
+		}
+	}
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::queryPairs(std::vector<std::pair<int, int>>& result) const
+{
+	if (m_root == nullProxy)
+	{
+		return;
+	}
+
+	// Descend the tree against itself, a pair (n, n) stands for the pairs inside the subtree n
+	std::vector<std::pair<int, int>> stack;
+	stack.emplace_back(m_root, m_root);
+
+	while (!stack.empty())
+	{
+		auto [indexA, indexB] = stack.back();
+		stack.pop_back();
+
+		Node const& nodeA = m_nodes[indexA];
+		Node const& nodeB = m_nodes[indexB];
+
+		if (indexA == indexB)
+		{
+			if (!nodeA.isLeaf())
+			{
+				stack.emplace_back(nodeA.m_left, nodeA.m_left);
+				stack.emplace_back(nodeA.m_right, nodeA.m_right);
+				stack.emplace_back(nodeA.m_left, nodeA.m_right);
+			}
+			continue;
+		}
+
+		if (!overlaps(nodeA.m_min, nodeA.m_max, nodeB.m_min, nodeB.m_max))
+		{
+			continue;
+		}
+
+		if (nodeA.isLeaf() && nodeB.isLeaf())
+		{
+			result.emplace_back(std::min(indexA, indexB), std::max(indexA, indexB));
+		}
+		else if (nodeB.isLeaf() || (!nodeA.isLeaf() && surfaceArea(nodeA.m_min, nodeA.m_max) >= surfaceArea(nodeB.m_min, nodeB.m_max)))
+		{
+			// Split the larger node
+			stack.emplace_back(nodeA.m_left, indexB);
+			stack.emplace_back(nodeA.m_right, indexB);
+		}
+		else
+		{
+			stack.emplace_back(indexA, nodeB.m_left);
+			stack.emplace_back(indexA, nodeB.m_right);
+		}
+	}
+}
+
+size_t LibMath::Collisions3D::DynamicAABBTree::size(void) const
+{
+	return m_proxyCount;
+}
+
+int LibMath::Collisions3D::DynamicAABBTree::height(void) const
+{
+	return m_root == nullProxy ? -1 : m_nodes[m_root].m_height;
+}
+
+bool LibMath::Collisions3D::DynamicAABBTree::validate(void) const
+{
+	size_t leafCount = 0;
+
+	if (m_root != nullProxy && !validateNode(m_root, nullProxy, leafCount))
+	{
+		return false;
+	}
+
+	return leafCount == m_proxyCount;
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::clear(void)
+{
+	m_nodes.clear();
+	m_root = nullProxy;
+	m_freeList = nullProxy;
+	m_proxyCount = 0;
+}
+
+int LibMath::Collisions3D::DynamicAABBTree::allocateNode(void)
+{
+	int index = m_freeList;
+
+	if (index == nullProxy)
+	{
+		index = static_cast<int>(m_nodes.size());
+		m_nodes.emplace_back();
+	}
+	else
+	{
+		m_freeList = m_nodes[index].m_parent;
+	}
+
+	m_nodes[index] = Node();
+	m_nodes[index].m_height = 0;
+
+	return index;
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::freeNode(int const index)
+{
+	m_nodes[index] = Node();
+	m_nodes[index].m_parent = m_freeList;
+	m_freeList = index;
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::insertLeaf(int const leaf)
+{
+	if (m_root == nullProxy)
+	{
+		m_root = leaf;
+		m_nodes[leaf].m_parent = nullProxy;
+		return;
+	}
+
+	Vector3 leafMin = m_nodes[leaf].m_min;
+	Vector3 leafMax = m_nodes[leaf].m_max;
+
+	// Descend toward the sibling with the lowest surface area cost
+	int index = m_root;
+
+	while (!m_nodes[index].isLeaf())
+	{
+		Node const& node = m_nodes[index];
+
+		float area = surfaceArea(node.m_min, node.m_max);
+		float combinedArea = unionArea(node.m_min, node.m_max, leafMin, leafMax);
+
+		// Cost of a new parent for this node and the leaf, and the area added to every ancestor below
+		float cost = 2.f * combinedArea;
+		float inheritanceCost = 2.f * (combinedArea - area);
+
+		float childCost[2];
+		int children[2] = { node.m_left, node.m_right };
+
+		for (int i = 0; i < 2; ++i)
+		{
+			Node const& child = m_nodes[children[i]];
+			float enlargedArea = unionArea(child.m_min, child.m_max, leafMin, leafMax);
+
+			childCost[i] = child.isLeaf() ? enlargedArea + inheritanceCost : enlargedArea - surfaceArea(child.m_min, child.m_max) + inheritanceCost;
+		}
+
+		if (cost < childCost[0] && cost < childCost[1])
+		{
+			break;
+		}
+
+		index = childCost[0] < childCost[1] ? children[0] : children[1];
+	}
+
+	int sibling = index;
+	int oldParent = m_nodes[sibling].m_parent;
+	int newParent = allocateNode();
+
+	Node& parent = m_nodes[newParent];
+	parent.m_parent = oldParent;
+	parent.m_min = minimum(leafMin, m_nodes[sibling].m_min);
+	parent.m_max = maximum(leafMax, m_nodes[sibling].m_max);
+	parent.m_height = m_nodes[sibling].m_height + 1;
+	parent.m_left = sibling;
+	parent.m_right = leaf;
+
+	if (oldParent == nullProxy)
+	{
+		m_root = newParent;
+	}
+	else if (m_nodes[oldParent].m_left == sibling)
+	{
+		m_nodes[oldParent].m_left = newParent;
+	}
+	else
+	{
+		m_nodes[oldParent].m_right = newParent;
+	}
+
+	m_nodes[sibling].m_parent = newParent;
+	m_nodes[leaf].m_parent = newParent;
+
+	refitAncestors(newParent);
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::removeLeaf(int const leaf)
+{
+	if (leaf == m_root)
+	{
+		m_root = nullProxy;
+		return;
+	}
+
+	int parent = m_nodes[leaf].m_parent;
+	int grandParent = m_nodes[parent].m_parent;
+	int sibling = m_nodes[parent].m_left == leaf ? m_nodes[parent].m_right : m_nodes[parent].m_left;
+
+	// The sibling takes the place of the parent
+	m_nodes[sibling].m_parent = grandParent;
+	freeNode(parent);
+
+	if (grandParent == nullProxy)
+	{
+		m_root = sibling;
+	}
+	else
+	{
+		if (m_nodes[grandParent].m_left == parent)
+		{
+			m_nodes[grandParent].m_left = sibling;
+		}
+		else
+		{
+			m_nodes[grandParent].m_right = sibling;
+		}
+
+		refitAncestors(grandParent);
+	}
+
+	m_nodes[leaf].m_parent = nullProxy;
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::refitAncestors(int index)
+{
+	while (index != nullProxy)
+	{
+		refit(index);
+		rotate(index);
+
+		index = m_nodes[index].m_parent;
+	}
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::refit(int const index)
+{
+	Node& node = m_nodes[index];
+	Node const& left = m_nodes[node.m_left];
+	Node const& right = m_nodes[node.m_right];
+
+	node.m_min = minimum(left.m_min, right.m_min);
+	node.m_max = maximum(left.m_max, right.m_max);
+	node.m_height = 1 + std::max(left.m_height, right.m_height);
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::rotate(int const index)
+{
+	Node const& nodeA = m_nodes[index];
+
+	if (nodeA.m_height < 2)
+	{
+		return;
+	}
+
+	/*
+	*         A
+	*      /     \
+	*     B       C
+	*    / \     / \
+	*   D   E   F   G
+	*
+	* Try to swap a child of A with a grandchild under the other child, or two grandchildren,
+	* and keep the swap that reduces the most the area of the internal nodes below A
+	*/
+	int b = nodeA.m_left;
+	int c = nodeA.m_right;
+	Node const& nodeB = m_nodes[b];
+	Node const& nodeC = m_nodes[c];
+
+	float bestGain = 0.f;
+	int swapX = nullProxy;
+	int swapY = nullProxy;
+
+	auto consider = [&](float gain, int x, int y)
+	{
+		if (gain > bestGain)
+		{
+			bestGain = gain;
+			swapX = x;
+			swapY = y;
+		}
+	};
+
+	if (!nodeC.isLeaf())
+	{
+		Node const& nodeF = m_nodes[nodeC.m_left];
+		Node const& nodeG = m_nodes[nodeC.m_right];
+		float areaC = surfaceArea(nodeC.m_min, nodeC.m_max);
+
+		consider(areaC - unionArea(nodeB.m_min, nodeB.m_max, nodeG.m_min, nodeG.m_max), b, nodeC.m_left);
+		consider(areaC - unionArea(nodeB.m_min, nodeB.m_max, nodeF.m_min, nodeF.m_max), b, nodeC.m_right);
+	}
+
+	if (!nodeB.isLeaf())
+	{
+		Node const& nodeD = m_nodes[nodeB.m_left];
+		Node const& nodeE = m_nodes[nodeB.m_right];
+		float areaB = surfaceArea(nodeB.m_min, nodeB.m_max);
+
+		consider(areaB - unionArea(nodeC.m_min, nodeC.m_max, nodeE.m_min, nodeE.m_max), c, nodeB.m_left);
+		consider(areaB - unionArea(nodeC.m_min, nodeC.m_max, nodeD.m_min, nodeD.m_max), c, nodeB.m_right);
+
+		if (!nodeC.isLeaf())
+		{
+			Node const& nodeF = m_nodes[nodeC.m_left];
+			Node const& nodeG = m_nodes[nodeC.m_right];
+			float areaBC = areaB + surfaceArea(nodeC.m_min, nodeC.m_max);
+
+			consider(areaBC - unionArea(nodeF.m_min, nodeF.m_max, nodeE.m_min, nodeE.m_max) - unionArea(nodeD.m_min, nodeD.m_max, nodeG.m_min, nodeG.m_max),
+				nodeB.m_left, nodeC.m_left);
+			consider(areaBC - unionArea(nodeG.m_min, nodeG.m_max, nodeE.m_min, nodeE.m_max) - unionArea(nodeF.m_min, nodeF.m_max, nodeD.m_min, nodeD.m_max),
+				nodeB.m_left, nodeC.m_right);
+		}
+	}
+
+	if (swapX == nullProxy)
+	{
+		return;
+	}
+
+	int parentX = m_nodes[swapX].m_parent;
+	int parentY = m_nodes[swapY].m_parent;
+
+	(m_nodes[parentX].m_left == swapX ? m_nodes[parentX].m_left : m_nodes[parentX].m_right) = swapY;
+	(m_nodes[parentY].m_left == swapY ? m_nodes[parentY].m_left : m_nodes[parentY].m_right) = swapX;
+
+	m_nodes[swapX].m_parent = parentY;
+	m_nodes[swapY].m_parent = parentX;
+
+	// The swapped nodes hang below B or C, refit those before A
+	if (parentX != index)
+	{
+		refit(parentX);
+	}
+
+	refit(parentY);
+	refit(index);
+}
+
+void LibMath::Collisions3D::DynamicAABBTree::checkProxy(int const proxy) const
+{
+	if (proxy < 0 || proxy >= static_cast<int>(m_nodes.size()) || m_nodes[proxy].m_height != 0)
+	{
+		throw std::out_of_range("Error: invalid proxy");
+	}
+}
+
+bool LibMath::Collisions3D::DynamicAABBTree::validateNode(int const index, int const parent, size_t& leafCount) const
+{
+	Node const& node = m_nodes[index];
+
+	if (node.m_parent != parent)
+	{
+		return false;
+	}
+
+	if (node.isLeaf())
+	{
+		++leafCount;
+		return node.m_right == nullProxy && node.m_height == 0;
+	}
+
+	Node const& left = m_nodes[node.m_left];
+	Node const& right = m_nodes[node.m_right];
+
+	if (node.m_height != 1 + std::max(left.m_height, right.m_height) ||
+		!contains(node.m_min, node.m_max, left.m_min, left.m_max) ||
+		!contains(node.m_min, node.m_max, right.m_min, right.m_max))
+	{
+		return false;
+	}
+
+	return validateNode(node.m_left, index, leafCount) && validateNode(node.m_right, index, leafCount);
+}
+
+#pragma endregion
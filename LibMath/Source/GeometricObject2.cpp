@@ -213,8 +213,7 @@ LibMath::Geometry2D::Point LibMath::Geometry2D::OBB::getTopRightCorner(void) con
 	float halfHeight = m_height / 2;
 	float halfWidth = m_width / 2;
 
-	float cosR = LibMath::cos(m_rotation);
-	float sinR = LibMath::sin(m_rotation);
+	auto [sinR, cosR] = LibMath::sincos(m_rotation);
 
 	float x = m_center.m_x + (halfWidth * cosR - halfHeight * sinR);
 	float y = m_center.m_y + (halfWidth * sinR + halfHeight * cosR);
@@ -230,8 +229,7 @@ LibMath::Geometry2D::Point LibMath::Geometry2D::OBB::getTopLeftCorner(void) cons
 	float halfHeight = m_height / 2;
 	float halfWidth = m_width / 2;
 
-	float cosR = LibMath::cos(m_rotation);
-	float sinR = LibMath::sin(m_rotation);
+	auto [sinR, cosR] = LibMath::sincos(m_rotation);
 
 	float x = m_center.m_x + (-halfWidth * cosR - halfHeight * sinR);
 	float y = m_center.m_y + (-halfWidth * sinR + halfHeight * cosR);
@@ -246,8 +244,7 @@ LibMath::Geometry2D::Point LibMath::Geometry2D::OBB::getBotRightCorner(void) con
 	float halfHeight = m_height / 2;
 	float halfWidth = m_width / 2;
 
-	float cosR = LibMath::cos(m_rotation);
-	float sinR = LibMath::sin(m_rotation);
+	auto [sinR, cosR] = LibMath::sincos(m_rotation);
 
 	float x = m_center.m_x + (halfWidth * cosR - (-halfHeight) * sinR);
 	float y = m_center.m_y + (halfWidth * sinR + (-halfHeight) * cosR);
@@ -262,8 +259,7 @@ LibMath::Geometry2D::Point LibMath::Geometry2D::OBB::getBotLeftCorner(void) cons
 	float halfHeight = m_height / 2;
 	float halfWidth = m_width / 2;
 
-	float cosR = LibMath::cos(m_rotation);
-	float sinR = LibMath::sin(m_rotation);
+	auto [sinR, cosR] = LibMath::sincos(m_rotation);
 
 	float x = m_center.m_x + (-halfWidth * cosR - (-halfHeight) * sinR);
 	float y = m_center.m_y + (-halfWidth * sinR + (-halfHeight) * cosR);
@@ -365,3 +361,33 @@ float LibMath::Geometry2D::Circle::area(void) const
 }
 
 #pragma endregion 
+
+LibMath::Geometry2D::AABB LibMath::Geometry2D::getBoundingAABB(Line const& line)
+{
+	Point center((line.m_start.m_x + line.m_end.m_x) / 2, (line.m_start.m_y + line.m_end.m_y) / 2);
+
+	return AABB(center, std::abs(line.m_end.m_y - line.m_start.m_y), std::abs(line.m_end.m_x - line.m_start.m_x));
+}
+
+LibMath::Geometry2D::AABB LibMath::Geometry2D::getBoundingAABB(AABB const& aabb)
+{
+	return aabb;
+}
+
+LibMath::Geometry2D::AABB LibMath::Geometry2D::getBoundingAABB(OBB const& obb)
+{
+	auto [sinR, cosR] = LibMath::sincos(obb.m_rotation);
+	sinR = std::abs(sinR);
+	cosR = std::abs(cosR);
+
+	// Projection of the rotated box on the world axes
+	float width = obb.m_width * cosR + obb.m_height * sinR;
+	float height = obb.m_width * sinR + obb.m_height * cosR;
+
+	return AABB(obb.m_center, height, width);
+}
+
+LibMath::Geometry2D::AABB LibMath::Geometry2D::getBoundingAABB(Circle const& circle)
+{
+	return AABB(circle.m_center, 2 * circle.m_radius, 2 * circle.m_radius);
+}
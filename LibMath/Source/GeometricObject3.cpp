@@ -1,6 +1,15 @@
 #include "LibMath/GeometricObject3.h"
 #include "LibMath/Matrix4Vector4Operation.h"
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+// no vptr : stored and serialized as plain float arrays
+static_assert(sizeof(LibMath::Geometry3D::Point) == 3 * sizeof(float) && std::is_standard_layout_v<LibMath::Geometry3D::Point>);
+static_assert(sizeof(LibMath::Geometry3D::Sphere) == 4 * sizeof(float) && std::is_standard_layout_v<LibMath::Geometry3D::Sphere>);
+
 #pragma region Point 3D
 
 LibMath::Geometry3D::Point::Point(const float x, const float y, const float z)
@@ -38,7 +47,7 @@ LibMath::Vector3 LibMath::Geometry3D::Point::toVector3(void) const
 	return  LibMath::Vector3(m_x, m_y, m_z);
 }
 
-void LibMath::Geometry3D::Point::update(LibMath::Matrix4& transMat)
+void LibMath::Geometry3D::Point::update(LibMath::Matrix4 const& transMat)
 {
 	LibMath::Vector4 vecPoint(toVector3());
 
@@ -125,7 +134,7 @@ LibMath::Geometry3D::Line LibMath::Geometry3D::Line::operator*(const float& scal
 	return line;
 }
 
-void LibMath::Geometry3D::Line::update(LibMath::Matrix4& transMat)
+void LibMath::Geometry3D::Line::update(LibMath::Matrix4 const& transMat)
 {
 	LibMath::Vector4 vecPoint(m_origin.toVector3());
 
@@ -161,6 +170,11 @@ LibMath::Geometry3D::Plan& LibMath::Geometry3D::Plan::operator=(const Plan& othe
 
 	return *this;
 }
+
+void LibMath::Geometry3D::Plan::update(LibMath::Matrix4 const&)
+{
+	// Shapes without a position (Plan) are left unchanged
+}
 #pragma endregion All functions Plan 3D
 
 #pragma region AABB 3D
@@ -191,7 +205,7 @@ LibMath::Geometry3D::AABB& LibMath::Geometry3D::AABB::operator=(const AABB& othe
 	return *this;
 }
 
-void LibMath::Geometry3D::AABB::update(LibMath::Matrix4& transMat)
+void LibMath::Geometry3D::AABB::update(LibMath::Matrix4 const& transMat)
 {
 	LibMath::Vector4 vecPoint(m_center.toVector3());
 
@@ -227,8 +241,17 @@ LibMath::Geometry3D::OBB::OBB(const Point& center, const float& width, const flo
 	m_width = width;
 	m_height = height;
 	m_depth = depth;
-	m_rotation = rotation;
+	m_rotation = Quaternion(rotation, LibMath::Vector3(0.f, 0.f, 1.f));
+
+}
 
+LibMath::Geometry3D::OBB::OBB(const Point& center, const float& width, const float& height, const float& depth, const Quaternion& rotation)
+{
+	m_center = center;
+	m_width = width;
+	m_height = height;
+	m_depth = depth;
+	m_rotation = rotation;
 }
 
 LibMath::Geometry3D::OBB::OBB(const OBB& other)
@@ -240,7 +263,7 @@ LibMath::Geometry3D::OBB::OBB(const OBB& other)
 	m_rotation = other.m_rotation;
 }
 
-void LibMath::Geometry3D::OBB::update(LibMath::Matrix4& transMat)
+void LibMath::Geometry3D::OBB::update(LibMath::Matrix4 const& transMat)
 {
 	LibMath::Vector4 vecPoint(m_center.toVector3());
 
@@ -249,6 +272,25 @@ void LibMath::Geometry3D::OBB::update(LibMath::Matrix4& transMat)
 	m_center.m_x = transformedPoint.m_x;
 	m_center.m_y = transformedPoint.m_y;
 	m_center.m_z = transformedPoint.m_z;
+
+	// The scale is dropped and a mirror flips the X axis, see Matrix4::decompose
+	LibMath::Vector3 translation;
+	LibMath::Quaternion rotation = LibMath::Quaternion::identity();
+	LibMath::Vector3 scale;
+
+	try
+	{
+		transMat.decompose(translation, rotation, scale);
+	}
+	catch (std::runtime_error const&)
+	{
+		// A flattened matrix has no rotation to keep
+		rotation = LibMath::Quaternion::identity();
+	}
+
+	// Renormalized so the error does not build up over the frames
+	m_rotation = rotation * m_rotation;
+	m_rotation.normalize();
 }
 
 LibMath::Geometry3D::OBB& LibMath::Geometry3D::OBB::operator=(const OBB& other)
@@ -262,6 +304,28 @@ LibMath::Geometry3D::OBB& LibMath::Geometry3D::OBB::operator=(const OBB& other)
 	return *this;
 }
 
+void LibMath::Geometry3D::OBB::getAxes(LibMath::Vector3& axisX, LibMath::Vector3& axisY, LibMath::Vector3& axisZ) const
+{
+	// The columns of Quaternion::toMatrix, without its normalization since m_rotation is unit
+	float x2 = m_rotation.m_x * 2.f;
+	float y2 = m_rotation.m_y * 2.f;
+	float z2 = m_rotation.m_z * 2.f;
+
+	float wx = m_rotation.m_w * x2;
+	float wy = m_rotation.m_w * y2;
+	float wz = m_rotation.m_w * z2;
+	float xx = m_rotation.m_x * x2;
+	float xy = m_rotation.m_x * y2;
+	float xz = m_rotation.m_x * z2;
+	float yy = m_rotation.m_y * y2;
+	float yz = m_rotation.m_y * z2;
+	float zz = m_rotation.m_z * z2;
+
+	axisX = LibMath::Vector3(1.f - (yy + zz), xy + wz, xz - wy);
+	axisY = LibMath::Vector3(xy - wz, 1.f - (xx + zz), yz + wx);
+	axisZ = LibMath::Vector3(xz + wy, yz - wx, 1.f - (xx + yy));
+}
+
 
 #pragma endregion All function OBB
 
@@ -279,7 +343,7 @@ LibMath::Geometry3D::Sphere::Sphere(const Sphere& other)
 	m_radius = other.m_radius;
 }
 
-void LibMath::Geometry3D::Sphere::update(LibMath::Matrix4& transMat)
+void LibMath::Geometry3D::Sphere::update(LibMath::Matrix4 const& transMat)
 {
 	LibMath::Vector4 vecPoint(m_center.toVector3());
 
@@ -315,7 +379,7 @@ LibMath::Geometry3D::Capsule::Capsule(const Capsule& other)
 	m_radius = other.m_radius;
 }
 
-void LibMath::Geometry3D::Capsule::update(LibMath::Matrix4& transMat)
+void LibMath::Geometry3D::Capsule::update(LibMath::Matrix4 const& transMat)
 {
 	LibMath::Vector4 vecPointA(m_pointA.toVector3());
 	LibMath::Vector4 vecPointB(m_pointB.toVector3());
@@ -343,6 +407,23 @@ LibMath::Geometry3D::Capsule& LibMath::Geometry3D::Capsule::operator=(const Caps
 
 #pragma endregion
 
+#pragma region ConvexHull 3D
+
+LibMath::Geometry3D::ConvexHull::ConvexHull(std::vector<Point> const& points)
+{
+	m_points = points;
+}
+
+void LibMath::Geometry3D::ConvexHull::update(LibMath::Matrix4 const& transMat)
+{
+	for (Point& point : m_points)
+	{
+		point.update(transMat);
+	}
+}
+
+#pragma endregion All function ConvexHull
+
 LibMath::Geometry3D::Point LibMath::Geometry3D::getClosestToAABB(const LibMath::Geometry3D::AABB& aabb, const Point& p)
 {
 	float aabbMinX = aabb.m_center.m_x - aabb.extentX();
@@ -375,3 +456,181 @@ LibMath::Geometry3D::Point LibMath::Geometry3D::getClosestToSegment(const Point&
 		a.m_y + t * ab.m_y,
 		a.m_z + t * ab.m_z);
 }
+
+LibMath::Geometry3D::AABB LibMath::Geometry3D::getBoundingAABB(const Point& point)
+{
+	return AABB(point, 0.f, 0.f, 0.f);
+}
+
+LibMath::Geometry3D::AABB LibMath::Geometry3D::getBoundingAABB(const Line& line)
+{
+	Point end(line.m_origin.toVector3() + line.m_direction * line.m_length);
+
+	Point center((line.m_origin.m_x + end.m_x) * 0.5f, (line.m_origin.m_y + end.m_y) * 0.5f, (line.m_origin.m_z + end.m_z) * 0.5f);
+
+	return AABB(center, std::abs(end.m_x - line.m_origin.m_x), std::abs(end.m_y - line.m_origin.m_y), std::abs(end.m_z - line.m_origin.m_z));
+}
+
+LibMath::Geometry3D::AABB LibMath::Geometry3D::getBoundingAABB(const AABB& aabb)
+{
+	return aabb;
+}
+
+LibMath::Geometry3D::AABB LibMath::Geometry3D::getBoundingAABB(const OBB& obb)
+{
+	// Each half size projected on the world axes, |R| times the half sizes
+	LibMath::Vector3 axisX, axisY, axisZ;
+	obb.getAxes(axisX, axisY, axisZ);
+
+	float width = std::abs(axisX.m_x) * obb.m_width + std::abs(axisY.m_x) * obb.m_height + std::abs(axisZ.m_x) * obb.m_depth;
+	float height = std::abs(axisX.m_y) * obb.m_width + std::abs(axisY.m_y) * obb.m_height + std::abs(axisZ.m_y) * obb.m_depth;
+	float depth = std::abs(axisX.m_z) * obb.m_width + std::abs(axisY.m_z) * obb.m_height + std::abs(axisZ.m_z) * obb.m_depth;
+
+	return AABB(obb.m_center, width, height, depth);
+}
+
+LibMath::Geometry3D::AABB LibMath::Geometry3D::getBoundingAABB(const Sphere& sphere)
+{
+	float diameter = 2.f * sphere.m_radius;
+
+	return AABB(sphere.m_center, diameter, diameter, diameter);
+}
+
+LibMath::Geometry3D::AABB LibMath::Geometry3D::getBoundingAABB(const Capsule& capsule)
+{
+	const Point& a = capsule.m_pointA;
+	const Point& b = capsule.m_pointB;
+
+	float diameter = 2.f * capsule.m_radius;
+
+	Point center((a.m_x + b.m_x) * 0.5f, (a.m_y + b.m_y) * 0.5f, (a.m_z + b.m_z) * 0.5f);
+
+	return AABB(center, std::abs(b.m_x - a.m_x) + diameter, std::abs(b.m_y - a.m_y) + diameter, std::abs(b.m_z - a.m_z) + diameter);
+}
+
+LibMath::Geometry3D::AABB LibMath::Geometry3D::getBoundingAABB(const ConvexHull& hull)
+{
+	if (hull.m_points.empty())
+	{
+		throw std::invalid_argument("Error: convex hull has no point");
+	}
+
+	LibMath::Vector3 min = hull.m_points[0].toVector3();
+	LibMath::Vector3 max = min;
+
+	for (const Point& point : hull.m_points)
+	{
+		min = LibMath::Vector3(std::min(min.m_x, point.m_x), std::min(min.m_y, point.m_y), std::min(min.m_z, point.m_z));
+		max = LibMath::Vector3(std::max(max.m_x, point.m_x), std::max(max.m_y, point.m_y), std::max(max.m_z, point.m_z));
+	}
+
+	LibMath::Vector3 size = max - min;
+
+	return AABB(Point((min + max) * 0.5f), size.m_x, size.m_y, size.m_z);
+}
+
+LibMath::Geometry3D::AABB LibMath::Geometry3D::getBoundingAABB(const Shape& shape)
+{
+	return std::visit([](auto const& alternative) -> AABB
+	{
+		if constexpr (std::is_same_v<std::decay_t<decltype(alternative)>, Plan>)
+		{
+			throw std::invalid_argument("Error: shape has no finite bounding box");
+		}
+		else
+		{
+			return getBoundingAABB(alternative);
+		}
+	}, shape);
+}
+
+void LibMath::Geometry3D::update(Shape& shape, LibMath::Matrix4 const& transMat)
+{
+	std::visit([&transMat](auto& alternative) { alternative.update(transMat); }, shape);
+}
+
+LibMath::Vector3 LibMath::Geometry3D::getSupportPoint(const Point& point, const LibMath::Vector3&)
+{
+	return point.toVector3();
+}
+
+LibMath::Vector3 LibMath::Geometry3D::getSupportPoint(const Line& line, const LibMath::Vector3& direction)
+{
+	// One of the end points, the origin when the segment is orthogonal to the direction
+	LibMath::Vector3 segment = line.m_direction * line.m_length;
+
+	return segment.dot(direction) > 0.f ? line.m_origin.toVector3() + segment : line.m_origin.toVector3();
+}
+
+LibMath::Vector3 LibMath::Geometry3D::getSupportPoint(const AABB& aabb, const LibMath::Vector3& direction)
+{
+	return LibMath::Vector3(aabb.m_center.m_x + (direction.m_x < 0.f ? -aabb.extentX() : aabb.extentX()),
+		aabb.m_center.m_y + (direction.m_y < 0.f ? -aabb.extentY() : aabb.extentY()),
+		aabb.m_center.m_z + (direction.m_z < 0.f ? -aabb.extentZ() : aabb.extentZ()));
+}
+
+LibMath::Vector3 LibMath::Geometry3D::getSupportPoint(const OBB& obb, const LibMath::Vector3& direction)
+{
+	LibMath::Vector3 axisX, axisY, axisZ;
+	obb.getAxes(axisX, axisY, axisZ);
+
+	float halfX = direction.dot(axisX) < 0.f ? -0.5f * obb.m_width : 0.5f * obb.m_width;
+	float halfY = direction.dot(axisY) < 0.f ? -0.5f * obb.m_height : 0.5f * obb.m_height;
+	float halfZ = direction.dot(axisZ) < 0.f ? -0.5f * obb.m_depth : 0.5f * obb.m_depth;
+
+	return obb.m_center.toVector3() + axisX * halfX + axisY * halfY + axisZ * halfZ;
+}
+
+LibMath::Vector3 LibMath::Geometry3D::getSupportPoint(const Sphere& sphere, const LibMath::Vector3& direction)
+{
+	float length = direction.magnitude();
+
+	if (length == 0.f)
+	{
+		return sphere.m_center.toVector3();
+	}
+
+	return sphere.m_center.toVector3() + direction * (sphere.m_radius / length);
+}
+
+LibMath::Vector3 LibMath::Geometry3D::getSupportPoint(const Capsule& capsule, const LibMath::Vector3& direction)
+{
+	// The end point farther along the direction, pushed out by the radius
+	LibMath::Vector3 pointA = capsule.m_pointA.toVector3();
+	LibMath::Vector3 pointB = capsule.m_pointB.toVector3();
+	LibMath::Vector3 end = (pointB - pointA).dot(direction) > 0.f ? pointB : pointA;
+
+	float length = direction.magnitude();
+
+	if (length == 0.f)
+	{
+		return end;
+	}
+
+	return end + direction * (capsule.m_radius / length);
+}
+
+LibMath::Vector3 LibMath::Geometry3D::getSupportPoint(const ConvexHull& hull, const LibMath::Vector3& direction)
+{
+	if (hull.m_points.empty())
+	{
+		throw std::invalid_argument("Error: convex hull has no point");
+	}
+
+	// Linear scan, fine for the few dozen points of a collision hull
+	const Point* best = &hull.m_points[0];
+	float bestDistance = best->toVector3().dot(direction);
+
+	for (const Point& point : hull.m_points)
+	{
+		float distance = point.m_x * direction.m_x + point.m_y * direction.m_y + point.m_z * direction.m_z;
+
+		if (distance > bestDistance)
+		{
+			bestDistance = distance;
+			best = &point;
+		}
+	}
+
+	return best->toVector3();
+}
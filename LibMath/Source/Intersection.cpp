@@ -0,0 +1,676 @@
+#include "LibMath/Intersection.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+/*
+* Every shape is reduced once to the data its ray test needs, so the single ray functions
+* and the packets share the same kernels and a packet only pays the shape setup once
+*/
+
+#pragma region Shape data
+
+namespace
+{
+	struct SphereData
+	{
+		LibMath::Vector3	m_center;
+		float				m_radius = 0.f;
+	};
+
+	struct BoxData
+	{
+		LibMath::Vector3	m_min;
+		LibMath::Vector3	m_max;
+	};
+
+	struct OrientedBoxData
+	{
+		LibMath::Vector3	m_center;
+		LibMath::Vector3	m_halfSize;
+		LibMath::Vector3	m_axisX;			// unit local axes in world space
+		LibMath::Vector3	m_axisY;
+		LibMath::Vector3	m_axisZ;
+	};
+
+	struct CapsuleData
+	{
+		LibMath::Vector3	m_pointA;
+		LibMath::Vector3	m_pointB;
+		LibMath::Vector3	m_axis;				// B - A
+		float				m_axisSquared = 0.f;
+		float				m_radius = 0.f;
+	};
+
+	struct PlaneData
+	{
+		LibMath::Vector3	m_normal;			// unit normal
+		float				m_distance = 0.f;
+	};
+
+	struct TriangleData
+	{
+		LibMath::Vector3	m_a;
+		LibMath::Vector3	m_edge1;
+		LibMath::Vector3	m_edge2;
+		LibMath::Vector3	m_normal;
+	};
+}
+
+static SphereData toData(LibMath::Geometry3D::Sphere const& sphere)
+{
+	return SphereData{ sphere.m_center.toVector3(), sphere.m_radius };
+}
+
+static BoxData toData(LibMath::Geometry3D::AABB const& aabb)
+{
+	LibMath::Vector3 extent(aabb.extentX(), aabb.extentY(), aabb.extentZ());
+
+	return BoxData{ aabb.m_center.toVector3() - extent, aabb.m_center.toVector3() + extent };
+}
+
+static OrientedBoxData toData(LibMath::Geometry3D::OBB const& obb)
+{
+	OrientedBoxData data;
+	data.m_center = obb.m_center.toVector3();
+	data.m_halfSize = LibMath::Vector3(obb.m_width * 0.5f, obb.m_height * 0.5f, obb.m_depth * 0.5f);
+	obb.getAxes(data.m_axisX, data.m_axisY, data.m_axisZ);
+
+	return data;
+}
+
+static CapsuleData toData(LibMath::Geometry3D::Capsule const& capsule)
+{
+	LibMath::Vector3 pointA = capsule.m_pointA.toVector3();
+	LibMath::Vector3 pointB = capsule.m_pointB.toVector3();
+	LibMath::Vector3 axis = pointB - pointA;
+
+	return CapsuleData{ pointA, pointB, axis, axis.dot(axis), capsule.m_radius };
+}
+
+static PlaneData toData(LibMath::Geometry3D::Plan const& plan)
+{
+	float length = plan.m_normal.magnitude();
+
+	if (length == 0.f)
+	{
+		throw std::invalid_argument("Error: plan normal is a zero vector");
+	}
+
+	// Same convention as checkCollisionPlanPoint, the distance is along the unit normal
+	return PlaneData{ plan.m_normal / length, plan.m_distance };
+}
+
+static TriangleData toData(LibMath::Vector3 const& a, LibMath::Vector3 const& b, LibMath::Vector3 const& c)
+{
+	LibMath::Vector3 edge1 = b - a;
+	LibMath::Vector3 edge2 = c - a;
+	LibMath::Vector3 normal = edge1.cross(edge2);
+
+	float length = normal.magnitude();
+
+	// Degenerate triangles keep a zero normal and are never hit
+	if (length != 0.f)
+	{
+		normal /= length;
+	}
+
+	return TriangleData{ a, edge1, edge2, normal };
+}
+
+#pragma endregion
+
+#pragma region Ray kernels
+
+/*
+* Kernels work on the origin and unit direction, fill t and normal and return false on a miss
+* The hit point is origin + direction * t, computed by the caller
+*/
+
+static bool intersect(LibMath::Vector3 const& origin, LibMath::Vector3 const& direction, SphereData const& sphere, float maxDistance, float& t, LibMath::Vector3& normal)
+{
+	LibMath::Vector3 centerToOrigin = origin - sphere.m_center;
+
+	float b = centerToOrigin.dot(direction);
+	float c = centerToOrigin.dot(centerToOrigin) - sphere.m_radius * sphere.m_radius;
+
+	if (c <= 0.f)
+	{
+		// Origin inside the sphere
+		t = 0.f;
+		normal = -direction;
+		return true;
+	}
+
+	// Outside and pointing away
+	if (b > 0.f)
+	{
+		return false;
+	}
+
+	float discriminant = b * b - c;
+
+	if (discriminant < 0.f)
+	{
+		return false;
+	}
+
+	t = -b - std::sqrt(discriminant);
+
+	if (t > maxDistance)
+	{
+		return false;
+	}
+
+	normal = (centerToOrigin + direction * t) / sphere.m_radius;
+	return true;
+}
+
+static bool intersect(LibMath::Vector3 const& origin, LibMath::Vector3 const& direction, BoxData const& box, float maxDistance, float& t, LibMath::Vector3& normal)
+{
+	float tEnter = -std::numeric_limits<float>::infinity();
+	float tExit = std::numeric_limits<float>::infinity();
+	int enterAxis = -1;
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		float rayOrigin = origin[axis];
+		float rayDirection = direction[axis];
+
+		if (rayDirection == 0.f)
+		{
+			// Parallel to the slab, the origin must be between its planes
+			if (rayOrigin < box.m_min[axis] || rayOrigin > box.m_max[axis])
+			{
+				return false;
+			}
+			continue;
+		}
+
+		float inverseDirection = 1.f / rayDirection;
+		float t1 = (box.m_min[axis] - rayOrigin) * inverseDirection;
+		float t2 = (box.m_max[axis] - rayOrigin) * inverseDirection;
+
+		if (t1 > t2)
+		{
+			std::swap(t1, t2);
+		}
+
+		if (t1 > tEnter)
+		{
+			tEnter = t1;
+			enterAxis = axis;
+		}
+
+		tExit = std::min(tExit, t2);
+
+		if (tEnter > tExit || tExit < 0.f)
+		{
+			return false;
+		}
+	}
+
+	if (tEnter > maxDistance)
+	{
+		return false;
+	}
+
+	if (tEnter <= 0.f)
+	{
+		// Origin inside the box
+		t = 0.f;
+		normal = -direction;
+		return true;
+	}
+
+	t = tEnter;
+	normal = LibMath::Vector3::zero();
+	normal[enterAxis] = direction[enterAxis] > 0.f ? -1.f : 1.f;
+	return true;
+}
+
+static bool intersect(LibMath::Vector3 const& origin, LibMath::Vector3 const& direction, OrientedBoxData const& box, float maxDistance, float& t, LibMath::Vector3& normal)
+{
+	// Work in the box frame, the transposed rotation brings the ray in
+	LibMath::Vector3 offset = origin - box.m_center;
+
+	LibMath::Vector3 localOrigin(offset.dot(box.m_axisX), offset.dot(box.m_axisY), offset.dot(box.m_axisZ));
+	LibMath::Vector3 localDirection(direction.dot(box.m_axisX), direction.dot(box.m_axisY), direction.dot(box.m_axisZ));
+
+	LibMath::Vector3 localNormal;
+
+	if (!intersect(localOrigin, localDirection, BoxData{ -box.m_halfSize, box.m_halfSize }, maxDistance, t, localNormal))
+	{
+		return false;
+	}
+
+	normal = box.m_axisX * localNormal.m_x + box.m_axisY * localNormal.m_y + box.m_axisZ * localNormal.m_z;
+	return true;
+}
+
+static bool intersect(LibMath::Vector3 const& origin, LibMath::Vector3 const& direction, CapsuleData const& capsule, float maxDistance, float& t, LibMath::Vector3& normal)
+{
+	float radiusSquared = capsule.m_radius * capsule.m_radius;
+
+	LibMath::Vector3 originToA = origin - capsule.m_pointA;
+
+	float axisDotDirection = capsule.m_axis.dot(direction);
+	float axisDotOrigin = capsule.m_axis.dot(originToA);
+
+	// Origin inside the capsule
+	float along = capsule.m_axisSquared > 0.f ? std::clamp(axisDotOrigin / capsule.m_axisSquared, 0.f, 1.f) : 0.f;
+	LibMath::Vector3 closestOnAxis = capsule.m_pointA + capsule.m_axis * along;
+
+	if ((origin - closestOnAxis).magnitudeSquared() <= radiusSquared)
+	{
+		t = 0.f;
+		normal = -direction;
+		return true;
+	}
+
+	// Infinite cylinder around the axis : a t^2 + 2 b t + c = 0, scaled by the squared axis length
+	float a = capsule.m_axisSquared - axisDotDirection * axisDotDirection;
+	float b = capsule.m_axisSquared * direction.dot(originToA) - axisDotOrigin * axisDotDirection;
+	float c = capsule.m_axisSquared * originToA.dot(originToA) - axisDotOrigin * axisDotOrigin - radiusSquared * capsule.m_axisSquared;
+
+	float height = axisDotOrigin;
+	float hitT = std::numeric_limits<float>::infinity();
+
+	// Nearly parallel rays would divide by almost zero, the caps handle them
+	if (a > 1e-6f * capsule.m_axisSquared)
+	{
+		float discriminant = b * b - a * c;
+
+		if (discriminant < 0.f)
+		{
+			return false;
+		}
+
+		hitT = (-b - std::sqrt(discriminant)) / a;
+		height = axisDotOrigin + hitT * axisDotDirection;
+
+		if (height > 0.f && height < capsule.m_axisSquared)
+		{
+			if (hitT < 0.f || hitT > maxDistance)
+			{
+				return false;
+			}
+
+			t = hitT;
+			LibMath::Vector3 point = originToA + direction * t;
+			normal = (point - capsule.m_axis * (height / capsule.m_axisSquared)) / capsule.m_radius;
+			return true;
+		}
+	}
+
+	// Cylinder missed between the end points (or ray along the axis), hit the cap sphere on that side
+	SphereData cap{ height <= 0.f ? capsule.m_pointA : capsule.m_pointB, capsule.m_radius };
+
+	return intersect(origin, direction, cap, maxDistance, t, normal);
+}
+
+static bool intersect(LibMath::Vector3 const& origin, LibMath::Vector3 const& direction, PlaneData const& plane, float maxDistance, float& t, LibMath::Vector3& normal)
+{
+	float signedDistance = plane.m_normal.dot(origin) - plane.m_distance;
+	float approach = plane.m_normal.dot(direction);
+
+	if (signedDistance == 0.f)
+	{
+		t = 0.f;
+		normal = approach < 0.f ? plane.m_normal : -plane.m_normal;
+		return true;
+	}
+
+	if (approach == 0.f)
+	{
+		return false;
+	}
+
+	t = -signedDistance / approach;
+
+	if (t < 0.f || t > maxDistance)
+	{
+		return false;
+	}
+
+	// Facing the side the ray comes from
+	normal = signedDistance > 0.f ? plane.m_normal : -plane.m_normal;
+	return true;
+}
+
+static bool intersect(LibMath::Vector3 const& origin, LibMath::Vector3 const& direction, TriangleData const& triangle, float maxDistance, float& t, LibMath::Vector3& normal)
+{
+	// Moller-Trumbore
+	LibMath::Vector3 p = direction.cross(triangle.m_edge2);
+	float determinant = triangle.m_edge1.dot(p);
+
+	if (determinant == 0.f)
+	{
+		return false;
+	}
+
+	float inverseDeterminant = 1.f / determinant;
+
+	LibMath::Vector3 aToOrigin = origin - triangle.m_a;
+	float u = aToOrigin.dot(p) * inverseDeterminant;
+
+	if (u < 0.f || u > 1.f)
+	{
+		return false;
+	}
+
+	LibMath::Vector3 q = aToOrigin.cross(triangle.m_edge1);
+	float v = direction.dot(q) * inverseDeterminant;
+
+	if (v < 0.f || u + v > 1.f)
+	{
+		return false;
+	}
+
+	float hitT = triangle.m_edge2.dot(q) * inverseDeterminant;
+
+	if (hitT < 0.f || hitT > maxDistance)
+	{
+		return false;
+	}
+
+	t = hitT;
+	normal = triangle.m_normal.dot(direction) > 0.f ? -triangle.m_normal : triangle.m_normal;
+	return true;
+}
+
+template <typename ShapeData>
+static bool raycastShape(LibMath::Geometry3D::Line const& ray, ShapeData const& shape, LibMath::Intersection3D::RaycastHit& hit, float maxDistance)
+{
+	LibMath::Vector3 origin = ray.m_origin.toVector3();
+	float t;
+	LibMath::Vector3 normal;
+
+	if (!intersect(origin, ray.m_direction, shape, maxDistance, t, normal))
+	{
+		return false;
+	}
+
+	hit.m_t = t;
+	hit.m_point = LibMath::Geometry3D::Point(origin + ray.m_direction * t);
+	hit.m_normal = normal;
+	return true;
+}
+
+template <typename ShapeData>
+static size_t raycastPacket(std::span<LibMath::Geometry3D::Line const> rays, ShapeData const& shape, std::span<LibMath::Intersection3D::RaycastHit> hits, float maxDistance)
+{
+	if (rays.size() != hits.size())
+	{
+		throw std::invalid_argument("Error: rays and hits must have the same size");
+	}
+
+	size_t hitCount = 0;
+
+	for (size_t i = 0; i < rays.size(); ++i)
+	{
+		if (raycastShape(rays[i], shape, hits[i], maxDistance))
+		{
+			++hitCount;
+		}
+		else
+		{
+			hits[i].m_t = LibMath::Intersection3D::noHit;
+		}
+	}
+
+	return hitCount;
+}
+
+#pragma endregion
+
+#pragma region Raycast
+
+bool LibMath::Intersection3D::raycast(Geometry3D::Line const& ray, Geometry3D::Sphere const& sphere, RaycastHit& hit, float const maxDistance)
+{
+	return raycastShape(ray, toData(sphere), hit, maxDistance);
+}
+
+bool LibMath::Intersection3D::raycast(Geometry3D::Line const& ray, Geometry3D::AABB const& aabb, RaycastHit& hit, float const maxDistance)
+{
+	return raycastShape(ray, toData(aabb), hit, maxDistance);
+}
+
+bool LibMath::Intersection3D::raycast(Geometry3D::Line const& ray, Geometry3D::OBB const& obb, RaycastHit& hit, float const maxDistance)
+{
+	return raycastShape(ray, toData(obb), hit, maxDistance);
+}
+
+bool LibMath::Intersection3D::raycast(Geometry3D::Line const& ray, Geometry3D::Capsule const& capsule, RaycastHit& hit, float const maxDistance)
+{
+	return raycastShape(ray, toData(capsule), hit, maxDistance);
+}
+
+bool LibMath::Intersection3D::raycast(Geometry3D::Line const& ray, Geometry3D::Plan const& plan, RaycastHit& hit, float const maxDistance)
+{
+	return raycastShape(ray, toData(plan), hit, maxDistance);
+}
+
+bool LibMath::Intersection3D::raycast(Geometry3D::Line const& ray, Vector3 const& a, Vector3 const& b, Vector3 const& c, RaycastHit& hit, float const maxDistance)
+{
+	return raycastShape(ray, toData(a, b, c), hit, maxDistance);
+}
+
+size_t LibMath::Intersection3D::raycast(std::span<Geometry3D::Line const> rays, Geometry3D::Sphere const& sphere, std::span<RaycastHit> hits, float const maxDistance)
+{
+	return raycastPacket(rays, toData(sphere), hits, maxDistance);
+}
+
+size_t LibMath::Intersection3D::raycast(std::span<Geometry3D::Line const> rays, Geometry3D::AABB const& aabb, std::span<RaycastHit> hits, float const maxDistance)
+{
+	return raycastPacket(rays, toData(aabb), hits, maxDistance);
+}
+
+size_t LibMath::Intersection3D::raycast(std::span<Geometry3D::Line const> rays, Geometry3D::OBB const& obb, std::span<RaycastHit> hits, float const maxDistance)
+{
+	return raycastPacket(rays, toData(obb), hits, maxDistance);
+}
+
+size_t LibMath::Intersection3D::raycast(std::span<Geometry3D::Line const> rays, Geometry3D::Capsule const& capsule, std::span<RaycastHit> hits, float const maxDistance)
+{
+	return raycastPacket(rays, toData(capsule), hits, maxDistance);
+}
+
+size_t LibMath::Intersection3D::raycast(std::span<Geometry3D::Line const> rays, Geometry3D::Plan const& plan, std::span<RaycastHit> hits, float const maxDistance)
+{
+	return raycastPacket(rays, toData(plan), hits, maxDistance);
+}
+
+size_t LibMath::Intersection3D::raycast(std::span<Geometry3D::Line const> rays, Vector3 const& a, Vector3 const& b, Vector3 const& c, std::span<RaycastHit> hits, float const maxDistance)
+{
+	return raycastPacket(rays, toData(a, b, c), hits, maxDistance);
+}
+
+#pragma endregion
+
+#pragma region Sweep
+
+/*
+* Cast the path of the moving center against the grown shape, the ray is as long as the velocity
+* A zero velocity still reports a start overlap : the kernels hit at t = 0 from inside whatever the direction
+*/
+template <typename ShapeData>
+static bool sweepCenter(LibMath::Vector3 const& center, LibMath::Vector3 const& velocity, ShapeData const& shape, float& time, LibMath::Vector3& normal)
+{
+	float length = velocity.magnitude();
+	LibMath::Vector3 direction = length > 0.f ? velocity / length : LibMath::Vector3(1.f, 0.f, 0.f);
+	float t;
+
+	if (!intersect(center, direction, shape, length, t, normal))
+	{
+		return false;
+	}
+
+	time = length > 0.f ? std::min(t / length, 1.f) : 0.f;
+	return true;
+}
+
+static void setSweepHit(LibMath::Intersection3D::SweepHit& hit, float time, LibMath::Vector3 const& point, LibMath::Vector3 const& normal)
+{
+	hit.m_time = time;
+	hit.m_point = LibMath::Geometry3D::Point(point);
+	hit.m_normal = normal;
+}
+
+bool LibMath::Intersection3D::sweep(Geometry3D::Sphere const& sphere, Vector3 const& velocity, Geometry3D::Sphere const& other, SweepHit& hit)
+{
+	Vector3 center = sphere.m_center.toVector3();
+	SphereData grown{ other.m_center.toVector3(), sphere.m_radius + other.m_radius };
+	float time;
+	Vector3 normal;
+
+	if (!sweepCenter(center, velocity, grown, time, normal))
+	{
+		return false;
+	}
+
+	setSweepHit(hit, time, center + velocity * time - normal * sphere.m_radius, normal);
+	return true;
+}
+
+bool LibMath::Intersection3D::sweep(Geometry3D::Sphere const& sphere, Vector3 const& velocity, Geometry3D::AABB const& aabb, SweepHit& hit)
+{
+	// The box grown by the sphere has rounded edges and corners, the square box around it is only exact on the faces
+	Vector3 center = sphere.m_center.toVector3();
+	float radius = sphere.m_radius;
+	BoxData box = toData(aabb);
+	BoxData grown{ box.m_min - Vector3(radius), box.m_max + Vector3(radius) };
+	float time;
+	Vector3 normal;
+
+	if (!sweepCenter(center, velocity, grown, time, normal))
+	{
+		return false;
+	}
+
+	// Region of the entry point : in front of a face, of an edge (2 axes out) or of a corner (3 axes out)
+	Vector3 entry = center + velocity * time;
+	Vector3 corner = box.m_min;
+	int outsideCount = 0;
+	int insideAxis = 0;
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		if (entry[axis] < box.m_min[axis] || entry[axis] > box.m_max[axis])
+		{
+			corner[axis] = entry[axis] < box.m_min[axis] ? box.m_min[axis] : box.m_max[axis];
+			++outsideCount;
+		}
+		else
+		{
+			insideAxis = axis;
+		}
+	}
+
+	if (outsideCount >= 2)
+	{
+		// The edge of that region, or the 3 edges of that corner, grown into capsules
+		bool found = false;
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (outsideCount == 2 && axis != insideAxis)
+			{
+				continue;
+			}
+
+			Vector3 end = corner;
+			end[axis] = corner[axis] == box.m_min[axis] ? box.m_max[axis] : box.m_min[axis];
+
+			Vector3 edgeAxis = end - corner;
+			CapsuleData edge{ corner, end, edgeAxis, edgeAxis.dot(edgeAxis), radius };
+			float edgeTime;
+			Vector3 edgeNormal;
+
+			if (sweepCenter(center, velocity, edge, edgeTime, edgeNormal) && (!found || edgeTime < time))
+			{
+				time = edgeTime;
+				normal = edgeNormal;
+				found = true;
+			}
+		}
+
+		if (!found)
+		{
+			return false;
+		}
+	}
+
+	setSweepHit(hit, time, center + velocity * time - normal * radius, normal);
+	return true;
+}
+
+bool LibMath::Intersection3D::sweep(Geometry3D::Sphere const& sphere, Vector3 const& velocity, Geometry3D::Capsule const& capsule, SweepHit& hit)
+{
+	Vector3 center = sphere.m_center.toVector3();
+	CapsuleData grown = toData(capsule);
+	grown.m_radius += sphere.m_radius;
+	float time;
+	Vector3 normal;
+
+	if (!sweepCenter(center, velocity, grown, time, normal))
+	{
+		return false;
+	}
+
+	setSweepHit(hit, time, center + velocity * time - normal * sphere.m_radius, normal);
+	return true;
+}
+
+bool LibMath::Intersection3D::sweep(Geometry3D::Sphere const& sphere, Vector3 const& velocity, Geometry3D::Plan const& plan, SweepHit& hit)
+{
+	Vector3 center = sphere.m_center.toVector3();
+	PlaneData plane = toData(plan);
+	float signedDistance = plane.m_normal.dot(center) - plane.m_distance;
+
+	if (std::abs(signedDistance) <= sphere.m_radius)
+	{
+		// Already touching, the normal faces the side of the center
+		Vector3 normal = signedDistance >= 0.f ? plane.m_normal : -plane.m_normal;
+		setSweepHit(hit, 0.f, center - plane.m_normal * signedDistance, normal);
+		return true;
+	}
+
+	// The plan moved toward the center by the radius, on the side the sphere comes from
+	plane.m_distance += signedDistance > 0.f ? sphere.m_radius : -sphere.m_radius;
+	float time;
+	Vector3 normal;
+
+	if (!sweepCenter(center, velocity, plane, time, normal))
+	{
+		return false;
+	}
+
+	setSweepHit(hit, time, center + velocity * time - normal * sphere.m_radius, normal);
+	return true;
+}
+
+bool LibMath::Intersection3D::sweep(Geometry3D::AABB const& aabb, Vector3 const& velocity, Geometry3D::AABB const& other, SweepHit& hit)
+{
+	Vector3 center = aabb.m_center.toVector3();
+	Vector3 extent(aabb.extentX(), aabb.extentY(), aabb.extentZ());
+	BoxData box = toData(other);
+	BoxData grown{ box.m_min - extent, box.m_max + extent };
+	float time;
+	Vector3 normal;
+
+	if (!sweepCenter(center, velocity, grown, time, normal))
+	{
+		return false;
+	}
+
+	// Point of the other box closest to the moving center, on the face that is hit
+	Vector3 moved = center + velocity * time;
+	Vector3 point(std::clamp(moved.m_x, box.m_min.m_x, box.m_max.m_x), std::clamp(moved.m_y, box.m_min.m_y, box.m_max.m_y), std::clamp(moved.m_z, box.m_min.m_z, box.m_max.m_z));
+
+	setSweepHit(hit, time, point, normal);
+	return true;
+}
+
+#pragma endregion
@@ -2,6 +2,8 @@
 #include "LibMath/Trigonometry.h"
 #include "LibMath/Matrix4Vector4Operation.h"
 #include "LibMath/Arithmetic.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Simd.h"
 
 
 #pragma region Matrix 2D
@@ -128,8 +130,7 @@ LibMath::Matrix2Dx2 LibMath::Matrix2Dx2::createRotation(Radian const& rad_) cons
 {
 
 	// Create the basic 2x2 rotation matrix
-	float cosTheta = LibMath::cos(rad_);
-	float sinTheta = LibMath::sin(rad_);
+	auto [sinTheta, cosTheta] = LibMath::sincos(rad_);
 
 	// Set the rotation matrix elements
 	return Matrix2Dx2(cosTheta, sinTheta,
@@ -147,8 +148,7 @@ LibMath::Matrix2Dx2 LibMath::Matrix2Dx2::createTransform(LibMath::Radian const&
 {
 
 	// Create the basic 2x2 rotation matrix
-	float cosTheta = LibMath::cos(rad);
-	float sinTheta = LibMath::sin(rad);
+	auto [sinTheta, cosTheta] = LibMath::sincos(rad);
 
 
 	return Matrix2Dx2(
@@ -164,38 +164,38 @@ LibMath::Matrix2Dx2 LibMath::Matrix2Dx2::identity(void) const
 
 LibMath::Matrix2Dx2 LibMath::operator+(LibMath::Matrix2Dx2 const&  m1, LibMath::Matrix2Dx2 const& m2)
 {
-	float a1 = m1[0][0] + m2[0][0];
-	float a2 = m1[0][1] + m2[0][1];
-	float a3 = m1[1][0] + m2[1][0];
-	float a4 = m1[1][1] + m2[1][1];
+	float a1 = m1.at_unchecked(0, 0) + m2.at_unchecked(0, 0);
+	float a2 = m1.at_unchecked(0, 1) + m2.at_unchecked(0, 1);
+	float a3 = m1.at_unchecked(1, 0) + m2.at_unchecked(1, 0);
+	float a4 = m1.at_unchecked(1, 1) + m2.at_unchecked(1, 1);
 
 	return LibMath::Matrix2Dx2(a1, a2, a3, a4);
 }
 
 LibMath::Matrix2Dx2 LibMath::operator*(LibMath::Matrix2Dx2 const& m1, LibMath::Matrix2Dx2 const& m2)
 {
-	float a1 = m1[0][0] * m2[0][0] + m1[1][0] * m2[0][1];
-	float a2 = m1[0][1] * m2[0][0] + m1[1][1] * m2[0][1];
-	float a3 = m1[0][0] * m2[1][0] + m1[1][0] * m2[1][1];
-	float a4 = m1[0][1] * m2[1][0] + m1[1][1] * m2[1][1];
+	float a1 = m1.at_unchecked(0, 0) * m2.at_unchecked(0, 0) + m1.at_unchecked(1, 0) * m2.at_unchecked(0, 1);
+	float a2 = m1.at_unchecked(0, 1) * m2.at_unchecked(0, 0) + m1.at_unchecked(1, 1) * m2.at_unchecked(0, 1);
+	float a3 = m1.at_unchecked(0, 0) * m2.at_unchecked(1, 0) + m1.at_unchecked(1, 0) * m2.at_unchecked(1, 1);
+	float a4 = m1.at_unchecked(0, 1) * m2.at_unchecked(1, 0) + m1.at_unchecked(1, 1) * m2.at_unchecked(1, 1);
 
 	return LibMath::Matrix2Dx2(a1, a2, a3, a4);
 }
 
 LibMath::Matrix2Dx2 LibMath::operator*(LibMath::Matrix2Dx2 const& m1, float const&  scalar)
 {
-	float a1 = scalar * m1[0][0];
-	float a2 = scalar * m1[0][1];
-	float a3 = scalar * m1[1][0];
-	float a4 = scalar * m1[1][1];
+	float a1 = scalar * m1.at_unchecked(0, 0);
+	float a2 = scalar * m1.at_unchecked(0, 1);
+	float a3 = scalar * m1.at_unchecked(1, 0);
+	float a4 = scalar * m1.at_unchecked(1, 1);
 
 	return LibMath::Matrix2Dx2(a1, a2, a3, a4);
 }
 
 LibMath::Vector2 LibMath::operator*(LibMath::Matrix2Dx2 const& m, LibMath::Vector2 const& vec)
 {
-	float a1 = m[0][0] * vec.m_x + m[1][0] * vec.m_y;
-	float a2 = m[0][1] * vec.m_x + m[1][1] * vec.m_y;
+	float a1 = m.at_unchecked(0, 0) * vec.m_x + m.at_unchecked(1, 0) * vec.m_y;
+	float a2 = m.at_unchecked(0, 1) * vec.m_x + m.at_unchecked(1, 1) * vec.m_y;
 
 	return LibMath::Vector2(a1, a2);
 }
@@ -273,7 +273,7 @@ bool LibMath::Matrix2Dx3::operator==(LibMath::Matrix2Dx3 const& m)
 	{
 		for (size_t j = 0; j < 3; j++)
 		{
-			if (m_elements[i][j] != m[i][j])
+			if (m_elements[i][j] != m.at_unchecked(i, j))
 			{
 				return false;
 			}
@@ -317,8 +317,7 @@ LibMath::Matrix2Dx3 LibMath::Matrix2Dx3::createRotation(LibMath::Geometry2D::Poi
 	const& point, LibMath::Radian const& rad)
 {
 
-	float cosR = LibMath::cos(rad);
-	float sinR = LibMath::sin(rad);
+	auto [sinR, cosR] = LibMath::sincos(rad);
 
 	Matrix2Dx3 rotation(                        cosR,                                            sinR,                    0,
 						                       -sinR,                                            cosR,                    0,
@@ -336,8 +335,7 @@ LibMath::Matrix2Dx3 LibMath::Matrix2Dx3::createScale(LibMath::Vector2 const& sca
 
 LibMath::Matrix2Dx3 LibMath::Matrix2Dx3::createTransform(LibMath::Vector2 const& translation, LibMath::Radian const& rotation, LibMath::Vector2 const& scale) 
 {
-	float cosR = LibMath::cos(rotation);
-	float sinR = LibMath::sin(rotation);
+	auto [sinR, cosR] = LibMath::sincos(rotation);
 
 	LibMath::Matrix2Dx3 translate = createTranslation(translation);
 	LibMath::Matrix2Dx3 rotate = createRotation(LibMath::Geometry2D::Point(0.f, 0.f), rotation);
@@ -359,18 +357,18 @@ LibMath::Matrix2Dx3 LibMath::operator+(Matrix2Dx3 const& m1, Matrix2Dx3 const& m
 {
 
 	return Matrix2Dx3(
-		m1[0][0] + m2[0][0], m1[0][1] + m2[0][1], m1[0][2] + m2[0][2],
-		m1[1][0] + m2[1][0], m1[1][1] + m2[1][1], m1[1][2] + m2[1][2],
-		m1[2][0] + m2[2][0], m1[2][1] + m2[2][1], m1[2][2] + m2[2][2]
+		m1.at_unchecked(0, 0) + m2.at_unchecked(0, 0), m1.at_unchecked(0, 1) + m2.at_unchecked(0, 1), m1.at_unchecked(0, 2) + m2.at_unchecked(0, 2),
+		m1.at_unchecked(1, 0) + m2.at_unchecked(1, 0), m1.at_unchecked(1, 1) + m2.at_unchecked(1, 1), m1.at_unchecked(1, 2) + m2.at_unchecked(1, 2),
+		m1.at_unchecked(2, 0) + m2.at_unchecked(2, 0), m1.at_unchecked(2, 1) + m2.at_unchecked(2, 1), m1.at_unchecked(2, 2) + m2.at_unchecked(2, 2)
 	);
 }
 
 LibMath::Matrix2Dx3 LibMath::operator*(Matrix2Dx3 const& m, float const& scalar)
 {
 	return Matrix2Dx3(
-		scalar * m[0][0], scalar * m[0][1], scalar * m[0][2],
-		scalar * m[1][0], scalar * m[1][1], scalar * m[1][2],
-		scalar * m[2][0], scalar * m[2][1], scalar * m[2][2]
+		scalar * m.at_unchecked(0, 0), scalar * m.at_unchecked(0, 1), scalar * m.at_unchecked(0, 2),
+		scalar * m.at_unchecked(1, 0), scalar * m.at_unchecked(1, 1), scalar * m.at_unchecked(1, 2),
+		scalar * m.at_unchecked(2, 0), scalar * m.at_unchecked(2, 1), scalar * m.at_unchecked(2, 2)
 	);
 }
 
@@ -378,9 +376,9 @@ LibMath::Vector3 LibMath::operator*(Matrix2Dx3 const& m, LibMath::Vector3 const&
 {
 	//column-major
 	return Vector3(
-		(m[0][0] * vec.m_x + m[1][0] * vec.m_y + m[2][0] * vec.m_z),
-		(m[0][1] * vec.m_x + m[1][1] * vec.m_y + m[2][1] * vec.m_z),
-		(m[0][2] * vec.m_x + m[1][2] * vec.m_y + m[2][2] * vec.m_z)
+		(m.at_unchecked(0, 0) * vec.m_x + m.at_unchecked(1, 0) * vec.m_y + m.at_unchecked(2, 0) * vec.m_z),
+		(m.at_unchecked(0, 1) * vec.m_x + m.at_unchecked(1, 1) * vec.m_y + m.at_unchecked(2, 1) * vec.m_z),
+		(m.at_unchecked(0, 2) * vec.m_x + m.at_unchecked(1, 2) * vec.m_y + m.at_unchecked(2, 2) * vec.m_z)
 	);
 }
 
@@ -388,17 +386,17 @@ LibMath::Matrix2Dx3 LibMath::operator*(Matrix2Dx3 const& m1, Matrix2Dx3 const& m
 {
 	// Access elements in column-major order: m[column][row]
 
-	float a1 = (m1[0][0] * m2[0][0]) + (m1[1][0] * m2[0][1]) + (m1[2][0] * m2[0][2]);
-	float a2 = (m1[0][1] * m2[0][0]) + (m1[1][1] * m2[0][1]) + (m1[2][1] * m2[0][2]);
-	float a3 = (m1[0][2] * m2[0][0]) + (m1[1][2] * m2[0][1]) + (m1[2][2] * m2[0][2]);
+	float a1 = (m1.at_unchecked(0, 0) * m2.at_unchecked(0, 0)) + (m1.at_unchecked(1, 0) * m2.at_unchecked(0, 1)) + (m1.at_unchecked(2, 0) * m2.at_unchecked(0, 2));
+	float a2 = (m1.at_unchecked(0, 1) * m2.at_unchecked(0, 0)) + (m1.at_unchecked(1, 1) * m2.at_unchecked(0, 1)) + (m1.at_unchecked(2, 1) * m2.at_unchecked(0, 2));
+	float a3 = (m1.at_unchecked(0, 2) * m2.at_unchecked(0, 0)) + (m1.at_unchecked(1, 2) * m2.at_unchecked(0, 1)) + (m1.at_unchecked(2, 2) * m2.at_unchecked(0, 2));
 
-	float a4 = (m1[0][0] * m2[1][0]) + (m1[1][0] * m2[1][1]) + (m1[2][0] * m2[1][2]);
-	float a5 = (m1[0][1] * m2[1][0]) + (m1[1][1] * m2[1][1]) + (m1[2][1] * m2[1][2]);
-	float a6 = (m1[0][2] * m2[1][0]) + (m1[1][2] * m2[1][1]) + (m1[2][2] * m2[1][2]);
+	float a4 = (m1.at_unchecked(0, 0) * m2.at_unchecked(1, 0)) + (m1.at_unchecked(1, 0) * m2.at_unchecked(1, 1)) + (m1.at_unchecked(2, 0) * m2.at_unchecked(1, 2));
+	float a5 = (m1.at_unchecked(0, 1) * m2.at_unchecked(1, 0)) + (m1.at_unchecked(1, 1) * m2.at_unchecked(1, 1)) + (m1.at_unchecked(2, 1) * m2.at_unchecked(1, 2));
+	float a6 = (m1.at_unchecked(0, 2) * m2.at_unchecked(1, 0)) + (m1.at_unchecked(1, 2) * m2.at_unchecked(1, 1)) + (m1.at_unchecked(2, 2) * m2.at_unchecked(1, 2));
 
-	float a7 = (m1[0][0] * m2[2][0]) + (m1[1][0] * m2[2][1]) + (m1[2][0] * m2[2][2]);
-	float a8 = (m1[0][1] * m2[2][0]) + (m1[1][1] * m2[2][1]) + (m1[2][1] * m2[2][2]);
-	float a9 = (m1[0][2] * m2[2][0]) + (m1[1][2] * m2[2][1]) + (m1[2][2] * m2[2][2]);
+	float a7 = (m1.at_unchecked(0, 0) * m2.at_unchecked(2, 0)) + (m1.at_unchecked(1, 0) * m2.at_unchecked(2, 1)) + (m1.at_unchecked(2, 0) * m2.at_unchecked(2, 2));
+	float a8 = (m1.at_unchecked(0, 1) * m2.at_unchecked(2, 0)) + (m1.at_unchecked(1, 1) * m2.at_unchecked(2, 1)) + (m1.at_unchecked(2, 1) * m2.at_unchecked(2, 2));
+	float a9 = (m1.at_unchecked(0, 2) * m2.at_unchecked(2, 0)) + (m1.at_unchecked(1, 2) * m2.at_unchecked(2, 1)) + (m1.at_unchecked(2, 2) * m2.at_unchecked(2, 2));
 
 	return Matrix2Dx3(a1, a2, a3, a4, a5, a6, a7, a8, a9);
 
@@ -551,9 +549,9 @@ LibMath::Matrix3 LibMath::Matrix3::cofators(void) const
 	Matrix3 minors_ = minors();
 
 	return Matrix3(
-		minors_[0][0], -minors_[0][1], minors_[0][2],
-		-minors_[1][0], minors_[1][1], -minors_[1][2],
-		minors_[2][0], -minors_[2][1], minors_[2][2]
+		minors_.at_unchecked(0, 0), -minors_.at_unchecked(0, 1), minors_.at_unchecked(0, 2),
+		-minors_.at_unchecked(1, 0), minors_.at_unchecked(1, 1), -minors_.at_unchecked(1, 2),
+		minors_.at_unchecked(2, 0), -minors_.at_unchecked(2, 1), minors_.at_unchecked(2, 2)
 	);
 }
 
@@ -572,9 +570,9 @@ LibMath::Matrix3 LibMath::Matrix3::inverse(void) const
 
 	Matrix3 adj = adjugate();
 	return Matrix3(
-		opDet * adj[0][0], opDet * adj[0][1], opDet * adj[0][2],
-		opDet * adj[1][0], opDet * adj[1][1], opDet * adj[1][2],
-		opDet * adj[2][0], opDet * adj[2][1], opDet * adj[2][2]
+		opDet * adj.at_unchecked(0, 0), opDet * adj.at_unchecked(0, 1), opDet * adj.at_unchecked(0, 2),
+		opDet * adj.at_unchecked(1, 0), opDet * adj.at_unchecked(1, 1), opDet * adj.at_unchecked(1, 2),
+		opDet * adj.at_unchecked(2, 0), opDet * adj.at_unchecked(2, 1), opDet * adj.at_unchecked(2, 2)
 	);
 }
 
@@ -588,8 +586,7 @@ LibMath::Matrix3 LibMath::Matrix3::createTranslation(LibMath::Vector2 const& tra
 LibMath::Matrix3 LibMath::Matrix3::createTransform(LibMath::Vector2 const& translate, LibMath::Radian const& rotation, LibMath::Vector2 const& scale)
 {
 	
-	float cosR = LibMath::cos(rotation);
-	float sinR = LibMath::sin(rotation);
+	auto [sinR, cosR] = LibMath::sincos(rotation);
 	
 	return Matrix3(
 		scale.m_x * cosR, scale.m_x * sinR, 0.f,
@@ -600,8 +597,7 @@ LibMath::Matrix3 LibMath::Matrix3::createTransform(LibMath::Vector2 const& trans
 
 LibMath::Matrix3 LibMath::Matrix3::createRotationX(LibMath::Radian const& angle)
 {
-	float cosR = LibMath::cos(angle);
-	float sinR = LibMath::sin(angle);
+	auto [sinR, cosR] = LibMath::sincos(angle);
 
 	return Matrix3(
 		1.f, 0.f, 0.f,
@@ -612,8 +608,7 @@ LibMath::Matrix3 LibMath::Matrix3::createRotationX(LibMath::Radian const& angle)
 
 LibMath::Matrix3 LibMath::Matrix3::createRotationY(LibMath::Radian const& angle)
 {
-	float cosR = LibMath::cos(angle);
-	float sinR = LibMath::sin(angle);
+	auto [sinR, cosR] = LibMath::sincos(angle);
 
 	return Matrix3(
 		cosR, 0.f, -sinR, 
@@ -624,8 +619,7 @@ LibMath::Matrix3 LibMath::Matrix3::createRotationY(LibMath::Radian const& angle)
 
 LibMath::Matrix3 LibMath::Matrix3::createRotationZ(LibMath::Radian const& angle)
 {
-	float cosR = LibMath::cos(angle);
-	float sinR = LibMath::sin(angle);
+	auto [sinR, cosR] = LibMath::sincos(angle);
 
 	return Matrix3(
 		cosR, sinR, 0.f,
@@ -664,18 +658,18 @@ LibMath::Matrix3 LibMath::Matrix3::identity(void)
 LibMath::Matrix3	LibMath::operator+(Matrix3 const& m1, Matrix3 const& m2)
 {
 	return Matrix3(
-		m1[0][0] + m2[0][0], m1[0][1] + m2[0][1], m1[0][2] + m2[0][2],
-		m1[1][0] + m2[1][0], m1[1][1] + m2[1][1], m1[1][2] + m2[1][2],
-		m1[2][0] + m2[2][0], m1[2][1] + m2[2][1], m1[2][2] + m2[2][2]
+		m1.at_unchecked(0, 0) + m2.at_unchecked(0, 0), m1.at_unchecked(0, 1) + m2.at_unchecked(0, 1), m1.at_unchecked(0, 2) + m2.at_unchecked(0, 2),
+		m1.at_unchecked(1, 0) + m2.at_unchecked(1, 0), m1.at_unchecked(1, 1) + m2.at_unchecked(1, 1), m1.at_unchecked(1, 2) + m2.at_unchecked(1, 2),
+		m1.at_unchecked(2, 0) + m2.at_unchecked(2, 0), m1.at_unchecked(2, 1) + m2.at_unchecked(2, 1), m1.at_unchecked(2, 2) + m2.at_unchecked(2, 2)
 	);
 }
 
 LibMath::Matrix3 LibMath::operator*(Matrix3 const& m, float const& scalar)
 {
 	return Matrix3(
-		scalar * m[0][0], scalar * m[0][1], scalar * m[0][2],
-		scalar * m[1][0], scalar * m[1][1], scalar * m[1][2],
-		scalar * m[2][0], scalar * m[2][1], scalar * m[2][2]
+		scalar * m.at_unchecked(0, 0), scalar * m.at_unchecked(0, 1), scalar * m.at_unchecked(0, 2),
+		scalar * m.at_unchecked(1, 0), scalar * m.at_unchecked(1, 1), scalar * m.at_unchecked(1, 2),
+		scalar * m.at_unchecked(2, 0), scalar * m.at_unchecked(2, 1), scalar * m.at_unchecked(2, 2)
 	);
 }
 
@@ -683,26 +677,26 @@ LibMath::Vector3 LibMath::operator*(Matrix3 const& mat, LibMath::Vector3 const&
 {
 	// Column-Major
 	return LibMath::Vector3(
-		mat[0][0] * vec.m_x + mat[1][0] * vec.m_y + mat[2][0] * vec.m_z,
-		mat[0][1] * vec.m_x + mat[1][1] * vec.m_y + mat[2][1] * vec.m_z,
-		mat[0][2] * vec.m_x + mat[1][2] * vec.m_y + mat[2][2] * vec.m_z
+		mat.at_unchecked(0, 0) * vec.m_x + mat.at_unchecked(1, 0) * vec.m_y + mat.at_unchecked(2, 0) * vec.m_z,
+		mat.at_unchecked(0, 1) * vec.m_x + mat.at_unchecked(1, 1) * vec.m_y + mat.at_unchecked(2, 1) * vec.m_z,
+		mat.at_unchecked(0, 2) * vec.m_x + mat.at_unchecked(1, 2) * vec.m_y + mat.at_unchecked(2, 2) * vec.m_z
 	);
 }
 
 LibMath::Matrix3 LibMath::operator*(Matrix3 const& m1, Matrix3 const& m2)
 {
 
-	float a1 = (m1[0][0] * m2[0][0]) + (m1[1][0] * m2[0][1]) + (m1[2][0] * m2[0][2]);
-	float a2 = (m1[0][1] * m2[0][0]) + (m1[1][1] * m2[0][1]) + (m1[2][1] * m2[0][2]);
-	float a3 = (m1[0][2] * m2[0][0]) + (m1[1][2] * m2[0][1]) + (m1[2][2] * m2[0][2]);
+	float a1 = (m1.at_unchecked(0, 0) * m2.at_unchecked(0, 0)) + (m1.at_unchecked(1, 0) * m2.at_unchecked(0, 1)) + (m1.at_unchecked(2, 0) * m2.at_unchecked(0, 2));
+	float a2 = (m1.at_unchecked(0, 1) * m2.at_unchecked(0, 0)) + (m1.at_unchecked(1, 1) * m2.at_unchecked(0, 1)) + (m1.at_unchecked(2, 1) * m2.at_unchecked(0, 2));
+	float a3 = (m1.at_unchecked(0, 2) * m2.at_unchecked(0, 0)) + (m1.at_unchecked(1, 2) * m2.at_unchecked(0, 1)) + (m1.at_unchecked(2, 2) * m2.at_unchecked(0, 2));
 
-	float a4 = (m1[0][0] * m2[1][0]) + (m1[1][0] * m2[1][1]) + (m1[2][0] * m2[1][2]);
-	float a5 = (m1[0][1] * m2[1][0]) + (m1[1][1] * m2[1][1]) + (m1[2][1] * m2[1][2]);
-	float a6 = (m1[0][2] * m2[1][0]) + (m1[1][2] * m2[1][1]) + (m1[2][2] * m2[1][2]);
+	float a4 = (m1.at_unchecked(0, 0) * m2.at_unchecked(1, 0)) + (m1.at_unchecked(1, 0) * m2.at_unchecked(1, 1)) + (m1.at_unchecked(2, 0) * m2.at_unchecked(1, 2));
+	float a5 = (m1.at_unchecked(0, 1) * m2.at_unchecked(1, 0)) + (m1.at_unchecked(1, 1) * m2.at_unchecked(1, 1)) + (m1.at_unchecked(2, 1) * m2.at_unchecked(1, 2));
+	float a6 = (m1.at_unchecked(0, 2) * m2.at_unchecked(1, 0)) + (m1.at_unchecked(1, 2) * m2.at_unchecked(1, 1)) + (m1.at_unchecked(2, 2) * m2.at_unchecked(1, 2));
 
-	float a7 = (m1[0][0] * m2[2][0]) + (m1[1][0] * m2[2][1]) + (m1[2][0] * m2[2][2]);
-	float a8 = (m1[0][1] * m2[2][0]) + (m1[1][1] * m2[2][1]) + (m1[2][1] * m2[2][2]);
-	float a9 = (m1[0][2] * m2[2][0]) + (m1[1][2] * m2[2][1]) + (m1[2][2] * m2[2][2]);
+	float a7 = (m1.at_unchecked(0, 0) * m2.at_unchecked(2, 0)) + (m1.at_unchecked(1, 0) * m2.at_unchecked(2, 1)) + (m1.at_unchecked(2, 0) * m2.at_unchecked(2, 2));
+	float a8 = (m1.at_unchecked(0, 1) * m2.at_unchecked(2, 0)) + (m1.at_unchecked(1, 1) * m2.at_unchecked(2, 1)) + (m1.at_unchecked(2, 1) * m2.at_unchecked(2, 2));
+	float a9 = (m1.at_unchecked(0, 2) * m2.at_unchecked(2, 0)) + (m1.at_unchecked(1, 2) * m2.at_unchecked(2, 1)) + (m1.at_unchecked(2, 2) * m2.at_unchecked(2, 2));
 	return Matrix3(
 		a1, a2, a3,
 		a4, a5, a6,
@@ -844,38 +838,51 @@ LibMath::Matrix4::RowProxy LibMath::Matrix4::operator[](size_t row)
 
 LibMath::Matrix4 LibMath::Matrix4::transpose(void) const
 {
+#if defined(LIBMATH_SIMD_SSE41)
+	__m128 column0 = _mm_load_ps(m_elements[0]);
+	__m128 column1 = _mm_load_ps(m_elements[1]);
+	__m128 column2 = _mm_load_ps(m_elements[2]);
+	__m128 column3 = _mm_load_ps(m_elements[3]);
+
+	_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+	Matrix4 result;
+	_mm_store_ps(result.m_elements[0], column0);
+	_mm_store_ps(result.m_elements[1], column1);
+	_mm_store_ps(result.m_elements[2], column2);
+	_mm_store_ps(result.m_elements[3], column3);
+
+	return result;
+#else
 	return Matrix4(
 		m_elements[0][0], m_elements[1][0], m_elements[2][0], m_elements[3][0],
 		m_elements[0][1], m_elements[1][1], m_elements[2][1], m_elements[3][1],
 		m_elements[0][2], m_elements[1][2], m_elements[2][2], m_elements[3][2],
 		m_elements[0][3], m_elements[1][3], m_elements[2][3], m_elements[3][3]
 	);
+#endif
 }
 
 float LibMath::Matrix4::determinant(void) const
 {
-	LibMath::Matrix3 subMatrix00(m_elements[1][1], m_elements[1][2], m_elements[1][3], 
-									m_elements[2][1], m_elements[2][2], m_elements[2][3], 
-									m_elements[3][1], m_elements[3][2], m_elements[3][3]);
-	float minor00 = subMatrix00.determinant();
-
-	LibMath::Matrix3 subMatrix01(m_elements[1][0], m_elements[1][2], m_elements[1][3],
-									m_elements[2][0], m_elements[2][2], m_elements[2][3],
-									m_elements[3][0], m_elements[3][2], m_elements[3][3]);
-	float minor01 = subMatrix01.determinant();
-
-	LibMath::Matrix3 subMatrix02(m_elements[1][0], m_elements[1][1], m_elements[1][3],
-									m_elements[2][0], m_elements[2][1], m_elements[2][3],
-									m_elements[3][0], m_elements[3][1], m_elements[3][3]);
-	float minor02 = subMatrix02.determinant();
+	// Laplace expansion along the first two columns, each 2x2 sub-determinant is computed once
+	float const* m = data();
 
-	LibMath::Matrix3 subMatrix03(m_elements[1][0], m_elements[1][1], m_elements[1][2],
-									m_elements[2][0], m_elements[2][1], m_elements[2][2],
-									m_elements[3][0], m_elements[3][1], m_elements[3][2]);
-	float minor03 = subMatrix03.determinant();
+	float s0 = m[0] * m[5] - m[4] * m[1];
+	float s1 = m[0] * m[6] - m[4] * m[2];
+	float s2 = m[0] * m[7] - m[4] * m[3];
+	float s3 = m[1] * m[6] - m[5] * m[2];
+	float s4 = m[1] * m[7] - m[5] * m[3];
+	float s5 = m[2] * m[7] - m[6] * m[3];
 
+	float c5 = m[10] * m[15] - m[14] * m[11];
+	float c4 = m[9] * m[15] - m[13] * m[11];
+	float c3 = m[9] * m[14] - m[13] * m[10];
+	float c2 = m[8] * m[15] - m[12] * m[11];
+	float c1 = m[8] * m[14] - m[12] * m[10];
+	float c0 = m[8] * m[13] - m[12] * m[9];
 
-	return (m_elements[0][0] * minor00) - (m_elements[0][1] * minor01) + (m_elements[0][2] * minor02) - (m_elements[0][3] * minor03);
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 }
 
 LibMath::Matrix4 LibMath::Matrix4::minors(void) const
@@ -979,10 +986,10 @@ LibMath::Matrix4 LibMath::Matrix4::cofators(void) const
 	Matrix4 minors_ = minors();
 
 	return Matrix4(
-		minors_[0][0], -minors_[0][1], minors_[0][2], -minors_[0][3],
-		-minors_[1][0], minors_[1][1], -minors_[1][2], minors_[1][3],
-		minors_[2][0], -minors_[2][1], minors_[2][2], -minors_[2][3],
-		-minors_[3][0], minors_[3][1], -minors_[3][2], minors_[3][3]
+		minors_.at_unchecked(0, 0), -minors_.at_unchecked(0, 1), minors_.at_unchecked(0, 2), -minors_.at_unchecked(0, 3),
+		-minors_.at_unchecked(1, 0), minors_.at_unchecked(1, 1), -minors_.at_unchecked(1, 2), minors_.at_unchecked(1, 3),
+		minors_.at_unchecked(2, 0), -minors_.at_unchecked(2, 1), minors_.at_unchecked(2, 2), -minors_.at_unchecked(2, 3),
+		-minors_.at_unchecked(3, 0), minors_.at_unchecked(3, 1), -minors_.at_unchecked(3, 2), minors_.at_unchecked(3, 3)
 	);
 }
 
@@ -993,18 +1000,348 @@ LibMath::Matrix4 LibMath::Matrix4::adjugate(void) const
 	return cofactor_.transpose();
 }
 
+#if defined(LIBMATH_SIMD_SSE41)
+/*
+* 2x2 matrix helpers for the block inverse, a __m128 holds a 2x2 matrix as (m00, m01, m10, m11)
+* '#' stands for the adjugate
+*/
+static __m128 mat2Mul(__m128 lhs, __m128 rhs)
+{
+	// lhs * rhs
+	return _mm_add_ps(_mm_mul_ps(lhs, _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 3, 0))),
+					  _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+static __m128 mat2AdjMul(__m128 lhs, __m128 rhs)
+{
+	// lhs# * rhs
+	return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(0, 0, 3, 3)), rhs),
+					  _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+static __m128 mat2MulAdj(__m128 lhs, __m128 rhs)
+{
+	// lhs * rhs#
+	return _mm_sub_ps(_mm_mul_ps(lhs, _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(0, 3, 0, 3))),
+					  _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+#endif
+
 LibMath::Matrix4 LibMath::Matrix4::inverse(void) const
 {
-	float det = determinant();
+	// Single pass inverse, the 2x2 sub-determinants are shared between the determinant and the adjugate
+	Matrix4 result;
+
+#if defined(LIBMATH_SIMD_SSE41)
+	// Block matrix inverse : M = | A B |  ->  M^-1 = 1 / |M| * | X# Y# |
+	//                            | C D |                      | Z# W# |
+	__m128 column0 = _mm_load_ps(m_elements[0]);
+	__m128 column1 = _mm_load_ps(m_elements[1]);
+	__m128 column2 = _mm_load_ps(m_elements[2]);
+	__m128 column3 = _mm_load_ps(m_elements[3]);
+
+	__m128 blockA = _mm_movelh_ps(column0, column1);
+	__m128 blockB = _mm_movehl_ps(column1, column0);
+	__m128 blockC = _mm_movelh_ps(column2, column3);
+	__m128 blockD = _mm_movehl_ps(column3, column2);
+
+	// (|A|, |B|, |C|, |D|)
+	__m128 subDeterminants = _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(column0, column2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(column1, column3, _MM_SHUFFLE(3, 1, 3, 1))),
+		_mm_mul_ps(_mm_shuffle_ps(column0, column2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(column1, column3, _MM_SHUFFLE(2, 0, 2, 0)))
+	);
+
+	__m128 determinantA = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+	__m128 determinantB = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+	__m128 determinantC = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+	__m128 determinantD = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m128 adjDC = mat2AdjMul(blockD, blockC);
+	__m128 adjAB = mat2AdjMul(blockA, blockB);
+
+	__m128 blockX = _mm_sub_ps(_mm_mul_ps(determinantD, blockA), mat2Mul(blockB, adjDC));
+	__m128 blockW = _mm_sub_ps(_mm_mul_ps(determinantA, blockD), mat2Mul(blockC, adjAB));
+	__m128 blockY = _mm_sub_ps(_mm_mul_ps(determinantB, blockC), mat2MulAdj(blockD, adjAB));
+	__m128 blockZ = _mm_sub_ps(_mm_mul_ps(determinantC, blockB), mat2MulAdj(blockA, adjDC));
+
+	// |M| = |A| |D| + |B| |C| - tr((A# B) (D# C))
+	__m128 trace = _mm_mul_ps(adjAB, _mm_shuffle_ps(adjDC, adjDC, _MM_SHUFFLE(3, 1, 2, 0)));
+	trace = _mm_hadd_ps(trace, trace);
+	trace = _mm_hadd_ps(trace, trace);
+
+	__m128 determinantM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC)), trace);
+
+	if (LibMath::almostEqual(_mm_cvtss_f32(determinantM), 0))
+	{
+		throw std::runtime_error("Matrix is not invertible.\n");
+	}
+
+	__m128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), determinantM);
+
+	blockX = _mm_mul_ps(blockX, inverseDeterminant);
+	blockY = _mm_mul_ps(blockY, inverseDeterminant);
+	blockZ = _mm_mul_ps(blockZ, inverseDeterminant);
+	blockW = _mm_mul_ps(blockW, inverseDeterminant);
+
+	// adjugate of each block merged with the shuffle back to columns
+	_mm_store_ps(result.m_elements[0], _mm_shuffle_ps(blockX, blockY, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_store_ps(result.m_elements[1], _mm_shuffle_ps(blockX, blockY, _MM_SHUFFLE(0, 2, 0, 2)));
+	_mm_store_ps(result.m_elements[2], _mm_shuffle_ps(blockZ, blockW, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_store_ps(result.m_elements[3], _mm_shuffle_ps(blockZ, blockW, _MM_SHUFFLE(0, 2, 0, 2)));
+#else
+	float const* m = data();
+
+	float s0 = m[0] * m[5] - m[4] * m[1];
+	float s1 = m[0] * m[6] - m[4] * m[2];
+	float s2 = m[0] * m[7] - m[4] * m[3];
+	float s3 = m[1] * m[6] - m[5] * m[2];
+	float s4 = m[1] * m[7] - m[5] * m[3];
+	float s5 = m[2] * m[7] - m[6] * m[3];
+
+	float c5 = m[10] * m[15] - m[14] * m[11];
+	float c4 = m[9] * m[15] - m[13] * m[11];
+	float c3 = m[9] * m[14] - m[13] * m[10];
+	float c2 = m[8] * m[15] - m[12] * m[11];
+	float c1 = m[8] * m[14] - m[12] * m[10];
+	float c0 = m[8] * m[13] - m[12] * m[9];
+
+	float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+	if (LibMath::almostEqual(det, 0))
+	{
+		throw std::runtime_error("Matrix is not invertible.\n");
+	}
+
+	float invDet = 1.0f / det;
+	float* out = result.data();
+
+	out[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * invDet;
+	out[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDet;
+	out[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+	out[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+
+	out[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDet;
+	out[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * invDet;
+	out[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+	out[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+
+	out[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * invDet;
+	out[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDet;
+	out[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+	out[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDet;
+
+	out[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDet;
+	out[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * invDet;
+	out[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+	out[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * invDet;
+#endif
+
+	return result;
+}
+
+LibMath::Matrix4 LibMath::Matrix4::inverseAffine(void) const
+{
+	// M = | L t |  ->  M^-1 = | L^-1  -L^-1 t |
+	//     | 0 1 |             |  0        1   |
+	float const* m = data();
+
+	float cofactor00 = m[5] * m[10] - m[9] * m[6];
+	float cofactor01 = m[9] * m[2] - m[1] * m[10];
+	float cofactor02 = m[1] * m[6] - m[5] * m[2];
+
+	float det = m[0] * cofactor00 + m[4] * cofactor01 + m[8] * cofactor02;
 
 	if (LibMath::almostEqual(det, 0))
 	{
 		throw std::runtime_error("Matrix is not invertible.\n");
 	}
 
-	Matrix4 adj = adjugate();
+	float invDet = 1.0f / det;
+
+	Matrix4 result;
+	float* out = result.data();
+
+	out[0] = cofactor00 * invDet;
+	out[1] = cofactor01 * invDet;
+	out[2] = cofactor02 * invDet;
+
+	out[4] = (m[8] * m[6] - m[4] * m[10]) * invDet;
+	out[5] = (m[0] * m[10] - m[8] * m[2]) * invDet;
+	out[6] = (m[4] * m[2] - m[0] * m[6]) * invDet;
+
+	out[8] = (m[4] * m[9] - m[8] * m[5]) * invDet;
+	out[9] = (m[8] * m[1] - m[0] * m[9]) * invDet;
+	out[10] = (m[0] * m[5] - m[4] * m[1]) * invDet;
+
+	out[12] = -(out[0] * m[12] + out[4] * m[13] + out[8] * m[14]);
+	out[13] = -(out[1] * m[12] + out[5] * m[13] + out[9] * m[14]);
+	out[14] = -(out[2] * m[12] + out[6] * m[13] + out[10] * m[14]);
+	out[15] = 1.f;
+
+	return result;
+}
+
+LibMath::Matrix4 LibMath::Matrix4::inverseRigid(void) const
+{
+	// M = | R t |  ->  M^-1 = | R^T  -R^T t |
+	//     | 0 1 |             |  0      1   |
+	float const* m = data();
 
-	return adj * (1.0f / det);
+	return Matrix4(
+		m[0], m[4], m[8], 0.f,
+		m[1], m[5], m[9], 0.f,
+		m[2], m[6], m[10], 0.f,
+		-(m[0] * m[12] + m[1] * m[13] + m[2] * m[14]),
+		-(m[4] * m[12] + m[5] * m[13] + m[6] * m[14]),
+		-(m[8] * m[12] + m[9] * m[13] + m[10] * m[14]),
+		1.f
+	);
+}
+
+void LibMath::Matrix4::decompose(LibMath::Vector3& translation, LibMath::Quaternion& rotation, LibMath::Vector3& scale) const
+{
+	// M = | R S  t |, the scales are the lengths of the first 3 columns
+	//     |  0   1 |
+	float const* m = data();
+
+	float scaleX = LibMath::squareRoot(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+	float scaleY = LibMath::squareRoot(m[4] * m[4] + m[5] * m[5] + m[6] * m[6]);
+	float scaleZ = LibMath::squareRoot(m[8] * m[8] + m[9] * m[9] + m[10] * m[10]);
+
+	if (scaleX == 0.f || scaleY == 0.f || scaleZ == 0.f)
+	{
+		throw std::runtime_error("Error: cannot decompose a matrix with a zero scale");
+	}
+
+	// a negative determinant is a mirror, which a rotation cannot hold
+	float det = m[0] * (m[5] * m[10] - m[6] * m[9]) + m[1] * (m[6] * m[8] - m[4] * m[10]) + m[2] * (m[4] * m[9] - m[5] * m[8]);
+
+	if (det < 0.f)
+	{
+		scaleX = -scaleX;
+	}
+
+	float invX = 1.f / scaleX;
+	float invY = 1.f / scaleY;
+	float invZ = 1.f / scaleZ;
+
+	translation = LibMath::Vector3(m[12], m[13], m[14]);
+	rotation = LibMath::Quaternion::fromMatrix(LibMath::Matrix3(
+		m[0] * invX, m[1] * invX, m[2] * invX,
+		m[4] * invY, m[5] * invY, m[6] * invY,
+		m[8] * invZ, m[9] * invZ, m[10] * invZ
+	));
+	scale = LibMath::Vector3(scaleX, scaleY, scaleZ);
+}
+
+namespace Simd = LibMath::Simd;
+
+void LibMath::Matrix4::transformPoints(std::span<LibMath::Vector3 const> points, std::span<LibMath::Vector3> result, bool const homogenize) const
+{
+	if (points.size() != result.size())
+	{
+		throw std::invalid_argument("Error: input and output spans have different sizes");
+	}
+
+	// Column-Major : result = column0 * x + column1 * y + column2 * z + column3
+	float const* m = data();
+	size_t i = 0;
+
+#if defined(LIBMATH_SIMD_SSE41)
+	// 4 points per iteration, each matrix element is broadcast once for the whole span
+	__m128 m00 = _mm_set1_ps(m[0]), m01 = _mm_set1_ps(m[1]), m02 = _mm_set1_ps(m[2]), m03 = _mm_set1_ps(m[3]);
+	__m128 m10 = _mm_set1_ps(m[4]), m11 = _mm_set1_ps(m[5]), m12 = _mm_set1_ps(m[6]), m13 = _mm_set1_ps(m[7]);
+	__m128 m20 = _mm_set1_ps(m[8]), m21 = _mm_set1_ps(m[9]), m22 = _mm_set1_ps(m[10]), m23 = _mm_set1_ps(m[11]);
+	__m128 m30 = _mm_set1_ps(m[12]), m31 = _mm_set1_ps(m[13]), m32 = _mm_set1_ps(m[14]), m33 = _mm_set1_ps(m[15]);
+
+	for (; i + 4 <= points.size(); i += 4)
+	{
+		__m128 x, y, z;
+		Simd::loadVector3x4(&points[i].m_x, x, y, z);
+
+		__m128 resultX = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m10, y)), _mm_mul_ps(m20, z)), m30);
+		__m128 resultY = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m01, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m21, z)), m31);
+		__m128 resultZ = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m02, x), _mm_mul_ps(m12, y)), _mm_mul_ps(m22, z)), m32);
+
+		if (homogenize)
+		{
+			__m128 resultW = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m03, x), _mm_mul_ps(m13, y)), _mm_mul_ps(m23, z)), m33);
+
+			resultX = _mm_div_ps(resultX, resultW);
+			resultY = _mm_div_ps(resultY, resultW);
+			resultZ = _mm_div_ps(resultZ, resultW);
+		}
+
+		Simd::storeVector3x4(&result[i].m_x, resultX, resultY, resultZ);
+	}
+#endif
+
+	for (; i < points.size(); ++i)
+	{
+		float x = points[i].m_x;
+		float y = points[i].m_y;
+		float z = points[i].m_z;
+
+		LibMath::Vector3 transformed(
+			(m[0] * x) + (m[4] * y) + (m[8] * z) + m[12],
+			(m[1] * x) + (m[5] * y) + (m[9] * z) + m[13],
+			(m[2] * x) + (m[6] * y) + (m[10] * z) + m[14]
+		);
+
+		if (homogenize)
+		{
+			float w = (m[3] * x) + (m[7] * y) + (m[11] * z) + m[15];
+
+			transformed.m_x /= w;
+			transformed.m_y /= w;
+			transformed.m_z /= w;
+		}
+
+		result[i] = transformed;
+	}
+}
+
+void LibMath::Matrix4::transformDirections(std::span<LibMath::Vector3 const> directions, std::span<LibMath::Vector3> result) const
+{
+	if (directions.size() != result.size())
+	{
+		throw std::invalid_argument("Error: input and output spans have different sizes");
+	}
+
+	// Column-Major : result = column0 * x + column1 * y + column2 * z
+	float const* m = data();
+	size_t i = 0;
+
+#if defined(LIBMATH_SIMD_SSE41)
+	__m128 m00 = _mm_set1_ps(m[0]), m01 = _mm_set1_ps(m[1]), m02 = _mm_set1_ps(m[2]);
+	__m128 m10 = _mm_set1_ps(m[4]), m11 = _mm_set1_ps(m[5]), m12 = _mm_set1_ps(m[6]);
+	__m128 m20 = _mm_set1_ps(m[8]), m21 = _mm_set1_ps(m[9]), m22 = _mm_set1_ps(m[10]);
+
+	for (; i + 4 <= directions.size(); i += 4)
+	{
+		__m128 x, y, z;
+		Simd::loadVector3x4(&directions[i].m_x, x, y, z);
+
+		__m128 resultX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m10, y)), _mm_mul_ps(m20, z));
+		__m128 resultY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m01, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m21, z));
+		__m128 resultZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m02, x), _mm_mul_ps(m12, y)), _mm_mul_ps(m22, z));
+
+		Simd::storeVector3x4(&result[i].m_x, resultX, resultY, resultZ);
+	}
+#endif
+
+	for (; i < directions.size(); ++i)
+	{
+		float x = directions[i].m_x;
+		float y = directions[i].m_y;
+		float z = directions[i].m_z;
+
+		result[i] = LibMath::Vector3(
+			(m[0] * x) + (m[4] * y) + (m[8] * z),
+			(m[1] * x) + (m[5] * y) + (m[9] * z),
+			(m[2] * x) + (m[6] * y) + (m[10] * z)
+		);
+	}
 }
 
 LibMath::Matrix4 LibMath::Matrix4::perspective(float const fov, float const aspectRatio, float const near, float const far)
@@ -1022,12 +1359,12 @@ LibMath::Matrix4 LibMath::Matrix4::perspective(float const fov, float const aspe
 	Matrix4 result;
 
 	// Set the elements of the perspective matrix
-	result[0][0] = 1.0f / (aspectRatio * tanHalfFovY);
-	result[1][1] = 1.0f / tanHalfFovY;
-	result[2][2] = -(far + near) / (far - near);
-	result[2][3] = -1.0f;
-	result[3][2] = -(2.0f * far * near) / (far - near);
-	result[3][3] = 0.0f;
+	result.at_unchecked(0, 0) = 1.0f / (aspectRatio * tanHalfFovY);
+	result.at_unchecked(1, 1) = 1.0f / tanHalfFovY;
+	result.at_unchecked(2, 2) = -(far + near) / (far - near);
+	result.at_unchecked(2, 3) = -1.0f;
+	result.at_unchecked(3, 2) = -(2.0f * far * near) / (far - near);
+	result.at_unchecked(3, 3) = 0.0f;
 
 	return result;
 }
@@ -1057,8 +1394,7 @@ LibMath::Matrix4 LibMath::Matrix4::createTranslate(LibMath::Vector3 const&  tran
 
 LibMath::Matrix4 LibMath::Matrix4::createRotationX(LibMath::Radian const& angle)
 {
-	float const cosR = LibMath::cos(angle);
-	float const sinR = LibMath::sin(angle);
+	auto const [sinR, cosR] = LibMath::sincos(angle);
 
 	return Matrix4(
 		1.f, 0.f, 0.f, 0.f,
@@ -1070,8 +1406,7 @@ LibMath::Matrix4 LibMath::Matrix4::createRotationX(LibMath::Radian const& angle)
 
 LibMath::Matrix4 LibMath::Matrix4::createRotationY(LibMath::Radian const& angle)
 {
-	float const cosR = LibMath::cos(angle);
-	float const sinR = LibMath::sin(angle);
+	auto const [sinR, cosR] = LibMath::sincos(angle);
 
 	return Matrix4(
 		cosR, 0.f, -sinR, 0.f,
@@ -1083,8 +1418,7 @@ LibMath::Matrix4 LibMath::Matrix4::createRotationY(LibMath::Radian const& angle)
 
 LibMath::Matrix4 LibMath::Matrix4::createRotationZ(LibMath::Radian const& angle)
 {
-	float const cosR = LibMath::cos(angle);
-	float const sinR = LibMath::sin(angle);
+	auto const [sinR, cosR] = LibMath::sincos(angle);
 
 	return Matrix4(
 		cosR, sinR, 0.f, 0.f,
@@ -1100,11 +1434,11 @@ LibMath::Matrix4 LibMath::Matrix4::RemoveTranslationComponent(const LibMath::Mat
 
 	for (size_t i = 0; i < 3; ++i)
 	{
-		temp[3][i] = 0.f;
-		temp[i][3] = 0.f;
+		temp.at_unchecked(3, i) = 0.f;
+		temp.at_unchecked(i, 3) = 0.f;
 	}
 
-	temp[3][3] = 1.f;
+	temp.at_unchecked(3, 3) = 1.f;
 
 	return temp;
 }
@@ -1132,62 +1466,120 @@ LibMath::Matrix4 LibMath::Matrix4::identity(void)
 
 LibMath::Matrix4 LibMath::operator+(Matrix4 const& m1, Matrix4 const& m2)
 {
-	return Matrix4(
-		m1[0][0] + m2[0][0], m1[0][1] + m2[0][1], m1[0][2] + m2[0][2], m1[0][3] + m2[0][3],
-		m1[1][0] + m2[1][0], m1[1][1] + m2[1][1], m1[1][2] + m2[1][2], m1[1][3] + m2[1][3],
-		m1[2][0] + m2[2][0], m1[2][1] + m2[2][1], m1[2][2] + m2[2][2], m1[2][3] + m2[2][3],
-		m1[3][0] + m2[3][0], m1[3][1] + m2[3][1], m1[3][2] + m2[3][2], m1[3][3] + m2[3][3]
-	);
+	float const* lhs = m1.data();
+	float const* rhs = m2.data();
+
+	Matrix4 result;
+	float* out = result.data();
+
+#if defined(LIBMATH_SIMD_AVX2)
+	// Matrix4 is only 16 byte aligned so 256 bit accesses use the unaligned variants
+	_mm256_storeu_ps(out, _mm256_add_ps(_mm256_loadu_ps(lhs), _mm256_loadu_ps(rhs)));
+	_mm256_storeu_ps(out + 8, _mm256_add_ps(_mm256_loadu_ps(lhs + 8), _mm256_loadu_ps(rhs + 8)));
+#elif defined(LIBMATH_SIMD_SSE41)
+	for (int column = 0; column < 16; column += 4)
+	{
+		_mm_store_ps(out + column, _mm_add_ps(_mm_load_ps(lhs + column), _mm_load_ps(rhs + column)));
+	}
+#else
+	for (int i = 0; i < 16; ++i)
+	{
+		out[i] = lhs[i] + rhs[i];
+	}
+#endif
+
+	return result;
 }
 
 LibMath::Matrix4 LibMath::operator*(Matrix4 const& m, float const& scalar)
 {
 	return Matrix4(
-		scalar * m[0][0], scalar * m[0][1], scalar * m[0][2], scalar * m[0][3],
-		scalar * m[1][0], scalar * m[1][1], scalar * m[1][2], scalar * m[1][3],
-		scalar * m[2][0], scalar * m[2][1], scalar * m[2][2], scalar * m[2][3],
-		scalar * m[3][0], scalar * m[3][1], scalar * m[3][2], scalar * m[3][3]
+		scalar * m.at_unchecked(0, 0), scalar * m.at_unchecked(0, 1), scalar * m.at_unchecked(0, 2), scalar * m.at_unchecked(0, 3),
+		scalar * m.at_unchecked(1, 0), scalar * m.at_unchecked(1, 1), scalar * m.at_unchecked(1, 2), scalar * m.at_unchecked(1, 3),
+		scalar * m.at_unchecked(2, 0), scalar * m.at_unchecked(2, 1), scalar * m.at_unchecked(2, 2), scalar * m.at_unchecked(2, 3),
+		scalar * m.at_unchecked(3, 0), scalar * m.at_unchecked(3, 1), scalar * m.at_unchecked(3, 2), scalar * m.at_unchecked(3, 3)
 	);
 }
 
 LibMath::Vector4 LibMath::operator*(const Matrix4 & m, const LibMath::Vector4 & vec)
 {
+	// Column-Major : result = column0 * x + column1 * y + column2 * z + column3 * w
+	float const* elements = m.data();
+
+#if defined(LIBMATH_SIMD_SSE41)
+	__m128 result = _mm_mul_ps(_mm_load_ps(elements), _mm_set1_ps(vec.m_x));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_load_ps(elements + 4), _mm_set1_ps(vec.m_y)));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_load_ps(elements + 8), _mm_set1_ps(vec.m_z)));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_load_ps(elements + 12), _mm_set1_ps(vec.m_w)));
+
+	LibMath::Vector4 product;
+	_mm_store_ps(&product.m_x, result);
+
+	return product;
+#else
 	return LibMath::Vector4(
-		(m[0][0] * vec.m_x) + (m[1][0] * vec.m_y) + (m[2][0] * vec.m_z) + (m[3][0] * vec.m_w),
-		(m[0][1] * vec.m_x) + (m[1][1] * vec.m_y) + (m[2][1] * vec.m_z) + (m[3][1] * vec.m_w),
-		(m[0][2] * vec.m_x) + (m[1][2] * vec.m_y) + (m[2][2] * vec.m_z) + (m[3][2] * vec.m_w),
-		(m[0][3] * vec.m_x) + (m[1][3] * vec.m_y) + (m[2][3] * vec.m_z) + (m[3][3] * vec.m_w)
+		(elements[0] * vec.m_x) + (elements[4] * vec.m_y) + (elements[8] * vec.m_z) + (elements[12] * vec.m_w),
+		(elements[1] * vec.m_x) + (elements[5] * vec.m_y) + (elements[9] * vec.m_z) + (elements[13] * vec.m_w),
+		(elements[2] * vec.m_x) + (elements[6] * vec.m_y) + (elements[10] * vec.m_z) + (elements[14] * vec.m_w),
+		(elements[3] * vec.m_x) + (elements[7] * vec.m_y) + (elements[11] * vec.m_z) + (elements[15] * vec.m_w)
 	);
+#endif
 }
 
 LibMath::Matrix4 LibMath::operator*(Matrix4 const& m1, Matrix4 const& m2)
 {
-	float comp00 = (m1[0][0] * m2[0][0]) + (m1[1][0] * m2[0][1]) + (m1[2][0] * m2[0][2]) + (m1[3][0] * m2[0][3]);
-    float comp01 = (m1[0][1] * m2[0][0]) + (m1[1][1] * m2[0][1]) + (m1[2][1] * m2[0][2]) + (m1[3][1] * m2[0][3]);
-    float comp02 = (m1[0][2] * m2[0][0]) + (m1[1][2] * m2[0][1]) + (m1[2][2] * m2[0][2]) + (m1[3][2] * m2[0][3]);
-    float comp03 = (m1[0][3] * m2[0][0]) + (m1[1][3] * m2[0][1]) + (m1[2][3] * m2[0][2]) + (m1[3][3] * m2[0][3]);
-    
-    float comp10 = (m1[0][0] * m2[1][0]) + (m1[1][0] * m2[1][1]) + (m1[2][0] * m2[1][2]) + (m1[3][0] * m2[1][3]);
-    float comp11 = (m1[0][1] * m2[1][0]) + (m1[1][1] * m2[1][1]) + (m1[2][1] * m2[1][2]) + (m1[3][1] * m2[1][3]);
-    float comp12 = (m1[0][2] * m2[1][0]) + (m1[1][2] * m2[1][1]) + (m1[2][2] * m2[1][2]) + (m1[3][2] * m2[1][3]);
-    float comp13 = (m1[0][3] * m2[1][0]) + (m1[1][3] * m2[1][1]) + (m1[2][3] * m2[1][2]) + (m1[3][3] * m2[1][3]);
-    
-    float comp20 = (m1[0][0] * m2[2][0]) + (m1[1][0] * m2[2][1]) + (m1[2][0] * m2[2][2]) + (m1[3][0] * m2[2][3]);
-    float comp21 = (m1[0][1] * m2[2][0]) + (m1[1][1] * m2[2][1]) + (m1[2][1] * m2[2][2]) + (m1[3][1] * m2[2][3]);
-    float comp22 = (m1[0][2] * m2[2][0]) + (m1[1][2] * m2[2][1]) + (m1[2][2] * m2[2][2]) + (m1[3][2] * m2[2][3]);
-    float comp23 = (m1[0][3] * m2[2][0]) + (m1[1][3] * m2[2][1]) + (m1[2][3] * m2[2][2]) + (m1[3][3] * m2[2][3]);
-    
-    float comp30 = (m1[0][0] * m2[3][0]) + (m1[1][0] * m2[3][1]) + (m1[2][0] * m2[3][2]) + (m1[3][0] * m2[3][3]);
-    float comp31 = (m1[0][1] * m2[3][0]) + (m1[1][1] * m2[3][1]) + (m1[2][1] * m2[3][2]) + (m1[3][1] * m2[3][3]);
-    float comp32 = (m1[0][2] * m2[3][0]) + (m1[1][2] * m2[3][1]) + (m1[2][2] * m2[3][2]) + (m1[3][2] * m2[3][3]);
-    float comp33 = (m1[0][3] * m2[3][0]) + (m1[1][3] * m2[3][1]) + (m1[2][3] * m2[3][2]) + (m1[3][3] * m2[3][3]);
-    
-    return Matrix4(
-        comp00, comp01, comp02, comp03,
-        comp10, comp11, comp12, comp13,
-        comp20, comp21, comp22, comp23,
-        comp30, comp31, comp32, comp33
-    );
+	// Column j of the result is m1 * (column j of m2)
+	float const* lhs = m1.data();
+	float const* rhs = m2.data();
+
+	Matrix4 result;
+	float* out = result.data();
+
+#if defined(LIBMATH_SIMD_AVX2)
+	// both 128 bit halves hold the same column of m1, so two columns of m2 are processed per iteration
+	__m256 column0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(lhs));
+	__m256 column1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(lhs + 4));
+	__m256 column2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(lhs + 8));
+	__m256 column3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(lhs + 12));
+
+	for (int column = 0; column < 16; column += 8)
+	{
+		__m256 factors = _mm256_loadu_ps(rhs + column);
+
+		__m256 sum = _mm256_mul_ps(column0, _mm256_shuffle_ps(factors, factors, _MM_SHUFFLE(0, 0, 0, 0)));
+		sum = _mm256_fmadd_ps(column1, _mm256_shuffle_ps(factors, factors, _MM_SHUFFLE(1, 1, 1, 1)), sum);
+		sum = _mm256_fmadd_ps(column2, _mm256_shuffle_ps(factors, factors, _MM_SHUFFLE(2, 2, 2, 2)), sum);
+		sum = _mm256_fmadd_ps(column3, _mm256_shuffle_ps(factors, factors, _MM_SHUFFLE(3, 3, 3, 3)), sum);
+
+		_mm256_storeu_ps(out + column, sum);
+	}
+#elif defined(LIBMATH_SIMD_SSE41)
+	__m128 column0 = _mm_load_ps(lhs);
+	__m128 column1 = _mm_load_ps(lhs + 4);
+	__m128 column2 = _mm_load_ps(lhs + 8);
+	__m128 column3 = _mm_load_ps(lhs + 12);
+
+	for (int column = 0; column < 16; column += 4)
+	{
+		__m128 sum = _mm_mul_ps(column0, _mm_set1_ps(rhs[column]));
+		sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_set1_ps(rhs[column + 1])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_set1_ps(rhs[column + 2])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(column3, _mm_set1_ps(rhs[column + 3])));
+
+		_mm_store_ps(out + column, sum);
+	}
+#else
+	for (int column = 0; column < 16; column += 4)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			out[column + row] = (lhs[row] * rhs[column]) + (lhs[4 + row] * rhs[column + 1]) +
+								(lhs[8 + row] * rhs[column + 2]) + (lhs[12 + row] * rhs[column + 3]);
+		}
+	}
+#endif
+
+	return result;
 }
 
 #pragma endregion
\ No newline at end of file
@@ -4,26 +4,16 @@
 #include "LibMath/Arithmetic.h"
 #include "LibMath/Vector/Vector3.h"
 #include "LibMath/Matrix/Matrix3.h"
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Simd.h"
 
-LibMath::Quaternion::Quaternion(float x, float y, float z, float w)
-{
-	m_w = w;
-
-	m_x = x;
-	m_y = y;
-	m_z = z;
-}
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
 
-LibMath::Quaternion::Quaternion(Quaternion const& other)
-{
-	if (other == *this)
-		return;
+static_assert(sizeof(LibMath::Quaternion) == 4 * sizeof(float) && std::is_standard_layout_v<LibMath::Quaternion>);	// loaded as a single register
 
-	m_x = other.m_x;
-	m_y = other.m_y;
-	m_z = other.m_z;
-	m_w = other.m_w;
-}
+namespace Simd = LibMath::Simd;
 
 LibMath::Quaternion::Quaternion(Radian rad, Vector3 vec)
 {
@@ -119,33 +109,188 @@ LibMath::Radian LibMath::Quaternion::angleBetween(Quaternion const& other) const
 	return LibMath::acos(cos) * 2;
 }
 
+static float rotationScale(LibMath::Quaternion const& quat)
+{
+	// q v q^-1 of a non unit quaternion is the rotation of the normalized quaternion, inverse() divides by |q|^2
+	float magSquare = quat.magnitudeSquare();
+
+	return LibMath::almostEqual(magSquare, 1.f) ? 2.f : 2.f / magSquare;
+}
+
+static LibMath::Vector3 rotateScaled(LibMath::Quaternion const& quat, float scale, LibMath::Vector3 const& vec)
+{
+	// t = scale (q x v), v' = v + w t + q x t
+	float tx = scale * (quat.m_y * vec.m_z - quat.m_z * vec.m_y);
+	float ty = scale * (quat.m_z * vec.m_x - quat.m_x * vec.m_z);
+	float tz = scale * (quat.m_x * vec.m_y - quat.m_y * vec.m_x);
+
+	return LibMath::Vector3(
+		vec.m_x + quat.m_w * tx + (quat.m_y * tz - quat.m_z * ty),
+		vec.m_y + quat.m_w * ty + (quat.m_z * tx - quat.m_x * tz),
+		vec.m_z + quat.m_w * tz + (quat.m_x * ty - quat.m_y * tx)
+	);
+}
+
 LibMath::Vector3 LibMath::Quaternion::rotate(Vector3 const& vec) const
 {
-	Quaternion point = Quaternion(vec);
-	Quaternion result = *this * point * inverse();
+	return rotateScaled(*this, rotationScale(*this), vec);
+}
+
+void LibMath::Quaternion::rotate(std::span<Vector3> vecs) const
+{
+	float const scale = rotationScale(*this);
+	size_t i = 0;
+
+#if defined(LIBMATH_SIMD_SSE41)
+	static_assert(sizeof(Vector3) == 3 * sizeof(float) && std::is_standard_layout_v<Vector3>);
+
+	__m128 const qx = _mm_set1_ps(m_x);
+	__m128 const qy = _mm_set1_ps(m_y);
+	__m128 const qz = _mm_set1_ps(m_z);
+	__m128 const qw = _mm_set1_ps(m_w);
+	__m128 const s = _mm_set1_ps(scale);
+
+	float* data = reinterpret_cast<float*>(vecs.data());
+
+	for (; i + 4 <= vecs.size(); i += 4)
+	{
+		float* block = data + 3 * i;
+		__m128 x, y, z;
+		Simd::loadVector3x4(block, x, y, z);
+
+		__m128 tx = _mm_mul_ps(s, _mm_sub_ps(_mm_mul_ps(qy, z), _mm_mul_ps(qz, y)));
+		__m128 ty = _mm_mul_ps(s, _mm_sub_ps(_mm_mul_ps(qz, x), _mm_mul_ps(qx, z)));
+		__m128 tz = _mm_mul_ps(s, _mm_sub_ps(_mm_mul_ps(qx, y), _mm_mul_ps(qy, x)));
+
+		x = _mm_add_ps(_mm_add_ps(x, _mm_mul_ps(qw, tx)), _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty)));
+		y = _mm_add_ps(_mm_add_ps(y, _mm_mul_ps(qw, ty)), _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz)));
+		z = _mm_add_ps(_mm_add_ps(z, _mm_mul_ps(qw, tz)), _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx)));
+
+		Simd::storeVector3x4(block, x, y, z);
+	}
+#endif
+
+	for (; i < vecs.size(); ++i)
+	{
+		vecs[i] = rotateScaled(*this, scale, vecs[i]);
+	}
+}
+
+static void writeRotation(LibMath::Quaternion const& quat, float* columns, size_t const stride)
+{
+	// columns[column * stride + row], the scale folds the normalization in like rotate does
+	float const scale = rotationScale(quat);
+
+	float xs = quat.m_x * scale;
+	float ys = quat.m_y * scale;
+	float zs = quat.m_z * scale;
+
+	float wx = quat.m_w * xs;
+	float wy = quat.m_w * ys;
+	float wz = quat.m_w * zs;
+	float xx = quat.m_x * xs;
+	float xy = quat.m_x * ys;
+	float xz = quat.m_x * zs;
+	float yy = quat.m_y * ys;
+	float yz = quat.m_y * zs;
+	float zz = quat.m_z * zs;
+
+	columns[0] = 1.f - (yy + zz);
+	columns[1] = xy + wz;
+	columns[2] = xz - wy;
+
+	columns[stride] = xy - wz;
+	columns[stride + 1] = 1.f - (xx + zz);
+	columns[stride + 2] = yz + wx;
+
+	columns[2 * stride] = xz + wy;
+	columns[2 * stride + 1] = yz - wx;
+	columns[2 * stride + 2] = 1.f - (xx + yy);
+}
+
+static LibMath::Quaternion fromRotationColumns(float const* column0, float const* column1, float const* column2)
+{
+	// Shepperd : take the square root of the largest of 4w^2, 4x^2, 4y^2 and 4z^2 (always >= 1),
+	// the 3 other components come from sums and differences of the off diagonal terms
+	float const m00 = column0[0];
+	float const m11 = column1[1];
+	float const m22 = column2[2];
+	float const trace = m00 + m11 + m22;
+
+	LibMath::Quaternion result;
+
+	if (trace >= m00 && trace >= m11 && trace >= m22)
+	{
+		float root = LibMath::squareRoot(1.f + trace);
+		float scale = 0.5f / root;
+
+		result.m_w = 0.5f * root;
+		result.m_x = (column1[2] - column2[1]) * scale;
+		result.m_y = (column2[0] - column0[2]) * scale;
+		result.m_z = (column0[1] - column1[0]) * scale;
+	}
+	else if (m00 >= m11 && m00 >= m22)
+	{
+		float root = LibMath::squareRoot(1.f + m00 - m11 - m22);
+		float scale = 0.5f / root;
+
+		result.m_x = 0.5f * root;
+		result.m_w = (column1[2] - column2[1]) * scale;
+		result.m_y = (column1[0] + column0[1]) * scale;
+		result.m_z = (column2[0] + column0[2]) * scale;
+	}
+	else if (m11 >= m22)
+	{
+		float root = LibMath::squareRoot(1.f - m00 + m11 - m22);
+		float scale = 0.5f / root;
+
+		result.m_y = 0.5f * root;
+		result.m_w = (column2[0] - column0[2]) * scale;
+		result.m_x = (column1[0] + column0[1]) * scale;
+		result.m_z = (column2[1] + column1[2]) * scale;
+	}
+	else
+	{
+		float root = LibMath::squareRoot(1.f - m00 - m11 + m22);
+		float scale = 0.5f / root;
+
+		result.m_z = 0.5f * root;
+		result.m_w = (column0[1] - column1[0]) * scale;
+		result.m_x = (column2[0] + column0[2]) * scale;
+		result.m_y = (column2[1] + column1[2]) * scale;
+	}
+
+	return result;
+}
+
+LibMath::Matrix3 LibMath::Quaternion::toMatrix(void) const
+{
+	LibMath::Matrix3 result;
+	writeRotation(*this, result.data(), 3);
+
+	return result;
+}
+
+LibMath::Matrix4 LibMath::Quaternion::toMatrix4(void) const
+{
+	LibMath::Matrix4 result = LibMath::Matrix4::identity();
+	writeRotation(*this, result.data(), 4);
 
-	return Vector3(result.m_x, result.m_y, result.m_z);
+	return result;
 }
 
-LibMath::Matrix3 LibMath::Quaternion::toMatrix(void)
+LibMath::Quaternion LibMath::Quaternion::fromMatrix(Matrix3 const& mat)
 {
-	float m00 = 1 - 2 * (m_y * m_y + m_z * m_z);
-	float m01 = 2 * (m_w * m_z + m_x * m_y);
-	float m02 = 2 * (m_x * m_z - m_w * m_y);
+	float const* m = mat.data();
 
-	float m10 = 2 * (m_x * m_y - m_w * m_z);
-	float m11 = 1 - 2 * (m_x * m_x + m_z * m_z);
-	float m12 = 2 * (m_w * m_x + m_y * m_z);
+	return fromRotationColumns(m, m + 3, m + 6);
+}
 
-	float m20 = 2 * (m_w * m_y + m_x * m_z);
-	float m21 = 2 * (m_y * m_z - m_w * m_x);
-	float m22 = 1 - 2 * (m_x * m_x + m_y * m_y);
+LibMath::Quaternion LibMath::Quaternion::fromMatrix(Matrix4 const& mat)
+{
+	float const* m = mat.data();
 
-	return LibMath::Matrix3(
-		m00, m01, m02,
-		m10, m11, m12,
-		m20, m21, m22
-		);
+	return fromRotationColumns(m, m + 4, m + 8);
 }
 
 bool LibMath::Quaternion::isUnit() const
@@ -178,7 +323,7 @@ LibMath::Quaternion LibMath::Quaternion::slerp(Quaternion const& qStart, Quatern
 	Quaternion unitQEnd = qEnd;
 	unitQEnd.normalize();
 
-	float cosTheta = qStart.m_x * qEnd.m_x + qStart.m_y * qEnd.m_y + qStart.m_z * qEnd.m_z + qStart.m_w * qEnd.m_w;
+	float cosTheta = unitQStart.m_x * unitQEnd.m_x + unitQStart.m_y * unitQEnd.m_y + unitQStart.m_z * unitQEnd.m_z + unitQStart.m_w * unitQEnd.m_w;
 
 	if (cosTheta < 0)
 	{
@@ -189,7 +334,7 @@ LibMath::Quaternion LibMath::Quaternion::slerp(Quaternion const& qStart, Quatern
 	}
 
 	if (cosTheta > 0.9995f) {
-		return nlerp(qStart, qEnd, t);
+		return nlerp(unitQStart, unitQEnd, t);
 	}
 	Radian angleBetween = LibMath::acos(cosTheta);
 
@@ -224,6 +369,222 @@ LibMath::Quaternion LibMath::Quaternion::nlerp(Quaternion const& qStart, Quatern
 	return result;
 }
 
+/*
+* Slerp without trigonometry, from D. Eberly "A Fast and Accurate Algorithm for Computing SLERP"
+* sin(t theta) / sin(theta) is a polynomial of t^2 and cos(theta) - 1, evaluated as
+* t (1 + b0 (1 + b1 (... (1 + b7)))) with bi = (u[i] t^2 - v[i]) (cos(theta) - 1)
+* The last coefficients are scaled by 1 + mu to balance the truncation error over [0, 1]
+*/
+static float constexpr c_slerpOnePlusMu = 1.90110745351730037f;
+static float constexpr c_slerpU[8] = { 1.f / (1 * 3), 1.f / (2 * 5), 1.f / (3 * 7), 1.f / (4 * 9), 1.f / (5 * 11), 1.f / (6 * 13), 1.f / (7 * 15), c_slerpOnePlusMu / (8 * 17) };
+static float constexpr c_slerpV[8] = { 1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, c_slerpOnePlusMu * 8 / 17 };
+
+static float slerpWeight(float t, float cosMinusOne)
+{
+	float const squareT = t * t;
+
+	float weight = 1.f;
+	for (int i = 7; i >= 0; --i)
+	{
+		weight = 1.f + (c_slerpU[i] * squareT - c_slerpV[i]) * cosMinusOne * weight;
+	}
+
+	return t * weight;
+}
+
+LibMath::Quaternion LibMath::Quaternion::slerpFast(Quaternion const& qStart, Quaternion const& qEnd, float t)
+{
+	float const dot = qStart.m_x * qEnd.m_x + qStart.m_y * qEnd.m_y + qStart.m_z * qEnd.m_z + qStart.m_w * qEnd.m_w;
+
+	// shortest path : qEnd is negated when the angle is greater than 90deg
+	float const cosMinusOne = std::abs(dot) - 1.f;
+	float const weightStart = slerpWeight(1.f - t, cosMinusOne);
+	float const weightEnd = std::copysign(slerpWeight(t, cosMinusOne), dot);
+
+	return Quaternion(
+		qStart.m_x * weightStart + qEnd.m_x * weightEnd,
+		qStart.m_y * weightStart + qEnd.m_y * weightEnd,
+		qStart.m_z * weightStart + qEnd.m_z * weightEnd,
+		qStart.m_w * weightStart + qEnd.m_w * weightEnd
+	);
+}
+
+static LibMath::Quaternion nlerpUnit(LibMath::Quaternion const& qStart, LibMath::Quaternion const& qEnd, float t)
+{
+	LibMath::Quaternion result = qStart * (1 - t) + qEnd * t;
+	float const magnitude = std::sqrt(result.magnitudeSquare());
+
+	return LibMath::Quaternion(result.m_x / magnitude, result.m_y / magnitude, result.m_z / magnitude, result.m_w / magnitude);
+}
+
+/*
+* Lane helpers of the interpolation arrays, on top of LibMath/Simd.h : each register holds one component of 4 (SSE4.1) or 8 (AVX2) quaternions
+* With AVX2 the transpose works inside each 128 bit half, the lanes hold the quaternions 0 2 4 6 1 3 5 7
+*/
+#if defined(LIBMATH_SIMD_AVX2)
+static Simd::Lanes quatLoadFactors(float const* src) { return _mm256_permutevar8x32_ps(_mm256_loadu_ps(src), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)); }
+static Simd::Lanes quatUnpackLow(Simd::Lanes lhs, Simd::Lanes rhs) { return _mm256_unpacklo_ps(lhs, rhs); }
+static Simd::Lanes quatUnpackHigh(Simd::Lanes lhs, Simd::Lanes rhs) { return _mm256_unpackhi_ps(lhs, rhs); }
+static Simd::Lanes quatLowHalves(Simd::Lanes lhs, Simd::Lanes rhs) { return _mm256_shuffle_ps(lhs, rhs, _MM_SHUFFLE(1, 0, 1, 0)); }
+static Simd::Lanes quatHighHalves(Simd::Lanes lhs, Simd::Lanes rhs) { return _mm256_shuffle_ps(lhs, rhs, _MM_SHUFFLE(3, 2, 3, 2)); }
+#elif defined(LIBMATH_SIMD_SSE41)
+static Simd::Lanes quatLoadFactors(float const* src) { return _mm_loadu_ps(src); }
+static Simd::Lanes quatUnpackLow(Simd::Lanes lhs, Simd::Lanes rhs) { return _mm_unpacklo_ps(lhs, rhs); }
+static Simd::Lanes quatUnpackHigh(Simd::Lanes lhs, Simd::Lanes rhs) { return _mm_unpackhi_ps(lhs, rhs); }
+static Simd::Lanes quatLowHalves(Simd::Lanes lhs, Simd::Lanes rhs) { return _mm_shuffle_ps(lhs, rhs, _MM_SHUFFLE(1, 0, 1, 0)); }
+static Simd::Lanes quatHighHalves(Simd::Lanes lhs, Simd::Lanes rhs) { return _mm_shuffle_ps(lhs, rhs, _MM_SHUFFLE(3, 2, 3, 2)); }
+#endif
+
+#if defined(LIBMATH_SIMD_SSE41)
+// 4 x 4 transpose, rows of interleaved quaternions become x, y, z and w lanes and back
+static void quatTranspose(Simd::Lanes (&lanes)[4])
+{
+	Simd::Lanes low01 = quatUnpackLow(lanes[0], lanes[1]);
+	Simd::Lanes low23 = quatUnpackLow(lanes[2], lanes[3]);
+	Simd::Lanes high01 = quatUnpackHigh(lanes[0], lanes[1]);
+	Simd::Lanes high23 = quatUnpackHigh(lanes[2], lanes[3]);
+
+	lanes[0] = quatLowHalves(low01, low23);
+	lanes[1] = quatHighHalves(low01, low23);
+	lanes[2] = quatLowHalves(high01, high23);
+	lanes[3] = quatHighHalves(high01, high23);
+}
+
+static void quatLoadComponents(float const* src, Simd::Lanes (&lanes)[4])
+{
+	for (size_t row = 0; row < 4; ++row)
+	{
+		lanes[row] = Simd::loadUnaligned(src + row * Simd::c_width);
+	}
+
+	quatTranspose(lanes);
+}
+
+static void quatStoreComponents(float* dst, Simd::Lanes (&lanes)[4])
+{
+	quatTranspose(lanes);
+
+	for (size_t row = 0; row < 4; ++row)
+	{
+		Simd::storeUnaligned(dst + row * Simd::c_width, lanes[row]);
+	}
+}
+
+static Simd::Lanes slerpWeightLanes(Simd::Lanes t, Simd::Lanes cosMinusOne)
+{
+	Simd::Lanes const squareT = Simd::mul(t, t);
+
+	Simd::Lanes weight = Simd::set(1.f);
+	for (int i = 7; i >= 0; --i)
+	{
+		Simd::Lanes factor = Simd::mul(Simd::sub(Simd::mul(Simd::set(c_slerpU[i]), squareT), Simd::set(c_slerpV[i])), cosMinusOne);
+		weight = Simd::mulAdd(factor, weight, Simd::set(1.f));
+	}
+
+	return Simd::mul(t, weight);
+}
+#endif
+
+static void checkInterpolationSizes(size_t starts, size_t ends, size_t ts, size_t results)
+{
+	if (starts != ends || starts != ts || starts != results)
+	{
+		throw std::invalid_argument("Error: quaternions, factors and results have different sizes");
+	}
+}
+
+void LibMath::Quaternion::slerp(std::span<Quaternion const> qStarts, std::span<Quaternion const> qEnds, std::span<float const> ts, std::span<Quaternion> results)
+{
+	checkInterpolationSizes(qStarts.size(), qEnds.size(), ts.size(), results.size());
+
+	size_t i = 0;
+
+#if defined(LIBMATH_SIMD_SSE41)
+	float const* starts = reinterpret_cast<float const*>(qStarts.data());
+	float const* ends = reinterpret_cast<float const*>(qEnds.data());
+	float* outputs = reinterpret_cast<float*>(results.data());
+
+	for (; i + Simd::c_width <= qStarts.size(); i += Simd::c_width)
+	{
+		Simd::Lanes start[4];
+		Simd::Lanes end[4];
+		quatLoadComponents(starts + 4 * i, start);
+		quatLoadComponents(ends + 4 * i, end);
+		Simd::Lanes t = quatLoadFactors(ts.data() + i);
+
+		Simd::Lanes dot = Simd::mul(start[0], end[0]);
+		for (size_t component = 1; component < 4; ++component)
+		{
+			dot = Simd::mulAdd(start[component], end[component], dot);
+		}
+
+		// sign bit of the dot product, applied to the end weight for the shortest path
+		Simd::Lanes sign = Simd::bitAnd(dot, Simd::set(-0.f));
+		Simd::Lanes cosMinusOne = Simd::sub(Simd::bitXor(dot, sign), Simd::set(1.f));
+
+		Simd::Lanes weightStart = slerpWeightLanes(Simd::sub(Simd::set(1.f), t), cosMinusOne);
+		Simd::Lanes weightEnd = Simd::bitXor(slerpWeightLanes(t, cosMinusOne), sign);
+
+		Simd::Lanes result[4];
+		for (size_t component = 0; component < 4; ++component)
+		{
+			result[component] = Simd::mulAdd(start[component], weightStart, Simd::mul(end[component], weightEnd));
+		}
+
+		quatStoreComponents(outputs + 4 * i, result);
+	}
+#endif
+
+	for (; i < qStarts.size(); ++i)
+	{
+		results[i] = slerpFast(qStarts[i], qEnds[i], ts[i]);
+	}
+}
+
+void LibMath::Quaternion::nlerp(std::span<Quaternion const> qStarts, std::span<Quaternion const> qEnds, std::span<float const> ts, std::span<Quaternion> results)
+{
+	checkInterpolationSizes(qStarts.size(), qEnds.size(), ts.size(), results.size());
+
+	size_t i = 0;
+
+#if defined(LIBMATH_SIMD_SSE41)
+	float const* starts = reinterpret_cast<float const*>(qStarts.data());
+	float const* ends = reinterpret_cast<float const*>(qEnds.data());
+	float* outputs = reinterpret_cast<float*>(results.data());
+
+	for (; i + Simd::c_width <= qStarts.size(); i += Simd::c_width)
+	{
+		Simd::Lanes start[4];
+		Simd::Lanes end[4];
+		quatLoadComponents(starts + 4 * i, start);
+		quatLoadComponents(ends + 4 * i, end);
+		Simd::Lanes t = quatLoadFactors(ts.data() + i);
+		Simd::Lanes oneMinusT = Simd::sub(Simd::set(1.f), t);
+
+		Simd::Lanes result[4];
+		Simd::Lanes magSquare = Simd::set(0.f);
+		for (size_t component = 0; component < 4; ++component)
+		{
+			result[component] = Simd::mulAdd(start[component], oneMinusT, Simd::mul(end[component], t));
+			magSquare = Simd::mulAdd(result[component], result[component], magSquare);
+		}
+
+		Simd::Lanes magnitude = Simd::sqrt(magSquare);
+		for (size_t component = 0; component < 4; ++component)
+		{
+			result[component] = Simd::div(result[component], magnitude);
+		}
+
+		quatStoreComponents(outputs + 4 * i, result);
+	}
+#endif
+
+	for (; i < qStarts.size(); ++i)
+	{
+		results[i] = nlerpUnit(qStarts[i], qEnds[i], ts[i]);
+	}
+}
+
 float& LibMath::Quaternion::operator[](unsigned int index)
 {
 	switch (index)
@@ -274,6 +635,25 @@ float LibMath::Quaternion::operator[](unsigned int index) const
 
 LibMath::Quaternion LibMath::operator*(Quaternion const& q1, Quaternion const& q2)
 {
+#if defined(LIBMATH_SIMD_SSE41)
+	// (x, y, z, w) = w1 q2 + x1 (w2, -z2, y2, -x2) + y1 (z2, w2, -x2, -y2) + z1 (-y2, x2, w2, -z2)
+	__m128 const lhs = _mm_loadu_ps(reinterpret_cast<float const*>(&q1));
+	__m128 const rhs = _mm_loadu_ps(reinterpret_cast<float const*>(&q2));
+
+	__m128 const rhsX = _mm_xor_ps(_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(0, 1, 2, 3)), _mm_set_ps(-0.f, 0.f, -0.f, 0.f));
+	__m128 const rhsY = _mm_xor_ps(_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 0, 3, 2)), _mm_set_ps(-0.f, -0.f, 0.f, 0.f));
+	__m128 const rhsZ = _mm_xor_ps(_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(2, 3, 0, 1)), _mm_set_ps(-0.f, 0.f, 0.f, -0.f));
+
+	__m128 result = _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 3, 3, 3)), rhs);
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(0, 0, 0, 0)), rhsX));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(1, 1, 1, 1)), rhsY));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 2, 2, 2)), rhsZ));
+
+	Quaternion product;
+	_mm_storeu_ps(reinterpret_cast<float*>(&product), result);
+
+	return product;
+#else
 	Vector3 v1 = Vector3(q1.m_x, q1.m_y, q1.m_z);
 	Vector3 v2 = Vector3(q2.m_x, q2.m_y, q2.m_z);
 
@@ -285,6 +665,7 @@ LibMath::Quaternion LibMath::operator*(Quaternion const& q1, Quaternion const& q
 	Vector3 ImPart = v2 * q1.m_w + v1 * q2.m_w + cross;
 
 	return Quaternion(ImPart.m_x, ImPart.m_y, ImPart.m_z, RealPart);
+#endif
 }
 
 bool LibMath::operator==(Quaternion const& q1, Quaternion const& q2)
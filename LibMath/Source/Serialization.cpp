@@ -0,0 +1,577 @@
+#include "LibMath/Serialization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#pragma region Conversion
+
+/*
+* Half conversion done with float arithmetic, the rounding of the addition gives the round to nearest even
+* and the scaling flushes the values past the half range to infinity without branches
+*/
+std::uint16_t LibMath::Serialization::floatToHalf(float value)
+{
+	std::uint32_t const bits = std::bit_cast<std::uint32_t>(value);
+	std::uint32_t const shiftedBits = bits + bits;
+	std::uint32_t const sign = (bits & 0x80000000u) >> 16;
+
+	// 2^112 then 2^-110 : overflow to infinity, keep 2 extra bits below the half precision
+	float base = (std::abs(value) * 0x1.0p+112f) * 0x1.0p-110f;
+
+	std::uint32_t bias = std::max(shiftedBits & 0xFF000000u, 0x71000000u);
+	base = std::bit_cast<float>((bias >> 1) + 0x07800000u) + base;
+
+	std::uint32_t const baseBits = std::bit_cast<std::uint32_t>(base);
+	std::uint32_t const exponent = (baseBits >> 13) & 0x00007C00u;
+	std::uint32_t const mantissa = baseBits & 0x00000FFFu;
+
+	std::uint32_t const half = shiftedBits > 0xFF000000u ? 0x7E00u : exponent + mantissa;
+	return static_cast<std::uint16_t>(sign | half);
+}
+
+float LibMath::Serialization::halfToFloat(std::uint16_t half)
+{
+	std::uint32_t const bits = static_cast<std::uint32_t>(half) << 16;
+	std::uint32_t const sign = bits & 0x80000000u;
+	std::uint32_t const shiftedBits = bits + bits;
+
+	// normal : move the exponent and mantissa in place then rescale, infinity and NaN stay out of range
+	float const normal = std::bit_cast<float>((shiftedBits >> 4) + (0xE0u << 23)) * 0x1.0p-112f;
+
+	// subnormal : the mantissa becomes the low bits of 0.5 + mantissa * 2^-24
+	float const subnormal = std::bit_cast<float>((shiftedBits >> 17) | (126u << 23)) - 0.5f;
+
+	std::uint32_t const magnitude = shiftedBits < (1u << 27) ? std::bit_cast<std::uint32_t>(subnormal) : std::bit_cast<std::uint32_t>(normal);
+	return std::bit_cast<float>(sign | magnitude);
+}
+
+static float constexpr c_smallestThreeRange = 0.707106781f;		// 1 / sqrt(2), largest value of a component that is not the biggest
+static float constexpr c_smallestThreeSteps = 1022.f;			// 10 bits per component, even so 0 is exact
+
+std::uint32_t LibMath::Serialization::packQuaternion(Quaternion const& quat)
+{
+	Quaternion unit = quat;
+	if (unit.magnitudeSquare() == 0.f)
+	{
+		unit = Quaternion::identity();
+	}
+	unit.normalize();
+
+	unsigned int largest = 0;
+	for (unsigned int i = 1; i < 4; ++i)
+	{
+		if (std::abs(unit[i]) > std::abs(unit[largest]))
+		{
+			largest = i;
+		}
+	}
+
+	// q and -q are the same rotation, the dropped component is rebuilt as positive
+	float const sign = unit[largest] < 0.f ? -1.f : 1.f;
+
+	std::uint32_t packed = largest << 30;
+	int shift = 20;
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		if (i == largest)
+		{
+			continue;
+		}
+
+		float normalized = (sign * unit[i] / c_smallestThreeRange) * 0.5f + 0.5f;
+		normalized = std::clamp(normalized, 0.f, 1.f);
+
+		packed |= static_cast<std::uint32_t>(std::lround(normalized * c_smallestThreeSteps)) << shift;
+		shift -= 10;
+	}
+
+	return packed;
+}
+
+LibMath::Quaternion LibMath::Serialization::unpackQuaternion(std::uint32_t packed)
+{
+	unsigned int const largest = packed >> 30;
+
+	Quaternion result;
+	float squareSum = 0.f;
+	int shift = 20;
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		if (i == largest)
+		{
+			continue;
+		}
+
+		float const normalized = static_cast<float>((packed >> shift) & 0x3FFu) / c_smallestThreeSteps;
+		result[i] = (normalized - 0.5f) * 2.f * c_smallestThreeRange;
+		squareSum += result[i] * result[i];
+		shift -= 10;
+	}
+
+	result[largest] = std::sqrt(std::max(0.f, 1.f - squareSum));
+
+	return result;
+}
+
+#pragma endregion
+
+#pragma region Writer
+
+LibMath::Serialization::BinaryWriter::BinaryWriter(std::vector<std::byte>& buffer, Precision const precision) :
+	m_buffer(buffer), m_precision(precision)
+{
+}
+
+static void appendWord(std::vector<std::byte>& buffer, std::uint32_t word)
+{
+	if constexpr (std::endian::native == std::endian::big)
+	{
+		word = std::byteswap(word);
+	}
+
+	size_t const offset = buffer.size();
+	buffer.resize(offset + sizeof word);
+	std::memcpy(buffer.data() + offset, &word, sizeof word);
+}
+
+void LibMath::Serialization::BinaryWriter::writeFloats(float const* values, size_t const count)
+{
+	size_t const offset = m_buffer.size();
+
+	if (m_precision == Precision::Full)
+	{
+		m_buffer.resize(offset + count * sizeof(float));
+
+		if constexpr (std::endian::native == std::endian::little)
+		{
+			std::memcpy(m_buffer.data() + offset, values, count * sizeof(float));
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				std::uint32_t const word = std::byteswap(std::bit_cast<std::uint32_t>(values[i]));
+				std::memcpy(m_buffer.data() + offset + i * sizeof word, &word, sizeof word);
+			}
+		}
+	}
+	else
+	{
+		m_buffer.resize(offset + count * sizeof(std::uint16_t));
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			std::uint16_t half = floatToHalf(values[i]);
+			if constexpr (std::endian::native == std::endian::big)
+			{
+				half = std::byteswap(half);
+			}
+
+			std::memcpy(m_buffer.data() + offset + i * sizeof half, &half, sizeof half);
+		}
+	}
+}
+
+void LibMath::Serialization::BinaryWriter::writeCount(size_t const count)
+{
+	if (count > std::numeric_limits<std::uint32_t>::max())
+	{
+		throw std::length_error("Error: too many elements to serialize");
+	}
+
+	appendWord(m_buffer, static_cast<std::uint32_t>(count));
+}
+
+void LibMath::Serialization::BinaryWriter::write(float const value)
+{
+	writeFloats(&value, 1);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Radian const angle)
+{
+	write(angle.raw());
+}
+
+void LibMath::Serialization::BinaryWriter::write(Vector2 const& vec)
+{
+	float const values[] = { vec.m_x, vec.m_y };
+	writeFloats(values, 2);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Vector3 const& vec)
+{
+	float const values[] = { vec.m_x, vec.m_y, vec.m_z };
+	writeFloats(values, 3);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Vector4 const& vec)
+{
+	float const values[] = { vec.m_x, vec.m_y, vec.m_z, vec.m_w };
+	writeFloats(values, 4);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Matrix3 const& mat)
+{
+	writeFloats(mat.data(), 9);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Matrix4 const& mat)
+{
+	writeFloats(mat.data(), 16);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Quaternion const& quat)
+{
+	if (m_precision == Precision::Quantized)
+	{
+		appendWord(m_buffer, packQuaternion(quat));
+		return;
+	}
+
+	float const values[] = { quat.m_x, quat.m_y, quat.m_z, quat.m_w };
+	writeFloats(values, 4);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry2D::Point const& point)
+{
+	float const values[] = { point.m_x, point.m_y };
+	writeFloats(values, 2);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry2D::Line const& line)
+{
+	write(line.m_start);
+	write(line.m_end);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry2D::AABB const& aabb)
+{
+	write(aabb.m_center);
+	write(aabb.m_height);
+	write(aabb.m_width);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry2D::OBB const& obb)
+{
+	write(obb.m_center);
+	write(obb.m_height);
+	write(obb.m_width);
+	write(obb.m_rotation);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry2D::Circle const& circle)
+{
+	write(circle.m_center);
+	write(circle.m_radius);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry3D::Point const& point)
+{
+	float const values[] = { point.m_x, point.m_y, point.m_z };
+	writeFloats(values, 3);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry3D::Line const& line)
+{
+	write(line.m_origin);
+	write(line.m_direction);
+	write(line.m_length);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry3D::Plan const& plan)
+{
+	write(plan.m_normal);
+	write(plan.m_distance);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry3D::AABB const& aabb)
+{
+	write(aabb.m_center);
+	write(aabb.m_width);
+	write(aabb.m_height);
+	write(aabb.m_depth);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry3D::OBB const& obb)
+{
+	write(obb.m_center);
+	write(obb.m_width);
+	write(obb.m_height);
+	write(obb.m_depth);
+	write(obb.m_rotation);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry3D::Sphere const& sphere)
+{
+	write(sphere.m_center);
+	write(sphere.m_radius);
+}
+
+void LibMath::Serialization::BinaryWriter::write(Geometry3D::Capsule const& capsule)
+{
+	write(capsule.m_pointA);
+	write(capsule.m_pointB);
+	write(capsule.m_radius);
+}
+
+LibMath::Serialization::Precision LibMath::Serialization::BinaryWriter::getPrecision(void) const
+{
+	return m_precision;
+}
+
+size_t LibMath::Serialization::BinaryWriter::size(void) const
+{
+	return m_buffer.size();
+}
+
+#pragma endregion
+
+#pragma region Reader
+
+LibMath::Serialization::BinaryReader::BinaryReader(std::span<std::byte const> buffer, Precision const precision) :
+	m_buffer(buffer), m_precision(precision)
+{
+}
+
+void LibMath::Serialization::BinaryReader::require(size_t const byteCount) const
+{
+	if (byteCount > remaining())
+	{
+		throw std::out_of_range("Error: not enough data left in the buffer");
+	}
+}
+
+void LibMath::Serialization::BinaryReader::readFloats(float* values, size_t const count)
+{
+	std::byte const* source = m_buffer.data() + m_position;
+
+	if (m_precision == Precision::Full)
+	{
+		require(count * sizeof(float));
+
+		if constexpr (std::endian::native == std::endian::little)
+		{
+			std::memcpy(values, source, count * sizeof(float));
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				std::uint32_t word;
+				std::memcpy(&word, source + i * sizeof word, sizeof word);
+				values[i] = std::bit_cast<float>(std::byteswap(word));
+			}
+		}
+
+		m_position += count * sizeof(float);
+	}
+	else
+	{
+		require(count * sizeof(std::uint16_t));
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			std::uint16_t half;
+			std::memcpy(&half, source + i * sizeof half, sizeof half);
+			if constexpr (std::endian::native == std::endian::big)
+			{
+				half = std::byteswap(half);
+			}
+
+			values[i] = halfToFloat(half);
+		}
+
+		m_position += count * sizeof(std::uint16_t);
+	}
+}
+
+static std::uint32_t readWord(std::byte const* source)
+{
+	std::uint32_t word;
+	std::memcpy(&word, source, sizeof word);
+
+	if constexpr (std::endian::native == std::endian::big)
+	{
+		word = std::byteswap(word);
+	}
+
+	return word;
+}
+
+size_t LibMath::Serialization::BinaryReader::readCount(size_t const elementSize)
+{
+	require(sizeof(std::uint32_t));
+
+	size_t const count = readWord(m_buffer.data() + m_position);
+
+	// checked before any allocation, a corrupted count cannot request more memory than the buffer holds
+	if (count > (remaining() - sizeof(std::uint32_t)) / elementSize)
+	{
+		throw std::out_of_range("Error: array count larger than the data left in the buffer");
+	}
+
+	m_position += sizeof(std::uint32_t);
+	return count;
+}
+
+void LibMath::Serialization::BinaryReader::read(float& value)
+{
+	readFloats(&value, 1);
+}
+
+void LibMath::Serialization::BinaryReader::read(Radian& angle)
+{
+	float value;
+	readFloats(&value, 1);
+	angle = Radian(value);
+}
+
+void LibMath::Serialization::BinaryReader::read(Vector2& vec)
+{
+	float values[2];
+	readFloats(values, 2);
+	vec = Vector2(values[0], values[1]);
+}
+
+void LibMath::Serialization::BinaryReader::read(Vector3& vec)
+{
+	float values[3];
+	readFloats(values, 3);
+	vec = Vector3(values[0], values[1], values[2]);
+}
+
+void LibMath::Serialization::BinaryReader::read(Vector4& vec)
+{
+	float values[4];
+	readFloats(values, 4);
+	vec = Vector4(values[0], values[1], values[2], values[3]);
+}
+
+void LibMath::Serialization::BinaryReader::read(Matrix3& mat)
+{
+	readFloats(mat.data(), 9);
+}
+
+void LibMath::Serialization::BinaryReader::read(Matrix4& mat)
+{
+	readFloats(mat.data(), 16);
+}
+
+void LibMath::Serialization::BinaryReader::read(Quaternion& quat)
+{
+	if (m_precision == Precision::Quantized)
+	{
+		require(sizeof(std::uint32_t));
+
+		quat = unpackQuaternion(readWord(m_buffer.data() + m_position));
+		m_position += sizeof(std::uint32_t);
+		return;
+	}
+
+	float values[4];
+	readFloats(values, 4);
+	quat = Quaternion(values[0], values[1], values[2], values[3]);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry2D::Point& point)
+{
+	float values[2];
+	readFloats(values, 2);
+	point = Geometry2D::Point(values[0], values[1]);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry2D::Line& line)
+{
+	read(line.m_start);
+	read(line.m_end);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry2D::AABB& aabb)
+{
+	read(aabb.m_center);
+	read(aabb.m_height);
+	read(aabb.m_width);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry2D::OBB& obb)
+{
+	read(obb.m_center);
+	read(obb.m_height);
+	read(obb.m_width);
+	read(obb.m_rotation);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry2D::Circle& circle)
+{
+	read(circle.m_center);
+	read(circle.m_radius);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry3D::Point& point)
+{
+	float values[3];
+	readFloats(values, 3);
+	point = Geometry3D::Point(values[0], values[1], values[2]);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry3D::Line& line)
+{
+	read(line.m_origin);
+	read(line.m_direction);
+	read(line.m_length);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry3D::Plan& plan)
+{
+	read(plan.m_normal);
+	read(plan.m_distance);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry3D::AABB& aabb)
+{
+	read(aabb.m_center);
+	read(aabb.m_width);
+	read(aabb.m_height);
+	read(aabb.m_depth);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry3D::OBB& obb)
+{
+	read(obb.m_center);
+	read(obb.m_width);
+	read(obb.m_height);
+	read(obb.m_depth);
+	read(obb.m_rotation);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry3D::Sphere& sphere)
+{
+	read(sphere.m_center);
+	read(sphere.m_radius);
+}
+
+void LibMath::Serialization::BinaryReader::read(Geometry3D::Capsule& capsule)
+{
+	read(capsule.m_pointA);
+	read(capsule.m_pointB);
+	read(capsule.m_radius);
+}
+
+LibMath::Serialization::Precision LibMath::Serialization::BinaryReader::getPrecision(void) const
+{
+	return m_precision;
+}
+
+size_t LibMath::Serialization::BinaryReader::position(void) const
+{
+	return m_position;
+}
+
+size_t LibMath::Serialization::BinaryReader::remaining(void) const
+{
+	return m_buffer.size() - m_position;
+}
+
+#pragma endregion
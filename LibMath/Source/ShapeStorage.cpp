@@ -0,0 +1,85 @@
+#include "LibMath/ShapeStorage.h"
+
+#include <type_traits>
+
+#pragma region Shape Storage
+
+template <typename Function>
+static decltype(auto) dispatch(LibMath::Geometry3D::ShapeType const type, Function&& function)
+{
+	using namespace LibMath::Geometry3D;
+
+	switch (type)
+	{
+	case ShapeType::Point:		return function(std::type_identity<Point>{});
+	case ShapeType::Line:		return function(std::type_identity<Line>{});
+	case ShapeType::Plan:		return function(std::type_identity<Plan>{});
+	case ShapeType::AABB:		return function(std::type_identity<AABB>{});
+	case ShapeType::OBB:		return function(std::type_identity<OBB>{});
+	case ShapeType::Sphere:		return function(std::type_identity<Sphere>{});
+	case ShapeType::Capsule:	return function(std::type_identity<Capsule>{});
+	}
+
+	throw std::out_of_range("Error: invalid shape handle");
+}
+
+LibMath::Geometry3D::ShapeHandle LibMath::Geometry3D::ShapeStorage::add(Shape const& shape)
+{
+	return std::visit([this](auto const& alternative) { return add(alternative); }, shape);
+}
+
+void LibMath::Geometry3D::ShapeStorage::remove(ShapeHandle const handle)
+{
+	dispatch(handle.m_type, [this, handle](auto type)
+	{
+		using T = typename decltype(type)::type;
+
+		Pool<T>& shapes = pool<T>();
+		int slot = slotOf<T>(handle);
+		int last = static_cast<int>(shapes.m_shapes.size()) - 1;
+
+		// the last shape fills the hole, only its id changes slot
+		if (slot != last)
+		{
+			shapes.m_shapes[slot] = shapes.m_shapes[last];
+			shapes.m_idOfSlot[slot] = shapes.m_idOfSlot[last];
+			shapes.m_slotOfId[shapes.m_idOfSlot[slot]] = slot;
+		}
+
+		shapes.m_shapes.pop_back();
+		shapes.m_idOfSlot.pop_back();
+		shapes.m_slotOfId[handle.m_id] = -1;
+		shapes.m_freeIds.push_back(handle.m_id);
+	});
+}
+
+LibMath::Geometry3D::Shape LibMath::Geometry3D::ShapeStorage::getShape(ShapeHandle const handle) const
+{
+	return dispatch(handle.m_type, [this, handle](auto type) -> Shape
+	{
+		using T = typename decltype(type)::type;
+
+		return get<T>(handle);
+	});
+}
+
+void LibMath::Geometry3D::ShapeStorage::update(Matrix4 const& transMat)
+{
+	// pool by pool, the update of each shape type is resolved at compile time
+	forEach([&transMat](auto& shape) { shape.update(transMat); });
+}
+
+size_t LibMath::Geometry3D::ShapeStorage::size(void) const
+{
+	size_t count = 0;
+	std::apply([&count](auto const&... pools) { count = (... + pools.m_shapes.size()); }, m_pools);
+
+	return count;
+}
+
+void LibMath::Geometry3D::ShapeStorage::clear(void)
+{
+	std::apply([](auto&... pools) { (..., (pools = {})); }, m_pools);
+}
+
+#pragma endregion
@@ -0,0 +1,193 @@
+#include "LibMath/SweepAndPrune.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#pragma region Sweep And Prune
+
+LibMath::Collision2D::SweepAndPrune::SweepAndPrune(Axis const axis)
+	: m_axis(axis)
+{
+}
+
+int LibMath::Collision2D::SweepAndPrune::insert(Geometry2D::AABB const& bounds)
+{
+	int proxy;
+
+	if (m_freeProxies.empty())
+	{
+		proxy = static_cast<int>(m_intervalOfProxy.size());
+		m_intervalOfProxy.push_back(-1);
+	}
+	else
+	{
+		proxy = m_freeProxies.back();
+		m_freeProxies.pop_back();
+	}
+
+	// Appended at the end, the next sort moves it into place
+	m_intervalOfProxy[proxy] = static_cast<int>(m_intervals.size());
+	m_intervals.push_back(toInterval(bounds, proxy));
+	++m_insertedCount;
+
+	return proxy;
+}
+
+void LibMath::Collision2D::SweepAndPrune::remove(int const proxy)
+{
+	checkProxy(proxy);
+
+	int index = m_intervalOfProxy[proxy];
+	m_intervals.erase(m_intervals.begin() + index);
+
+	for (int i = index; i < static_cast<int>(m_intervals.size()); ++i)
+	{
+		m_intervalOfProxy[m_intervals[i].m_proxy] = i;
+	}
+
+	m_intervalOfProxy[proxy] = -1;
+	m_freeProxies.push_back(proxy);
+}
+
+void LibMath::Collision2D::SweepAndPrune::move(int const proxy, Geometry2D::AABB const& bounds)
+{
+	checkProxy(proxy);
+
+	m_intervals[m_intervalOfProxy[proxy]] = toInterval(bounds, proxy);
+}
+
+void LibMath::Collision2D::SweepAndPrune::queryPairs(std::vector<std::pair<int, int>>& result)
+{
+	sort();
+
+	size_t count = m_intervals.size();
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		Interval const& interval = m_intervals[i];
+
+		// Only the intervals starting before this one ends can overlap it on the sweep axis
+		for (size_t j = i + 1; j < count && m_intervals[j].m_min <= interval.m_max; ++j)
+		{
+			Interval const& other = m_intervals[j];
+
+			if (interval.m_crossMin <= other.m_crossMax && other.m_crossMin <= interval.m_crossMax)
+			{
+				result.emplace_back(std::min(interval.m_proxy, other.m_proxy), std::max(interval.m_proxy, other.m_proxy));
+			}
+		}
+	}
+}
+
+LibMath::Collision2D::SweepAndPrune::Axis LibMath::Collision2D::SweepAndPrune::getAxis(void) const
+{
+	return m_axis;
+}
+
+void LibMath::Collision2D::SweepAndPrune::setAxis(Axis const axis)
+{
+	if (axis == m_axis)
+	{
+		return;
+	}
+
+	m_axis = axis;
+
+	for (Interval& interval : m_intervals)
+	{
+		std::swap(interval.m_min, interval.m_crossMin);
+		std::swap(interval.m_max, interval.m_crossMax);
+	}
+
+	// The old order says nothing about the new axis, an insertion sort would be quadratic
+	fullSort();
+}
+
+size_t LibMath::Collision2D::SweepAndPrune::size(void) const
+{
+	return m_intervals.size();
+}
+
+void LibMath::Collision2D::SweepAndPrune::clear(void)
+{
+	m_intervals.clear();
+	m_intervalOfProxy.clear();
+	m_freeProxies.clear();
+	m_insertedCount = 0;
+}
+
+LibMath::Collision2D::SweepAndPrune::Interval LibMath::Collision2D::SweepAndPrune::toInterval(Geometry2D::AABB const& bounds, int const proxy) const
+{
+	float minX = bounds.m_center.m_x - bounds.extentX();
+	float maxX = bounds.m_center.m_x + bounds.extentX();
+	float minY = bounds.m_center.m_y - bounds.extentY();
+	float maxY = bounds.m_center.m_y + bounds.extentY();
+
+	if (m_axis == Axis::X)
+	{
+		return Interval{ minX, maxX, minY, maxY, proxy };
+	}
+
+	return Interval{ minY, maxY, minX, maxX, proxy };
+}
+
+void LibMath::Collision2D::SweepAndPrune::sort(void)
+{
+	// Many new proxies at the end of the array (first frame, level load) make the insertion sort quadratic
+	if (m_insertedCount * 8 > m_intervals.size())
+	{
+		fullSort();
+		return;
+	}
+
+	m_insertedCount = 0;
+
+	// Insertion sort, close to linear when the proxies moved a little since the last frame
+	int count = static_cast<int>(m_intervals.size());
+
+	for (int i = 1; i < count; ++i)
+	{
+		if (m_intervals[i - 1].m_min <= m_intervals[i].m_min)
+		{
+			continue;
+		}
+
+		Interval interval = m_intervals[i];
+		int j = i;
+
+		while (j > 0 && m_intervals[j - 1].m_min > interval.m_min)
+		{
+			m_intervals[j] = m_intervals[j - 1];
+			m_intervalOfProxy[m_intervals[j].m_proxy] = j;
+			--j;
+		}
+
+		m_intervals[j] = interval;
+		m_intervalOfProxy[interval.m_proxy] = j;
+	}
+}
+
+void LibMath::Collision2D::SweepAndPrune::fullSort(void)
+{
+	std::sort(m_intervals.begin(), m_intervals.end(), [](Interval const& lhs, Interval const& rhs)
+		{
+			return lhs.m_min < rhs.m_min;
+		});
+
+	for (int i = 0; i < static_cast<int>(m_intervals.size()); ++i)
+	{
+		m_intervalOfProxy[m_intervals[i].m_proxy] = i;
+	}
+
+	m_insertedCount = 0;
+}
+
+void LibMath::Collision2D::SweepAndPrune::checkProxy(int const proxy) const
+{
+	if (proxy < 0 || proxy >= static_cast<int>(m_intervalOfProxy.size()) || m_intervalOfProxy[proxy] == -1)
+	{
+		throw std::out_of_range("Error: invalid proxy");
+	}
+}
+
+#pragma endregion
@@ -0,0 +1,68 @@
+#include "LibMath/Transform.h"
+
+#include <stdexcept>
+
+LibMath::Transform::Transform(Vector3 const& translation, Quaternion const& rotation, Vector3 const& scale)
+	: m_translation(translation), m_rotation(rotation), m_scale(scale)
+{
+}
+
+LibMath::Transform::Transform(Matrix4 const& mat)
+{
+	mat.decompose(m_translation, m_rotation, m_scale);
+}
+
+LibMath::Transform LibMath::Transform::inverse(void) const
+{
+	if (m_scale.m_x == 0.f || m_scale.m_y == 0.f || m_scale.m_z == 0.f)
+	{
+		throw std::runtime_error("Error: cannot invert a transform with a zero scale");
+	}
+
+	// (T R S)^-1 = S^-1 R^-1 T^-1, kept in T R S order : exact for a uniform scale
+	Vector3 inverseScale = Vector3::one() / m_scale;
+	Quaternion inverseRotation = m_rotation.conjugate();
+
+	return Transform(inverseScale * inverseRotation.rotate(-m_translation), inverseRotation, inverseScale);
+}
+
+LibMath::Matrix4 LibMath::Transform::toMatrix(void) const
+{
+	// rotation columns scaled by the scale of their axis, the translation in the last column
+	Matrix4 result = m_rotation.toMatrix4();
+	float* m = result.data();
+
+	for (int column = 0; column < 3; ++column)
+	{
+		m[column * 4] *= m_scale[column];
+		m[column * 4 + 1] *= m_scale[column];
+		m[column * 4 + 2] *= m_scale[column];
+	}
+
+	m[12] = m_translation.m_x;
+	m[13] = m_translation.m_y;
+	m[14] = m_translation.m_z;
+
+	return result;
+}
+
+LibMath::Vector3 LibMath::Transform::transformPoint(Vector3 const& point) const
+{
+	return m_translation + m_rotation.rotate(m_scale * point);
+}
+
+LibMath::Vector3 LibMath::Transform::transformDirection(Vector3 const& direction) const
+{
+	return m_rotation.rotate(m_scale * direction);
+}
+
+LibMath::Transform LibMath::Transform::identity(void)
+{
+	return Transform();
+}
+
+LibMath::Transform LibMath::operator*(Transform const& parent, Transform const& child)
+{
+	return Transform(parent.m_translation + parent.m_rotation.rotate(parent.m_scale * child.m_translation),
+		parent.m_rotation * child.m_rotation, parent.m_scale * child.m_scale);
+}
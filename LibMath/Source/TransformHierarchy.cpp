@@ -0,0 +1,223 @@
+#include "LibMath/TransformHierarchy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+#pragma region Transform Hierarchy
+
+int LibMath::TransformHierarchy::addNode(Matrix4 const& local, int const parent)
+{
+	if (parent != noParent)
+	{
+		checkNode(parent);
+	}
+
+	int node = static_cast<int>(m_locals.size());
+	int subtree;
+
+	if (parent == noParent)
+	{
+		subtree = static_cast<int>(m_subtrees.size());
+		m_subtrees.emplace_back();
+		m_subtreeDirty.push_back(0);
+	}
+	else
+	{
+		subtree = m_subtreeOfNode[parent];
+	}
+
+	m_locals.push_back(local);
+	m_worlds.push_back(local);
+	m_parents.push_back(parent);
+	m_subtreeOfNode.push_back(subtree);
+	m_dirty.push_back(0);
+	m_subtrees[subtree].push_back(node);
+
+	// the world matrix is only known once the parent is up to date
+	m_dirty[node] = 1;
+	if (!m_subtreeDirty[subtree])
+	{
+		m_subtreeDirty[subtree] = 1;
+		m_dirtySubtrees.push_back(subtree);
+	}
+
+	return node;
+}
+
+void LibMath::TransformHierarchy::setLocal(int const node, Matrix4 const& local)
+{
+	checkNode(node);
+
+	m_locals[node] = local;
+	m_dirty[node] = 1;
+
+	int subtree = m_subtreeOfNode[node];
+	if (!m_subtreeDirty[subtree])
+	{
+		m_subtreeDirty[subtree] = 1;
+		m_dirtySubtrees.push_back(subtree);
+	}
+}
+
+void LibMath::TransformHierarchy::setLocal(int const node, Transform const& local)
+{
+	setLocal(node, local.toMatrix());
+}
+
+LibMath::Matrix4 const& LibMath::TransformHierarchy::getLocal(int const node) const
+{
+	checkNode(node);
+
+	return m_locals[node];
+}
+
+LibMath::Matrix4 const& LibMath::TransformHierarchy::getWorld(int const node) const
+{
+	checkNode(node);
+
+	return m_worlds[node];
+}
+
+int LibMath::TransformHierarchy::getParent(int const node) const
+{
+	checkNode(node);
+
+	return m_parents[node];
+}
+
+bool LibMath::TransformHierarchy::isDirty(int const node) const
+{
+	checkNode(node);
+
+	return m_dirty[node] != 0;
+}
+
+void LibMath::TransformHierarchy::update(void)
+{
+	for (int subtree : m_dirtySubtrees)
+	{
+		updateSubtree(subtree);
+	}
+
+	m_dirtySubtrees.clear();
+}
+
+void LibMath::TransformHierarchy::updateParallel(unsigned int threadCount)
+{
+	if (threadCount == 0)
+	{
+		threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	// a thread per subtree at most, and enough nodes per thread to pay for starting it
+	size_t dirtyNodes = 0;
+	for (int subtree : m_dirtySubtrees)
+	{
+		dirtyNodes += m_subtrees[subtree].size();
+	}
+
+	threadCount = std::min(threadCount, static_cast<unsigned int>(m_dirtySubtrees.size()));
+	threadCount = std::min(threadCount, static_cast<unsigned int>(dirtyNodes / minNodesPerThread));
+
+	if (threadCount <= 1)
+	{
+		update();
+		return;
+	}
+
+	// the subtrees share no node, each worker takes the next dirty one until none is left
+	std::atomic<size_t> next = 0;
+	auto worker = [this, &next]()
+	{
+		for (size_t index = next++; index < m_dirtySubtrees.size(); index = next++)
+		{
+			updateSubtree(m_dirtySubtrees[index]);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount - 1);
+
+	for (unsigned int i = 1; i < threadCount; ++i)
+	{
+		threads.emplace_back(worker);
+	}
+
+	worker();
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	m_dirtySubtrees.clear();
+}
+
+size_t LibMath::TransformHierarchy::size(void) const
+{
+	return m_locals.size();
+}
+
+void LibMath::TransformHierarchy::reserve(size_t const nodeCount)
+{
+	m_locals.reserve(nodeCount);
+	m_worlds.reserve(nodeCount);
+	m_parents.reserve(nodeCount);
+	m_subtreeOfNode.reserve(nodeCount);
+	m_dirty.reserve(nodeCount);
+}
+
+void LibMath::TransformHierarchy::clear(void)
+{
+	m_locals.clear();
+	m_worlds.clear();
+	m_parents.clear();
+	m_subtreeOfNode.clear();
+	m_dirty.clear();
+	m_subtrees.clear();
+	m_dirtySubtrees.clear();
+	m_subtreeDirty.clear();
+}
+
+void LibMath::TransformHierarchy::updateSubtree(int const subtree)
+{
+	std::vector<int> const& nodes = m_subtrees[subtree];
+
+	// parents come first : a node is stale when itself or its parent is, the flags are only reset once the whole subtree is done
+	for (int node : nodes)
+	{
+		int parent = m_parents[node];
+
+		if (parent == noParent)
+		{
+			if (m_dirty[node])
+			{
+				m_worlds[node] = m_locals[node];
+			}
+		}
+		else if (m_dirty[node] || m_dirty[parent])
+		{
+			m_dirty[node] = 1;
+			m_worlds[node] = m_worlds[parent] * m_locals[node];
+		}
+	}
+
+	for (int node : nodes)
+	{
+		m_dirty[node] = 0;
+	}
+
+	m_subtreeDirty[subtree] = 0;
+}
+
+void LibMath::TransformHierarchy::checkNode(int const node) const
+{
+	if (node < 0 || node >= static_cast<int>(m_locals.size()))
+	{
+		throw std::out_of_range("Error: invalid node");
+	}
+}
+
+#pragma endregion
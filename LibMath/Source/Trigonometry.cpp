@@ -1,5 +1,14 @@
 #include "LibMath/Trigonometry.h"
+#include "LibMath/Simd.h"
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+// the array versions read the angles as floats
+static_assert(sizeof(LibMath::Radian) == sizeof(float) && std::is_standard_layout_v<LibMath::Radian>);
 
 float LibMath::sin(Radian rad)
 {
@@ -35,3 +44,305 @@ LibMath::Radian LibMath::atan(float val1, float val2)
 {
 	return Radian(std::atan2(val1, val2));
 }
+
+LibMath::SinCos LibMath::sincos(Radian rad)
+{
+	float wrapped = rad.radian();
+
+	return SinCos{ std::sin(wrapped), std::cos(wrapped) };
+}
+
+#pragma region Fast Trigonometry
+
+float constexpr c_twoOverPi = 0.636619772367581f;
+
+// pi / 2 split in 3 parts, j * c_halfPi1 and j * c_halfPi2 are exact for the quadrants of |angle| <= c_fastTrigLimit
+float constexpr c_halfPi1 = 1.5703125f;
+float constexpr c_halfPi2 = 4.837512969970703125e-4f;
+float constexpr c_halfPi3 = 7.54978995489188216e-8f;
+float constexpr c_fastTrigLimit = 8192.f;
+
+// Cephes minimax polynomials on [-pi/4, pi/4]
+float constexpr c_sin1 = -1.6666654611e-1f;
+float constexpr c_sin2 = 8.3321608736e-3f;
+float constexpr c_sin3 = -1.9515295891e-4f;
+float constexpr c_cos1 = 4.166664568298827e-2f;
+float constexpr c_cos2 = -1.388731625493765e-3f;
+float constexpr c_cos3 = 2.443315711809948e-5f;
+
+static LibMath::SinCos sincosPolynomial(float angle)
+{
+	if (!(std::abs(angle) <= c_fastTrigLimit))
+	{
+		// NaN, infinity or a quarter past the exact reduction, converting it to an int would be undefined, std::sin gives NaN
+		float nan = std::numeric_limits<float>::quiet_NaN();
+		return LibMath::SinCos{ nan, nan };
+	}
+
+	// closest quarter turn, then the remainder in [-pi/4, pi/4]
+	int quarter = static_cast<int>(angle * c_twoOverPi + std::copysign(0.5f, angle));
+	float quarterFloat = static_cast<float>(quarter);
+	float x = angle - quarterFloat * c_halfPi1;
+	x -= quarterFloat * c_halfPi2;
+	x -= quarterFloat * c_halfPi3;
+
+	float z = x * x;
+	uint32_t sinBits = std::bit_cast<uint32_t>(x + x * z * (c_sin1 + z * (c_sin2 + z * c_sin3)));
+	uint32_t cosBits = std::bit_cast<uint32_t>(1.f - 0.5f * z + z * z * (c_cos1 + z * (c_cos2 + z * c_cos3)));
+
+	/*
+	* odd quarters swap sin and cos, quarters 2 and 3 negate the sin, quarters 1 and 2 negate the cos
+	* done on the bits, the quarter of random angles would mispredict every branch
+	*/
+	uint32_t swap = 0u - static_cast<uint32_t>(quarter & 1);
+	uint32_t sinResult = (sinBits & ~swap) | (cosBits & swap);
+	uint32_t cosResult = (cosBits & ~swap) | (sinBits & swap);
+
+	sinResult ^= static_cast<uint32_t>(quarter & 2) << 30;
+	cosResult ^= static_cast<uint32_t>((quarter + 1) & 2) << 30;
+
+	return LibMath::SinCos{ std::bit_cast<float>(sinResult), std::bit_cast<float>(cosResult) };
+}
+
+float LibMath::sinFast(Radian rad)
+{
+	return sincosFast(rad).m_sin;
+}
+
+float LibMath::cosFast(Radian rad)
+{
+	return sincosFast(rad).m_cos;
+}
+
+LibMath::SinCos LibMath::sincosFast(Radian rad)
+{
+	float angle = rad.raw();
+
+	if (std::isfinite(angle) && std::abs(angle) > c_fastTrigLimit)
+	{
+		// the quadrant would not fit the exact products of the reduction
+		angle = rad.radian();
+	}
+
+	return sincosPolynomial(angle);
+}
+
+LibMath::Radian LibMath::atanFast(float val)
+{
+	// Cephes atanf : reduce |val| to [0, tan(pi / 8)] around 0, pi / 4 or pi / 2
+	float x = std::abs(val);
+	float offset = 0.f;
+
+	if (x > 2.414213562373095f)
+	{
+		offset = c_half_pi;
+		x = -1.f / x;
+	}
+	else if (x > 0.4142135623730950f)
+	{
+		offset = c_half_pi * 0.5f;
+		x = (x - 1.f) / (x + 1.f);
+	}
+
+	float z = x * x;
+	float result = offset + (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * x + x;
+
+	return Radian(val < 0.f ? -result : result);
+}
+
+LibMath::Radian LibMath::atanFast(float val1, float val2)
+{
+	if (val2 == 0.f)
+	{
+		if (val1 == 0.f)
+		{
+			return Radian(0.f);
+		}
+
+		return Radian(val1 > 0.f ? c_half_pi : -c_half_pi);
+	}
+
+	float angle = atanFast(val1 / val2).raw();
+
+	if (val2 < 0.f)
+	{
+		// left half plane, atan(val1 / val2) points the opposite way
+		angle += val1 < 0.f ? -c_pi : c_pi;
+	}
+
+	return Radian(angle);
+}
+
+/*
+* Lane helpers of the array versions, on top of LibMath/Simd.h
+* The quadrant selects and negates the polynomials through its 2 low bits
+*/
+namespace Simd = LibMath::Simd;
+
+#if defined(LIBMATH_SIMD_AVX2)
+using TrigInts = __m256i;
+
+static bool trigOutOfRange(Simd::Lanes lanes)
+{
+	// NaN lanes too
+	__m256 magnitude = _mm256_andnot_ps(_mm256_set1_ps(-0.f), lanes);
+	return _mm256_movemask_ps(_mm256_cmp_ps(magnitude, _mm256_set1_ps(c_fastTrigLimit), _CMP_NLE_UQ)) != 0;
+}
+static TrigInts trigToInts(Simd::Lanes lanes) { return _mm256_cvtps_epi32(lanes); }
+static Simd::Lanes trigBitMask(TrigInts ints, int bit) { return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(ints, _mm256_set1_epi32(bit)), _mm256_set1_epi32(bit))); }
+static TrigInts trigIncrement(TrigInts ints) { return _mm256_add_epi32(ints, _mm256_set1_epi32(1)); }
+#elif defined(LIBMATH_SIMD_SSE41)
+using TrigInts = __m128i;
+
+static bool trigOutOfRange(Simd::Lanes lanes)
+{
+	// NaN lanes too
+	__m128 magnitude = _mm_andnot_ps(_mm_set1_ps(-0.f), lanes);
+	return _mm_movemask_ps(_mm_cmpnle_ps(magnitude, _mm_set1_ps(c_fastTrigLimit))) != 0;
+}
+static TrigInts trigToInts(Simd::Lanes lanes) { return _mm_cvtps_epi32(lanes); }
+static Simd::Lanes trigBitMask(TrigInts ints, int bit) { return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(ints, _mm_set1_epi32(bit)), _mm_set1_epi32(bit))); }
+static TrigInts trigIncrement(TrigInts ints) { return _mm_add_epi32(ints, _mm_set1_epi32(1)); }
+#endif
+
+#if defined(LIBMATH_SIMD_SSE41)
+static Simd::Lanes trigNegate(Simd::Lanes mask, Simd::Lanes lanes) { return Simd::bitXor(lanes, Simd::bitAnd(mask, Simd::set(-0.f))); }
+
+static void sincosLanes(Simd::Lanes angles, Simd::Lanes& sinLanes, Simd::Lanes& cosLanes)
+{
+	// same steps as sincosPolynomial
+	Simd::Lanes quarter = Simd::roundNearest(Simd::mul(angles, Simd::set(c_twoOverPi)));
+	Simd::Lanes x = Simd::negMulAdd(quarter, Simd::set(c_halfPi1), angles);
+	x = Simd::negMulAdd(quarter, Simd::set(c_halfPi2), x);
+	x = Simd::negMulAdd(quarter, Simd::set(c_halfPi3), x);
+
+	Simd::Lanes z = Simd::mul(x, x);
+	Simd::Lanes sinX = Simd::mulAdd(Simd::mul(x, z), Simd::mulAdd(z, Simd::mulAdd(z, Simd::set(c_sin3), Simd::set(c_sin2)), Simd::set(c_sin1)), x);
+	Simd::Lanes cosX = Simd::mulAdd(Simd::mul(z, z), Simd::mulAdd(z, Simd::mulAdd(z, Simd::set(c_cos3), Simd::set(c_cos2)), Simd::set(c_cos1)), Simd::negMulAdd(z, Simd::set(0.5f), Simd::set(1.f)));
+
+	// odd quarters swap sin and cos, quarters 2 and 3 negate the sin, quarters 1 and 2 negate the cos
+	TrigInts quarterInts = trigToInts(quarter);
+	Simd::Lanes swap = trigBitMask(quarterInts, 1);
+
+	sinLanes = trigNegate(trigBitMask(quarterInts, 2), Simd::select(swap, cosX, sinX));
+	cosLanes = trigNegate(trigBitMask(trigIncrement(quarterInts), 2), Simd::select(swap, sinX, cosX));
+}
+#endif
+
+static void checkTrigSize(size_t rads, size_t results)
+{
+	if (rads != results)
+	{
+		throw std::invalid_argument("Error: angles and results have different sizes");
+	}
+}
+
+void LibMath::sin(std::span<Radian const> rads, std::span<float> results)
+{
+	checkTrigSize(rads.size(), results.size());
+
+	size_t i = 0;
+
+#if defined(LIBMATH_SIMD_SSE41)
+	float const* angles = reinterpret_cast<float const*>(rads.data());
+
+	for (; i + Simd::c_width <= rads.size(); i += Simd::c_width)
+	{
+		Simd::Lanes lanes = Simd::loadUnaligned(angles + i);
+		if (trigOutOfRange(lanes))
+		{
+			for (size_t lane = i; lane < i + Simd::c_width; ++lane)
+			{
+				results[lane] = sinFast(rads[lane]);
+			}
+			continue;
+		}
+
+		Simd::Lanes sinLanes;
+		Simd::Lanes cosLanes;
+		sincosLanes(lanes, sinLanes, cosLanes);
+		Simd::storeUnaligned(results.data() + i, sinLanes);
+	}
+#endif
+
+	for (; i < rads.size(); ++i)
+	{
+		results[i] = sinFast(rads[i]);
+	}
+}
+
+void LibMath::cos(std::span<Radian const> rads, std::span<float> results)
+{
+	checkTrigSize(rads.size(), results.size());
+
+	size_t i = 0;
+
+#if defined(LIBMATH_SIMD_SSE41)
+	float const* angles = reinterpret_cast<float const*>(rads.data());
+
+	for (; i + Simd::c_width <= rads.size(); i += Simd::c_width)
+	{
+		Simd::Lanes lanes = Simd::loadUnaligned(angles + i);
+		if (trigOutOfRange(lanes))
+		{
+			for (size_t lane = i; lane < i + Simd::c_width; ++lane)
+			{
+				results[lane] = cosFast(rads[lane]);
+			}
+			continue;
+		}
+
+		Simd::Lanes sinLanes;
+		Simd::Lanes cosLanes;
+		sincosLanes(lanes, sinLanes, cosLanes);
+		Simd::storeUnaligned(results.data() + i, cosLanes);
+	}
+#endif
+
+	for (; i < rads.size(); ++i)
+	{
+		results[i] = cosFast(rads[i]);
+	}
+}
+
+void LibMath::sincos(std::span<Radian const> rads, std::span<float> sinResults, std::span<float> cosResults)
+{
+	checkTrigSize(rads.size(), sinResults.size());
+	checkTrigSize(rads.size(), cosResults.size());
+
+	size_t i = 0;
+
+#if defined(LIBMATH_SIMD_SSE41)
+	float const* angles = reinterpret_cast<float const*>(rads.data());
+
+	for (; i + Simd::c_width <= rads.size(); i += Simd::c_width)
+	{
+		Simd::Lanes lanes = Simd::loadUnaligned(angles + i);
+		if (trigOutOfRange(lanes))
+		{
+			for (size_t lane = i; lane < i + Simd::c_width; ++lane)
+			{
+				SinCos result = sincosFast(rads[lane]);
+				sinResults[lane] = result.m_sin;
+				cosResults[lane] = result.m_cos;
+			}
+			continue;
+		}
+
+		Simd::Lanes sinLanes;
+		Simd::Lanes cosLanes;
+		sincosLanes(lanes, sinLanes, cosLanes);
+		Simd::storeUnaligned(sinResults.data() + i, sinLanes);
+		Simd::storeUnaligned(cosResults.data() + i, cosLanes);
+	}
+#endif
+
+	for (; i < rads.size(); ++i)
+	{
+		SinCos result = sincosFast(rads[i]);
+		sinResults[i] = result.m_sin;
+		cosResults[i] = result.m_cos;
+	}
+}
+
+#pragma endregion
@@ -2,173 +2,28 @@
 #include "LibMath/Matrix/Matrix3.h"
 #include "LibMath/GeometricObject3.h"
 #include "LibMath/Quaternion.h"
+#include "LibMath/Vector/Vector3Batch.h"
+#include "LibMath/Simd.h"
+#include <algorithm>
+#include <charconv>
 #include <cmath>
+#include <cstring>
+#include <new>
 
 #define EPSILON 1e-5
 
 #pragma region Vector2D
-LibMath::Vector2::Vector2()
-{
-	m_x = 0.0f;
-	m_y = 0.0f;
-}
-
-LibMath::Vector2::Vector2(float val)
-{
-	m_x = val;
-	m_y = val;
-}
-
-LibMath::Vector2::Vector2(float valx, float valy)
-{
-	m_x = valx;
-	m_y = valy;
-}
-
-LibMath::Vector2::Vector2(Vector2 const& other)
-{
-	m_x = other.m_x;
-	m_y = other.m_y;
-}
-
 LibMath::Vector2::Vector2(Geometry2D::Point const& point)
 {
 	m_x = point.m_x;
 	m_y = point.m_y;                                                                                                                          
 }
 
-float& LibMath::Vector2::operator[](int n)
-{
-	if (n == 0)
-	{
-		return m_x;
-	}
-
-	if (n == 1)
-	{
-		return m_y;
-	}
-
-	throw(std::invalid_argument("Invalid argument"));
-}
-
-float LibMath::Vector2::operator[](int n) const
-{
-	if (n == 0)
-	{
-		return m_x;
-	}
-
-	if (n == 1)
-	{
-		return m_y;
-	}
-
-	throw(std::invalid_argument("Invalid argument"));;
-}
-
-LibMath::Vector2& LibMath::Vector2::operator=(const Vector2& other)
-{
-	m_x = other.m_x;
-	m_y = other.m_y;
-
-	return *this;
-}
-
-LibMath::Vector2& LibMath::Vector2::operator-(void)
-{
-	m_x = -m_x;
-	m_y = -m_y;
-
-	return *this;
-}
-
-LibMath::Vector2& LibMath::Vector2::operator+=(const Vector2& other)
-{
-	m_x += other.m_x;
-	m_y += other.m_y;
-
-	return *this;
-}
-
-LibMath::Vector2& LibMath::Vector2::operator-=(const Vector2& other)
-{
-	m_x -= other.m_x;
-	m_y -= other.m_y;
-
-	return *this;
-}
-
-LibMath::Vector2& LibMath::Vector2::operator*=(const Vector2& other)
-{
-	m_x *= other.m_x;
-	m_y *= other.m_y;
-
-	return *this;
-}
-
-LibMath::Vector2& LibMath::Vector2::operator*=(const float& val)
-{
-	m_x *= val;
-	m_y *= val;
-
-	return *this;
-}
-
-LibMath::Vector2& LibMath::Vector2::operator/=(const Vector2& other)
-{
-	if (other.m_x == 0.f || other.m_y == 0.f)
-	{
-		throw std::runtime_error("Error: Division by zero \n x or y component is null.");
-	}
-
-	m_x /= other.m_x;
-	m_y /= other.m_y;
-
-	return *this;
-}
-
-LibMath::Vector2& LibMath::Vector2::operator/=(const float& val)
-{
-	if (val == 0.f)
-	{
-		throw std::runtime_error("Error: Division by zero");
-	}
-
-	m_x /= val;
-	m_y /= val;
-
-	return *this;
-}
-
-float LibMath::Vector2::magnitude(void) const
-{
-	return sqrtf(powf(m_x, 2) + powf(m_y, 2));
-}
-
 bool LibMath::Vector2::isUnit(void) const
 {
 	return (abs(magnitudeSquare() - 1.0f)) <= EPSILON;
 }
 
-float LibMath::Vector2::dotProduct(Vector2 vec) const
-{
-	return (float)m_x * vec.m_x + m_y * vec.m_y;
-}
-
-float LibMath::Vector2::magnitudeSquare(void) const
-{
-	return powf(m_x, 2) + powf(m_y, 2);
-}
-
-void LibMath::Vector2::normalize(void)
-{
-	float mag = magnitude();
-
-	m_x /= mag;
-	m_y /= mag;
-}
-
 LibMath::Radian LibMath::Vector2::angleBetween(Vector2 vec) const
 {
 	float dot_p = dotProduct(vec);
@@ -184,11 +39,6 @@ LibMath::Radian LibMath::Vector2::angleBetween(Vector2 vec) const
 	return angle;
 }
 
-float LibMath::Vector2::crossProduct(Vector2 vec) const
-{
-	return (m_x * vec.m_y - m_y * vec.m_x);
-}
-
 LibMath::Vector2 LibMath::Vector2::projectOnto(Vector2 vec)
 {
 	float coef = dotProduct(vec) / vec.magnitudeSquare();
@@ -218,70 +68,10 @@ LibMath::Vector2 LibMath::Vector2::reflectOnto(Vector2 vec)
 	return *this;
 }
 
-bool LibMath::operator==(Vector2 vec1, Vector2 vec2)
-{
-	return (vec1.m_x == vec2.m_x && vec1.m_y == vec2.m_y);
-}
-
-LibMath::Vector2 LibMath::operator-(Vector2 vec1, Vector2 vec2)
-{
-	return Vector2(vec1.m_x - vec2.m_x, vec1.m_y - vec2.m_y);
-}
-
-LibMath::Vector2 LibMath::operator+(Vector2 vec1, Vector2 vec2)
-{
-	return Vector2(vec1.m_x + vec2.m_x, vec1.m_y + vec2.m_y);
-}
-
-LibMath::Vector2 LibMath::operator*(Vector2 vec, float val)
-{
-	return Vector2(vec.m_x * val, vec.m_y * val);
-}
-
-LibMath::Vector2 LibMath::operator*(Vector2 vec1, Vector2 vec2)
-{
-	return Vector2(vec1.m_x * vec2.m_x, vec1.m_y * vec2.m_y);
-}
-
-LibMath::Vector2 LibMath::operator/(Vector2 vec, float val)
-{
-	if (val == 0.f)
-	{
-		throw(std::invalid_argument("Error: Division by zero"));
-	}
-	return Vector2(vec.m_x / val, vec.m_y / val);
-}
-
-LibMath::Vector2 LibMath::operator/(Vector2 vec1, Vector2 vec2)
-{
-	return Vector2(vec1.m_x / vec2.m_x, vec1.m_y / vec2.m_y);
-}
-
 #pragma endregion 
 
 #pragma region Vector3D
 
-LibMath::Vector3::Vector3(float val)
-{
-	m_x = val;
-	m_y = val;
-	m_z = val;
-}
-
-LibMath::Vector3::Vector3(float val_x, float val_y, float val_z)
-{
-	m_x = val_x;
-	m_y = val_y;
-	m_z = val_z;
-}
-
-LibMath::Vector3::Vector3(Vector3 const& other)
-{
-	m_x = other.m_x;
-	m_y = other.m_y;
-	m_z = other.m_z;
-}
-
 LibMath::Vector3::Vector3(LibMath::Geometry3D::Point const& point)
 {
 	m_x = point.m_x;
@@ -294,97 +84,6 @@ LibMath::Vector3::operator LibMath::Vector4() const
 	return LibMath::Vector4(m_x, m_y, m_z, 1.f);
 }
 
-LibMath::Vector3 LibMath::Vector3::zero(void)
-{
-	return Vector3(0.0f);
-}
-
-LibMath::Vector3 LibMath::Vector3::one(void)
-{
-	return Vector3(1.0f);
-}
-
-LibMath::Vector3 LibMath::Vector3::up(void)
-{
-	return Vector3(0.0f, 1.0f, 0.0f);
-}
-
-LibMath::Vector3 LibMath::Vector3::down(void)
-{
-	return Vector3(0.0f, -1.0f, 0.0f);
-}
-
-LibMath::Vector3 LibMath::Vector3::left(void)
-{
-	return Vector3(-1.0f, 0.0f, 0.0f);
-}
-
-LibMath::Vector3 LibMath::Vector3::right(void)
-{
-	return Vector3(1.0f, 0.0f, 0.0f);
-}
-
-LibMath::Vector3 LibMath::Vector3::front(void)
-{
-	return Vector3(0.0f, 0.0f, 1.0f);
-}
-
-LibMath::Vector3 LibMath::Vector3::back(void)
-{
-	return Vector3(0.0f, 0.0f, -1.0f);
-}
-
-LibMath::Vector3 LibMath::Vector3::lerp(Vector3 const& vec1, Vector3 const& vec2, float t)
-{
-	// Clamp t between 0 and 1 to prevent extrapolation
-	t = std::max(0.0f, std::min(1.0f, t));
-	return Vector3(
-		vec1.m_x + (vec2.m_x - vec1.m_x) * t,
-		vec1.m_y + (vec2.m_y - vec1.m_y) * t,
-		vec1.m_z + (vec2.m_z - vec1.m_z) * t
-	);
-}
-
-float& LibMath::Vector3::operator[](int n)
-{
-	if (n == 0)
-	{
-		return m_x;
-	}
-
-	if (n == 1)
-	{
-		return m_y;
-	}
-
-	if (n == 2)
-	{
-		return m_z;
-	}
-
-	throw(std::out_of_range("Error: index out of range"));
-}
-
-float LibMath::Vector3::operator[](int n) const
-{
-	if (n == 0)
-	{
-		return m_x;
-	}
-
-	if (n == 1)
-	{
-		return m_y;
-	}
-
-	if (n == 2)
-	{
-		return m_z;
-	}
-
-	throw(std::out_of_range("Error: index out of range"));
-}
-
 LibMath::Radian LibMath::Vector3::angleFrom(Vector3 const& vec) const
 {
 	float dot_p = dot(vec);
@@ -396,58 +95,6 @@ LibMath::Radian LibMath::Vector3::angleFrom(Vector3 const& vec) const
 	return Radian(LibMath::acos(cos_theta));
 }
 
-LibMath::Vector3 LibMath::Vector3::cross(Vector3 const& vec) const
-{
-	float x = (m_y * vec.m_z) - (m_z * vec.m_y);
-	float y = -((m_x * vec.m_z) - (m_z * vec.m_x));
-	float z = (m_x * vec.m_y) - (m_y * vec.m_x);
-
-	return Vector3(x, y, z);
-}
-
-float LibMath::Vector3::distanceFrom(Vector3 const& vec) const
-{
-	float x_comp = powf(vec.m_x - m_x, 2);
-	float y_comp = powf(vec.m_y - m_y, 2);
-	float z_comp = powf(vec.m_z - m_z, 2);
-
-	return sqrtf(x_comp + y_comp + z_comp);
-}
-
-float LibMath::Vector3::distanceSquaredFrom(Vector3 const& vec) const
-{
-	float x_comp = powf(vec.m_x - m_x, 2);
-	float y_comp = powf(vec.m_y - m_y, 2);
-	float z_comp = powf(vec.m_z - m_z, 2);
-
-	return x_comp + y_comp + z_comp;
-}
-
-float LibMath::Vector3::distance2DFrom(Vector3 const& vec) const
-{
-	float x_comp = powf(vec.m_x - m_x, 2);
-	float y_comp = powf(vec.m_y - m_y, 2);
-
-	return sqrtf(x_comp + y_comp);
-}
-
-float LibMath::Vector3::distance2DSquaredFrom(Vector3 const& vec) const
-{
-	float x_comp = powf(vec.m_x - m_x, 2);
-	float y_comp = powf(vec.m_y - m_y, 2);
-
-	return x_comp + y_comp;
-}
-
-float LibMath::Vector3::dot(Vector3 const& vec) const
-{
-	float x_comp = m_x * vec.m_x;
-	float y_comp = m_y * vec.m_y;
-	float z_comp = m_z * vec.m_z;
-
-	return x_comp + y_comp + z_comp;
-}
-
 bool LibMath::Vector3::isLongerThan(Vector3 const& vec) const
 {
 	float mag_a = magnitude();
@@ -469,36 +116,6 @@ bool LibMath::Vector3::isUnitVector(void) const
 	return std::abs(magnitudeSquared() - 1) <= EPSILON  ;
 }
 
-float LibMath::Vector3::magnitude(void) const
-{
-	return sqrtf(powf(m_x, 2) + powf(m_y, 2) + powf(m_z, 2));
-}
-
-float LibMath::Vector3::magnitudeSquared(void) const
-{
-	return powf(m_x, 2) + powf(m_y, 2) + powf(m_z, 2);
-}
-
-void LibMath::Vector3::normalize(void)
-{
-	float mag = magnitude();
-
-	// Avoid division by zero
-
-	if (mag == 0.f)
-	{
-		throw(std::invalid_argument("Error: Can not normalize vector of Magnitude zero"));
-	}
-
-	if (mag == 1)
-	{
-		return;
-	}
-	m_x /= mag;
-	m_y /= mag;
-	m_z /= mag;
-}
-
 void LibMath::Vector3::projectOnto(Vector3 const& vec)
 {
 	float coef = dot(vec) / vec.magnitudeSquared();
@@ -528,8 +145,7 @@ void LibMath::Vector3::reflectOnto(Vector3 const& vec)
 
 void LibMath::Vector3::rotateX(Radian angle)
 {
-	float c = cos(angle);
-	float s = sin(angle);
+	auto [s, c] = LibMath::sincos(angle);
 
 	float newY = c * m_y - s * m_z;
 	float newZ = s * m_y + c * m_z;
@@ -540,8 +156,7 @@ void LibMath::Vector3::rotateX(Radian angle)
 
 void LibMath::Vector3::rotateY(Radian angle)
 {
-	float c = cos(angle);
-	float s = sin(angle);
+	auto [s, c] = LibMath::sincos(angle);
 
 	float newX = c * m_x + s * m_z;
 	float newZ = -s * m_x + c * m_z;
@@ -552,8 +167,7 @@ void LibMath::Vector3::rotateY(Radian angle)
 
 void LibMath::Vector3::rotateZ(Radian angle)
 {
-	float c = cos(angle);
-	float s = sin(angle);
+	auto [s, c] = LibMath::sincos(angle);
 
 	float newX = c * m_x - s * m_y;
 	float newY = s * m_x + c * m_y;
@@ -617,28 +231,60 @@ void LibMath::Vector3::rotate(Quaternion const& quat)
 	m_z = vec.m_z;
 }
 
-void LibMath::Vector3::scale(Vector3 const& vec)
+/*
+* string and stringLong keep their 1 decimal rounding for display, the whole text is written into a stack buffer
+* so only the returned string allocates
+*/
+static char* writeNumber(char* first, char* last, float value)
 {
-	m_x *= vec.m_x;
-	m_y *= vec.m_y;
-	m_z *= vec.m_z;
+	// + 0.f turns -0 into 0, whole numbers are written without decimal
+	value += 0.f;
+	int precision = std::trunc(value) == value ? 0 : 1;
+
+	return std::to_chars(first, last, value, std::chars_format::fixed, precision).ptr;
 }
 
-std::string LibMath::Vector3::string(void) const
+static char* writeText(char* first, char const* text)
 {
-	return std::string("{" + formatNumber(m_x) + "," + formatNumber(m_y) + "," + formatNumber(m_z) + "}");
+	while (*text)
+	{
+		*first++ = *text++;
+	}
+
+	return first;
 }
 
-std::string LibMath::Vector3::stringLong(void) const
+std::string LibMath::Vector3::string(void) const
 {
-	return std::string("Vector3{ x:" + formatNumber(m_x) + ", y:" + formatNumber(m_y) + ", z:" + formatNumber(m_z) + " }");
+	// fixed notation of FLT_MAX takes 39 characters before the decimal
+	char buffer[3 * 42 + 4];
+	char* last = buffer + sizeof buffer;
+
+	char* end = writeText(buffer, "{");
+	end = writeNumber(end, last, m_x);
+	end = writeText(end, ",");
+	end = writeNumber(end, last, m_y);
+	end = writeText(end, ",");
+	end = writeNumber(end, last, m_z);
+	end = writeText(end, "}");
+
+	return std::string(buffer, end);
 }
 
-void LibMath::Vector3::translate(Vector3 const& vec)
+std::string LibMath::Vector3::stringLong(void) const
 {
-	m_x += vec.m_x;
-	m_y += vec.m_y;
-	m_z += vec.m_z;
+	char buffer[3 * 42 + 24];
+	char* last = buffer + sizeof buffer;
+
+	char* end = writeText(buffer, "Vector3{ x:");
+	end = writeNumber(end, last, m_x);
+	end = writeText(end, ", y:");
+	end = writeNumber(end, last, m_y);
+	end = writeText(end, ", z:");
+	end = writeNumber(end, last, m_z);
+	end = writeText(end, " }");
+
+	return std::string(buffer, end);
 }
 
 LibMath::Vector3 LibMath::rotateArroundAxis(Vector3 const& vector, Vector3 const& axis, Radian angle)
@@ -648,8 +294,7 @@ LibMath::Vector3 LibMath::rotateArroundAxis(Vector3 const& vector, Vector3 const
 	normalizedAxis.normalize();
 
 	// Precompute trigonometric values
-	float cosTheta = cos(angle);
-	float sinTheta = sin(angle);
+	auto [sinTheta, cosTheta] = LibMath::sincos(angle);
 	float oneMinusCosTheta = 1 - cosTheta;
 
 	// Extract axis components
@@ -680,332 +325,544 @@ LibMath::Vector3 LibMath::rotateArroundAxis(Vector3 const& vector, Vector3 const
 
 std::string LibMath::formatNumber(float value)
 {
-	bool isNegative = value < 0; // Check if the value is negative
-	value = std::abs(value); // Work with the absolute value
+	char buffer[42];
 
-	if (std::fmod(value, 1.0f) == 0.0f) { // Check if the value is whole
-		return std::to_string(isNegative ? -static_cast<int>(value) : static_cast<int>(value)); // Handle negative numbers
+	return std::string(buffer, writeNumber(buffer, buffer + sizeof buffer, value));
+}
+
+std::to_chars_result LibMath::toChars(char* first, char* last, Vector3 const& vec)
+{
+	// without a format std::to_chars writes the shortest representation that parses back to the same float
+	float const components[3] = { vec.m_x, vec.m_y, vec.m_z };
+
+	if (first == last)
+	{
+		return { last, std::errc::value_too_large };
 	}
-	else {
-		// Manually format to 1 decimal place
-		int intPart = static_cast<int>(value);
-		float fracPart = value - intPart;
-		int decimal = static_cast<int>(std::round(fracPart * 10));
-		return (intPart == 0 && isNegative ? "-0" : std::to_string(isNegative ? -intPart : intPart)) + "." + std::to_string(decimal);
+
+	*first++ = '{';
+	for (int i = 0; i < 3; ++i)
+	{
+		std::to_chars_result result = std::to_chars(first, last, components[i]);
+		if (result.ec != std::errc() || result.ptr == last)
+		{
+			return { last, std::errc::value_too_large };
+		}
+
+		first = result.ptr;
+		*first++ = i == 2 ? '}' : ',';
 	}
+
+	return { first, std::errc() };
 }
 
-bool LibMath::operator==(Vector3 const& vec1, Vector3 const& vec2)
+static char const* skipBlanks(char const* first, char const* last)
 {
-	
-	return (vec1.m_x == vec2.m_x && vec1.m_y == vec2.m_y && vec1.m_z == vec2.m_z);
+	while (first != last && (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\r'))
+	{
+		++first;
+	}
+
+	return first;
 }
 
-bool LibMath::operator!=(Vector3 const& vec1, Vector3 const& vec2)
+std::from_chars_result LibMath::fromChars(char const* first, char const* last, Vector3& vec)
 {
-	return (vec1.m_x != vec2.m_x || vec1.m_y != vec2.m_y || vec1.m_z != vec2.m_z);
+	std::from_chars_result const invalid{ first, std::errc::invalid_argument };
+	float components[3];
+
+	char const* current = skipBlanks(first, last);
+	if (current == last || *current != '{')
+	{
+		return invalid;
+	}
+
+	for (int i = 0; i < 3; ++i)
+	{
+		current = skipBlanks(current + 1, last);
+
+		std::from_chars_result result = std::from_chars(current, last, components[i]);
+		if (result.ec != std::errc())
+		{
+			return { first, result.ec };
+		}
+
+		current = skipBlanks(result.ptr, last);
+		if (current == last || *current != (i == 2 ? '}' : ','))
+		{
+			return invalid;
+		}
+	}
+
+	vec = Vector3(components[0], components[1], components[2]);
+
+	return { current + 1, std::errc() };
 }
 
-LibMath::Vector3 LibMath::operator-(Vector3 vec)
+std::ostream& LibMath::operator<<(std::ostream& os, Vector3 const& vec)
 {
-	return Vector3(-vec.m_x, -vec.m_y, -vec.m_z);
+	char buffer[Vector3::c_maxChars];
+
+	return os.write(buffer, toChars(buffer, buffer + sizeof buffer, vec).ptr - buffer);
 }
 
-LibMath::Vector3 LibMath::operator+(Vector3 vec1, Vector3 const& vec2)
+std::istream& LibMath::operator>>(std::istream& is, Vector3& vec)
 {
-	return Vector3(vec1.m_x + vec2.m_x, vec1.m_y + vec2.m_y, vec1.m_z + vec2.m_z);
+	char c;
+	is >> c;
+	is >> vec.m_x;
+	is >> c;
+	is >> vec.m_y;
+	is >> c;
+	is >> vec.m_z;
+	is >> c;
+
+	return is;
 }
 
-LibMath::Vector3 LibMath::operator-(Vector3 vec1, Vector3 const& vec2)
+#pragma endregion
+
+#pragma region Vector4D
+
+LibMath::Vector4::operator LibMath::Vector3() const
 {
-	return Vector3(vec1.m_x - vec2.m_x, vec1.m_y - vec2.m_y, vec1.m_z - vec2.m_z);
+	return LibMath::Vector3(m_x, m_y, m_z);
 }
 
-LibMath::Vector3 LibMath::operator*(Vector3 vec1, Vector3 const& vec2)
+bool LibMath::Vector4::isUnit(void) const
 {
-	return Vector3(vec1.m_x * vec2.m_x, vec1.m_y * vec2.m_y, vec1.m_z * vec2.m_z);
+	return std::abs(magnitudeSquare() - 1) <= EPSILON;
 }
 
-LibMath::Vector3 LibMath::operator*(Vector3 vec, float val)
+#pragma endregion
+
+#pragma region Vector3Batch
+
+// Lane helpers of LibMath/Simd.h, the element wise kernels process 2 registers per iteration
+namespace Simd = LibMath::Simd;
+
+#if defined(LIBMATH_SIMD_AVX2)
+static Simd::Lanes batchInverseLength(Simd::Lanes lengthSquared)
+{
+	// 1 / length, 0 for zero vectors
+	__m256 inverse = _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(lengthSquared));
+	return _mm256_and_ps(inverse, _mm256_cmp_ps(lengthSquared, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+#elif defined(LIBMATH_SIMD_SSE41)
+static Simd::Lanes batchInverseLength(Simd::Lanes lengthSquared)
 {
-	return Vector3(vec.m_x * val, vec.m_y * val, vec.m_z * val);
+	// 1 / length, 0 for zero vectors
+	__m128 inverse = _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(lengthSquared));
+	return _mm_and_ps(inverse, _mm_cmpgt_ps(lengthSquared, _mm_setzero_ps()));
 }
+#else
+static Simd::Lanes batchInverseLength(Simd::Lanes lengthSquared)
+{
+	// 1 / length, 0 for zero vectors
+	return lengthSquared > 0.f ? 1.f / std::sqrt(lengthSquared) : 0.f;
+}
+#endif
+
+static size_t constexpr c_batchPadding = 16;		// lanes, largest step of the kernels
+static size_t constexpr c_batchAlignment = 64;		// bytes, one cache line
 
-LibMath::Vector3 LibMath::operator/(Vector3 vec1, Vector3 const& vec2)
+static size_t batchPaddedSize(size_t count)
 {
-	return Vector3(vec1.m_x / vec2.m_x, vec1.m_y /vec2.m_y, vec1.m_z / vec2.m_z);
+	return (count + c_batchPadding - 1) / c_batchPadding * c_batchPadding;
 }
 
-LibMath::Vector3 LibMath::operator/(Vector3 vec, float val)
+static void batchCheckSize(LibMath::Vector3Batch const& lhs, LibMath::Vector3Batch const& rhs)
 {
-	if (val == 0)
+	if (lhs.size() != rhs.size())
 	{
-		throw(std::invalid_argument("Division by zero"));
+		throw std::invalid_argument("Error: batches have different sizes");
 	}
-	return Vector3(vec.m_x / val, vec.m_y / val, vec.m_z /val );
 }
 
-LibMath::Vector3& LibMath::operator+=(Vector3& vec1, Vector3 const& vec2)
+LibMath::Vector3Batch::Vector3Batch(size_t const count)
 {
-	vec1.m_x += vec2.m_x;
-	vec1.m_y += vec2.m_y;
-	vec1.m_z += vec2.m_z;
-
-	return vec1;
+	resize(count);
 }
 
-LibMath::Vector3& LibMath::operator-=(Vector3& vec1, Vector3 const& vec2)
+LibMath::Vector3Batch::Vector3Batch(std::span<Vector3 const> vectors)
 {
-	vec1.m_x -= vec2.m_x;
-	vec1.m_y -= vec2.m_y;
-	vec1.m_z -= vec2.m_z;
-
-	return vec1;
+	load(vectors);
 }
 
-LibMath::Vector3& LibMath::operator*=(Vector3& vec1, Vector3 const& vec2)
+LibMath::Vector3Batch::Vector3Batch(Vector3Batch const& other)
 {
-	vec1.m_x *= vec2.m_x;
-	vec1.m_y *= vec2.m_y;
-	vec1.m_z *= vec2.m_z;
-
-	return vec1;
+	*this = other;
 }
 
-LibMath::Vector3& LibMath::operator*=(Vector3& vec, float val)
+LibMath::Vector3Batch::Vector3Batch(Vector3Batch&& other) noexcept
 {
-	vec.m_x *= val;
-	vec.m_y *= val;
-	vec.m_z *= val;
+	*this = std::move(other);
+}
 
-	return vec;
+LibMath::Vector3Batch::~Vector3Batch()
+{
+	::operator delete[](m_data, std::align_val_t{ c_batchAlignment });
 }
 
-LibMath::Vector3& LibMath::operator/=(Vector3& vec1, Vector3 const& vec2)
+LibMath::Vector3Batch& LibMath::Vector3Batch::operator=(Vector3Batch const& other)
 {
-	if (vec2.m_x == 0.f || vec2.m_y == 0.f || vec2.m_z == 0.f)
+	if (this == &other)
+	{
+		return *this;
+	}
+
+	reserve(other.m_size);
+	m_size = other.m_size;
+
+	if (m_size != 0)
 	{
-		throw std::runtime_error("Error: Division by zero. \n x, y or z component is zero");
+		std::memcpy(m_data, other.m_data, m_size * sizeof(float));
+		std::memcpy(m_data + m_stride, other.m_data + other.m_stride, m_size * sizeof(float));
+		std::memcpy(m_data + 2 * m_stride, other.m_data + 2 * other.m_stride, m_size * sizeof(float));
 	}
 
-	vec1.m_x /= vec2.m_x;
-	vec1.m_y /= vec2.m_y;
-	vec1.m_z /= vec2.m_z;
+	return *this;
+}
+
+LibMath::Vector3Batch& LibMath::Vector3Batch::operator=(Vector3Batch&& other) noexcept
+{
+	std::swap(m_data, other.m_data);
+	std::swap(m_size, other.m_size);
+	std::swap(m_stride, other.m_stride);
 
-	return vec1;
+	return *this;
 }
 
-LibMath::Vector3& LibMath::operator/=(Vector3& vec, float val)
+size_t LibMath::Vector3Batch::size(void) const
 {
-	if (val == 0.f)
+	return m_size;
+}
+
+void LibMath::Vector3Batch::reserve(size_t const count)
+{
+	if (count <= m_stride)
+	{
+		return;
+	}
+
+	size_t stride = batchPaddedSize(count);
+	float* data = static_cast<float*>(::operator new[](3 * stride * sizeof(float), std::align_val_t{ c_batchAlignment }));
+	std::fill(data, data + 3 * stride, 0.f);
+
+	if (m_size != 0)
 	{
-		throw std::runtime_error("Error: Division by zero");
+		std::memcpy(data, m_data, m_size * sizeof(float));
+		std::memcpy(data + stride, m_data + m_stride, m_size * sizeof(float));
+		std::memcpy(data + 2 * stride, m_data + 2 * m_stride, m_size * sizeof(float));
 	}
 
-	vec.m_x /= val;
-	vec.m_y /= val;
-	vec.m_z /= val;
+	::operator delete[](m_data, std::align_val_t{ c_batchAlignment });
 
-	return vec;
+	m_data = data;
+	m_stride = stride;
 }
 
-std::ostream& LibMath::operator<<(std::ostream& os, Vector3 const& vec)
+void LibMath::Vector3Batch::resize(size_t const count)
 {
-	return os << "{" << vec.m_x << "," << vec.m_y << "," << vec.m_z << "}";
+	reserve(count);
+
+	if (count > m_size)
+	{
+		// lanes past the old size may hold results of previous kernels
+		std::fill(m_data + m_size, m_data + count, 0.f);
+		std::fill(m_data + m_stride + m_size, m_data + m_stride + count, 0.f);
+		std::fill(m_data + 2 * m_stride + m_size, m_data + 2 * m_stride + count, 0.f);
+	}
+
+	m_size = count;
 }
 
-std::istream& LibMath::operator>>(std::istream& is, Vector3& vec)
+LibMath::Vector3 LibMath::Vector3Batch::get(size_t const index) const
 {
-	char c;
-	is >> c;
-	is >> vec.m_x;
-	is >> c;
-	is >> vec.m_y;
-	is >> c;
-	is >> vec.m_z;
-	is >> c;
+	if (index >= m_size)
+	{
+		throw std::out_of_range("Error: index out of range");
+	}
 
-	return is;
+	return Vector3(m_data[index], m_data[m_stride + index], m_data[2 * m_stride + index]);
 }
 
-#pragma endregion
+void LibMath::Vector3Batch::set(size_t const index, Vector3 const& vec)
+{
+	if (index >= m_size)
+	{
+		throw std::out_of_range("Error: index out of range");
+	}
 
-#pragma region Vector4D
+	m_data[index] = vec.m_x;
+	m_data[m_stride + index] = vec.m_y;
+	m_data[2 * m_stride + index] = vec.m_z;
+}
 
-LibMath::Vector4::Vector4(float val)
+std::span<float> LibMath::Vector3Batch::x(void)
 {
-	m_x = val;
-	m_y = val;
-	m_z = val;
-	m_w = val;
+	return std::span<float>(m_data, m_size);
 }
 
-LibMath::Vector4::Vector4(float x, float y, float z, float k)
+std::span<float const> LibMath::Vector3Batch::x(void) const
 {
-	m_x = x;
-	m_y = y;
-	m_z = z;
-	m_w = k;
+	return std::span<float const>(m_data, m_size);
 }
 
-LibMath::Vector4::Vector4(Vector4 const& other)
+std::span<float> LibMath::Vector3Batch::y(void)
 {
-	m_x = other.m_x;
-	m_y = other.m_y;
-	m_z = other.m_z;
-	m_w = other.m_w;
+	return std::span<float>(m_data + m_stride, m_size);
 }
 
-LibMath::Vector4::Vector4(LibMath::Vector3 const& vec3, const float& val)
+std::span<float const> LibMath::Vector3Batch::y(void) const
 {
-	m_x = vec3.m_x;
-	m_y = vec3.m_y;
-	m_z = vec3.m_z;
-	m_w = val;
+	return std::span<float const>(m_data + m_stride, m_size);
 }
 
-LibMath::Vector4::operator LibMath::Vector3() const
+std::span<float> LibMath::Vector3Batch::z(void)
 {
-	return LibMath::Vector3(m_x, m_y, m_z);
+	return std::span<float>(m_data + 2 * m_stride, m_size);
 }
 
-LibMath::Vector4 LibMath::Vector4::lerp(Vector4 const& vec1, Vector4 const& vec2, float t)
+std::span<float const> LibMath::Vector3Batch::z(void) const
 {
-	// Clamp t between 0 and 1 to prevent extrapolation
-	t = std::max(0.0f, std::min(1.0f, t));
-	return Vector4(
-		vec1.m_x + (vec2.m_x - vec1.m_x) * t,
-		vec1.m_y + (vec2.m_y - vec1.m_y) * t,
-		vec1.m_z + (vec2.m_z - vec1.m_z) * t,
-		vec1.m_w + (vec2.m_w - vec1.m_w) * t
-	);
+	return std::span<float const>(m_data + 2 * m_stride, m_size);
 }
 
-float& LibMath::Vector4::operator[](int n)
+void LibMath::Vector3Batch::load(std::span<Vector3 const> vectors)
 {
-	if (n == 0)
-	{
-		return m_x;
-	}
+	resize(vectors.size());
+
+	float* x = m_data;
+	float* y = m_data + m_stride;
+	float* z = m_data + 2 * m_stride;
 
-	if (n == 1)
+	for (size_t i = 0; i < vectors.size(); ++i)
 	{
-		return m_y;
+		x[i] = vectors[i].m_x;
+		y[i] = vectors[i].m_y;
+		z[i] = vectors[i].m_z;
 	}
+}
 
-	if (n == 2)
+void LibMath::Vector3Batch::store(std::span<Vector3> vectors) const
+{
+	if (vectors.size() != m_size)
 	{
-		return m_z;
+		throw std::invalid_argument("Error: span size differs from the batch size");
 	}
 
-	if (n == 3)
+	float const* x = m_data;
+	float const* y = m_data + m_stride;
+	float const* z = m_data + 2 * m_stride;
+
+	for (size_t i = 0; i < m_size; ++i)
 	{
-		return m_w;
+		vectors[i] = Vector3(x[i], y[i], z[i]);
 	}
-
-	throw(std::out_of_range("Error: Index out of range"));
 }
 
-float LibMath::Vector4::operator[](int n) const
+void LibMath::Vector3Batch::add(Vector3Batch const& lhs, Vector3Batch const& rhs, Vector3Batch& result)
 {
-	if (n == 0)
-	{
-		return m_x;
-	}
+	batchCheckSize(lhs, rhs);
+	result.resize(lhs.m_size);
 
-	if (n == 1)
-	{
-		return m_y;
-	}
+	// padding lanes are processed too, every stride is a multiple of the step
+	size_t count = batchPaddedSize(lhs.m_size);
 
-	if (n == 2)
+	for (size_t component = 0; component < 3; ++component)
 	{
-		return m_z;
+		float const* a = lhs.m_data + component * lhs.m_stride;
+		float const* b = rhs.m_data + component * rhs.m_stride;
+		float* out = result.m_data + component * result.m_stride;
+
+		for (size_t i = 0; i < count; i += 2 * Simd::c_width)
+		{
+			Simd::store(out + i, Simd::add(Simd::load(a + i), Simd::load(b + i)));
+			Simd::store(out + i + Simd::c_width, Simd::add(Simd::load(a + i + Simd::c_width), Simd::load(b + i + Simd::c_width)));
+		}
 	}
+}
+
+void LibMath::Vector3Batch::subtract(Vector3Batch const& lhs, Vector3Batch const& rhs, Vector3Batch& result)
+{
+	batchCheckSize(lhs, rhs);
+	result.resize(lhs.m_size);
+
+	size_t count = batchPaddedSize(lhs.m_size);
 
-	if (n == 3)
+	for (size_t component = 0; component < 3; ++component)
 	{
-		return m_w;
+		float const* a = lhs.m_data + component * lhs.m_stride;
+		float const* b = rhs.m_data + component * rhs.m_stride;
+		float* out = result.m_data + component * result.m_stride;
+
+		for (size_t i = 0; i < count; i += 2 * Simd::c_width)
+		{
+			Simd::store(out + i, Simd::sub(Simd::load(a + i), Simd::load(b + i)));
+			Simd::store(out + i + Simd::c_width, Simd::sub(Simd::load(a + i + Simd::c_width), Simd::load(b + i + Simd::c_width)));
+		}
 	}
-
-	throw(std::out_of_range("Error: Index out of range"));
 }
 
-bool LibMath::Vector4::isUnit(void) const
+void LibMath::Vector3Batch::scale(Vector3Batch const& batch, float const factor, Vector3Batch& result)
 {
-	return std::abs(magnitudeSquare() - 1) <= EPSILON;
-}
+	result.resize(batch.m_size);
 
-float LibMath::Vector4::dotProduct(Vector4 const& vec)
-{
-	float x_comp = m_x * vec.m_x;
-	float y_comp = m_y * vec.m_y;
-	float z_comp = m_z * vec.m_z;
-	float k_comp = m_w * vec.m_w;
+	size_t count = batchPaddedSize(batch.m_size);
+	Simd::Lanes scalar = Simd::set(factor);
 
-	return x_comp + y_comp + z_comp + k_comp;
+	for (size_t component = 0; component < 3; ++component)
+	{
+		float const* a = batch.m_data + component * batch.m_stride;
+		float* out = result.m_data + component * result.m_stride;
+
+		for (size_t i = 0; i < count; i += 2 * Simd::c_width)
+		{
+			Simd::store(out + i, Simd::mul(Simd::load(a + i), scalar));
+			Simd::store(out + i + Simd::c_width, Simd::mul(Simd::load(a + i + Simd::c_width), scalar));
+		}
+	}
 }
 
-float LibMath::Vector4::magnitude(void) const
+void LibMath::Vector3Batch::cross(Vector3Batch const& lhs, Vector3Batch const& rhs, Vector3Batch& result)
 {
-	float x = powf(m_x, 2.0f);
-	float y = powf(m_y, 2.0f);
-	float z = powf(m_z, 2.0f);
-	float k = powf(m_w, 2.0f);
+	batchCheckSize(lhs, rhs);
+	result.resize(lhs.m_size);
 
-	return sqrtf(x + y + z + k);
-}
+	size_t count = batchPaddedSize(lhs.m_size);
 
-float LibMath::Vector4::magnitudeSquare(void) const
-{
-	float x = powf(m_x, 2.0f);
-	float y = powf(m_y, 2.0f);
-	float z = powf(m_z, 2.0f);
-	float k = powf(m_w, 2.0f);
+	float const* ax = lhs.m_data;
+	float const* ay = lhs.m_data + lhs.m_stride;
+	float const* az = lhs.m_data + 2 * lhs.m_stride;
+	float const* bx = rhs.m_data;
+	float const* by = rhs.m_data + rhs.m_stride;
+	float const* bz = rhs.m_data + 2 * rhs.m_stride;
+	float* outX = result.m_data;
+	float* outY = result.m_data + result.m_stride;
+	float* outZ = result.m_data + 2 * result.m_stride;
 
-	return x + y + z + k;
-}
+	for (size_t i = 0; i < count; i += Simd::c_width)
+	{
+		// all the loads happen before the stores so the result can alias an operand
+		Simd::Lanes x1 = Simd::load(ax + i), y1 = Simd::load(ay + i), z1 = Simd::load(az + i);
+		Simd::Lanes x2 = Simd::load(bx + i), y2 = Simd::load(by + i), z2 = Simd::load(bz + i);
 
-void LibMath::Vector4::homogenize(void)
-{
-	m_x /= m_w;
-	m_y /= m_w;
-	m_z /= m_w;
-	m_w = 1;
+		Simd::store(outX + i, Simd::sub(Simd::mul(y1, z2), Simd::mul(z1, y2)));
+		Simd::store(outY + i, Simd::sub(Simd::mul(z1, x2), Simd::mul(x1, z2)));
+		Simd::store(outZ + i, Simd::sub(Simd::mul(x1, y2), Simd::mul(y1, x2)));
+	}
 }
 
-bool LibMath::operator==(Vector4 const& vec1, Vector4 const& vec2)
+void LibMath::Vector3Batch::lerp(Vector3Batch const& from, Vector3Batch const& to, float t, Vector3Batch& result)
 {
-	return ((vec1.m_x == vec2.m_x) && (vec1.m_y == vec2.m_y) && (vec1.m_z == vec2.m_z) && (vec1.m_w == vec2.m_w));
-}
+	batchCheckSize(from, to);
+	result.resize(from.m_size);
 
-LibMath::Vector4 LibMath::operator-(Vector4 vec)
-{
-	return Vector4(-vec.m_x, -vec.m_y, -vec.m_z, -vec.m_w);
-}
+	// Clamp t between 0 and 1 to prevent extrapolation
+	t = std::max(0.0f, std::min(1.0f, t));
 
-LibMath::Vector4 LibMath::operator+(Vector4 vec1, Vector4 vec2)
-{
-	return Vector4(vec1.m_x + vec2.m_x, vec1.m_y + vec2.m_y, vec1.m_z + vec2.m_z, vec1.m_w + vec2.m_w);
+	size_t count = batchPaddedSize(from.m_size);
+	Simd::Lanes factor = Simd::set(t);
+
+	for (size_t component = 0; component < 3; ++component)
+	{
+		float const* a = from.m_data + component * from.m_stride;
+		float const* b = to.m_data + component * to.m_stride;
+		float* out = result.m_data + component * result.m_stride;
+
+		for (size_t i = 0; i < count; i += 2 * Simd::c_width)
+		{
+			Simd::Lanes a0 = Simd::load(a + i);
+			Simd::Lanes a1 = Simd::load(a + i + Simd::c_width);
+
+			Simd::store(out + i, Simd::mulAdd(Simd::sub(Simd::load(b + i), a0), factor, a0));
+			Simd::store(out + i + Simd::c_width, Simd::mulAdd(Simd::sub(Simd::load(b + i + Simd::c_width), a1), factor, a1));
+		}
+	}
 }
 
-LibMath::Vector4 LibMath::operator-(Vector4 vec1, Vector4 vec2)
+void LibMath::Vector3Batch::normalize(Vector3Batch& batch)
 {
-	return Vector4(vec1.m_x - vec2.m_x, vec1.m_y - vec2.m_y, vec1.m_z - vec2.m_z, vec1.m_w - vec2.m_w);
+	size_t count = batchPaddedSize(batch.m_size);
+
+	float* x = batch.m_data;
+	float* y = batch.m_data + batch.m_stride;
+	float* z = batch.m_data + 2 * batch.m_stride;
+
+	for (size_t i = 0; i < count; i += Simd::c_width)
+	{
+		Simd::Lanes vx = Simd::load(x + i);
+		Simd::Lanes vy = Simd::load(y + i);
+		Simd::Lanes vz = Simd::load(z + i);
+
+		Simd::Lanes inverseLength = batchInverseLength(Simd::mulAdd(vx, vx, Simd::mulAdd(vy, vy, Simd::mul(vz, vz))));
+
+		Simd::store(x + i, Simd::mul(vx, inverseLength));
+		Simd::store(y + i, Simd::mul(vy, inverseLength));
+		Simd::store(z + i, Simd::mul(vz, inverseLength));
+	}
 }
 
-LibMath::Vector4 LibMath::operator*(Vector4 vec, float val)
+void LibMath::Vector3Batch::dot(Vector3Batch const& lhs, Vector3Batch const& rhs, std::span<float> result)
 {
-	return Vector4(vec.m_x * val, vec.m_y * val, vec.m_z * val, vec.m_w * val);
+	batchCheckSize(lhs, rhs);
+
+	if (result.size() < lhs.m_size)
+	{
+		throw std::invalid_argument("Error: result span is smaller than the batch");
+	}
+
+	float const* ax = lhs.m_data;
+	float const* ay = lhs.m_data + lhs.m_stride;
+	float const* az = lhs.m_data + 2 * lhs.m_stride;
+	float const* bx = rhs.m_data;
+	float const* by = rhs.m_data + rhs.m_stride;
+	float const* bz = rhs.m_data + 2 * rhs.m_stride;
+
+	// the result span has no padding, whole registers first then the remaining lanes
+	size_t i = 0;
+
+	for (; i + Simd::c_width <= lhs.m_size; i += Simd::c_width)
+	{
+		Simd::Lanes product = Simd::mulAdd(Simd::load(ax + i), Simd::load(bx + i),
+										 Simd::mulAdd(Simd::load(ay + i), Simd::load(by + i), Simd::mul(Simd::load(az + i), Simd::load(bz + i))));
+
+		Simd::storeUnaligned(result.data() + i, product);
+	}
+
+	for (; i < lhs.m_size; ++i)
+	{
+		result[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+	}
 }
 
-LibMath::Vector4 LibMath::operator/(Vector4 vec, float val)
+void LibMath::Vector3Batch::length(Vector3Batch const& batch, std::span<float> result)
 {
-	if (val == 0)
+	if (result.size() < batch.m_size)
+	{
+		throw std::invalid_argument("Error: result span is smaller than the batch");
+	}
+
+	float const* x = batch.m_data;
+	float const* y = batch.m_data + batch.m_stride;
+	float const* z = batch.m_data + 2 * batch.m_stride;
+
+	size_t i = 0;
+
+	for (; i + Simd::c_width <= batch.m_size; i += Simd::c_width)
+	{
+		Simd::Lanes vx = Simd::load(x + i);
+		Simd::Lanes vy = Simd::load(y + i);
+		Simd::Lanes vz = Simd::load(z + i);
+
+		Simd::storeUnaligned(result.data() + i, Simd::sqrt(Simd::mulAdd(vx, vx, Simd::mulAdd(vy, vy, Simd::mul(vz, vz)))));
+	}
+
+	for (; i < batch.m_size; ++i)
 	{
-		throw(std::invalid_argument("Error: division by zero"));
+		result[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
 	}
-	return Vector4(vec.m_x / val, vec.m_y / val, vec.m_z / val, vec.m_w / val);
 }
 
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include <string>
+#include <vector>
+
+#include <glm/common.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include "LibMath/Angle/Degree.h"
+#include "LibMath/Angle/Radian.h"
+#include "LibMath/Arithmetic.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+/*
+* Accumulated angles, as a spinning object or a camera yaw driven by the mouse would produce
+* The large ones are many turns away from the wrapped range
+*/
+static std::vector<float> createAngles(size_t count, float turns)
+{
+	std::vector<float> angles(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float ratio = static_cast<float>(i % 101) / 100.f;
+		angles[i] = (ratio * 2.f - 1.f) * turns * glm::two_pi<float>();
+	}
+
+	return angles;
+}
+
+TEST_CASE("Angle Wrap", "[.benchmark][angle][Radian][Degree]")
+{
+	// the cost should not depend on the number of turns
+	size_t constexpr count = 10000;
+
+	for (float turns : { 1.5f, 1000.f, 1000000.f })
+	{
+		std::vector<float> angles = createAngles(count, turns);
+		std::vector<float> wrapped(count);
+		std::string suffix = " - " + std::to_string(static_cast<int>(turns)) + " turns";
+
+		BENCHMARK("Radian wrap - LibMath" + suffix)
+		{
+			float sum = 0.f;
+			for (float angle : angles)
+			{
+				LibMath::Radian radian(angle);
+				radian.wrap(true);
+				sum += radian.raw();
+			}
+			return sum;
+		};
+
+		BENCHMARK("Radian wrap array - LibMath" + suffix)
+		{
+			wrapped = angles;
+			LibMath::wrap(wrapped, -glm::pi<float>(), glm::pi<float>());
+			return wrapped[count / 2];
+		};
+
+		BENCHMARK("Radian wrap - glm" + suffix)
+		{
+			// glm has no signed wrap, mod gives [0, 2 pi[ and the shift gives [-pi, pi[
+			float sum = 0.f;
+			for (float angle : angles)
+			{
+				sum += glm::mod(angle + glm::pi<float>(), glm::two_pi<float>()) - glm::pi<float>();
+			}
+			return sum;
+		};
+
+		BENCHMARK("Degree wrap - LibMath" + suffix)
+		{
+			float sum = 0.f;
+			for (float angle : angles)
+			{
+				LibMath::Degree degree(angle);
+				degree.wrap(false);
+				sum += degree.raw();
+			}
+			return sum;
+		};
+
+		BENCHMARK("Degree wrap - glm" + suffix)
+		{
+			float sum = 0.f;
+			for (float angle : angles)
+			{
+				sum += glm::mod(angle, 360.f);
+			}
+			return sum;
+		};
+	}
+}
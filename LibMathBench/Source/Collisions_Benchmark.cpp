@@ -0,0 +1,1142 @@
+#include <cmath>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "LibMath/Collisions.h"
+#include "LibMath/ConvexCollisions.h"
+#include "LibMath/DynamicAABBTree.h"
+#include "LibMath/Intersection.h"
+#include "LibMath/SweepAndPrune.h"
+#include "LibMath/Vector/Vector2.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace LibMath::Geometry3D;
+
+namespace Collision = LibMath::Collisions3D;
+
+/*
+* Boxes scattered in a cube whose volume grows with the count,
+* so every object overlaps about the same number of neighbours at any scale
+*/
+static std::vector<AABB> createScene(size_t count)
+{
+	std::mt19937 generator(42);
+	float side = 4.f * std::cbrt(static_cast<float>(count));
+
+	std::uniform_real_distribution<float> position(0.f, side);
+	std::uniform_real_distribution<float> size(0.5f, 2.f);
+
+	std::vector<AABB> boxes;
+	boxes.reserve(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		boxes.emplace_back(Point(position(generator), position(generator), position(generator)), size(generator), size(generator), size(generator));
+	}
+
+	return boxes;
+}
+
+static size_t bruteForcePairs(std::vector<AABB> const& boxes)
+{
+	size_t pairCount = 0;
+
+	for (size_t i = 0; i < boxes.size(); ++i)
+	{
+		for (size_t j = i + 1; j < boxes.size(); ++j)
+		{
+			pairCount += Collision::checkCollisionAABBAABB(boxes[i], boxes[j]);
+		}
+	}
+
+	return pairCount;
+}
+
+static size_t treePairs(Collision::DynamicAABBTree const& tree, std::vector<AABB> const& boxes, std::vector<std::pair<int, int>>& pairs)
+{
+	pairs.clear();
+	tree.queryPairs(pairs);
+
+	// Same narrow phase as the brute force, proxies are the insertion order here
+	size_t pairCount = 0;
+
+	for (auto [first, second] : pairs)
+	{
+		pairCount += Collision::checkCollisionAABBAABB(boxes[first], boxes[second]);
+	}
+
+	return pairCount;
+}
+
+/*
+* Runs one narrow phase test over every pair of the two arrays, index to index,
+* the shapes are spread so that a fair share of the pairs collide and both branches are measured
+*/
+template <class First, class Second>
+static size_t countCollisions(std::vector<First> const& first, std::vector<Second> const& second, bool (*test)(First const&, Second const&))
+{
+	size_t collisionCount = 0;
+
+	for (size_t i = 0; i < first.size(); ++i)
+	{
+		collisionCount += test(first[i], second[i]);
+	}
+
+	return collisionCount;
+}
+
+// Same as countCollisions for the manifold variants, the depths are summed so the manifolds are not optimized away
+template <class First, class Second, class Manifold>
+static float sumDepths(std::vector<First> const& first, std::vector<Second> const& second, bool (*test)(First const&, Second const&, Manifold&))
+{
+	Manifold manifold;
+	float depth = 0.f;
+
+	for (size_t i = 0; i < first.size(); ++i)
+	{
+		if (test(first[i], second[i], manifold))
+		{
+			depth += manifold.m_depth;
+		}
+	}
+
+	return depth;
+}
+
+TEST_CASE("Broad Phase", "[.benchmark][collision][DynamicAABBTree]")
+{
+	for (size_t count : { 1000, 10000, 100000 })
+	{
+		std::vector<AABB> boxes = createScene(count);
+		std::string suffix = " - " + std::to_string(count) + " objects";
+
+		Collision::DynamicAABBTree tree;
+		for (AABB const& box : boxes)
+		{
+			tree.insert(box);
+		}
+
+		std::vector<std::pair<int, int>> pairs;
+		if (count <= 10000)
+		{
+			REQUIRE(treePairs(tree, boxes, pairs) == bruteForcePairs(boxes));
+		}
+
+		BENCHMARK("Build - DynamicAABBTree" + suffix)
+		{
+			Collision::DynamicAABBTree built;
+			for (AABB const& box : boxes)
+			{
+				built.insert(box);
+			}
+			return built.height();
+		};
+
+		BENCHMARK("Pairs - DynamicAABBTree" + suffix)
+		{
+			return treePairs(tree, boxes, pairs);
+		};
+
+		BENCHMARK("Move and pairs - DynamicAABBTree" + suffix)
+		{
+			// Small jitter, most proxies stay inside their fat AABB
+			float offset = 0.02f;
+			for (size_t i = 0; i < boxes.size(); ++i)
+			{
+				boxes[i].m_center.m_x += offset;
+				tree.move(static_cast<int>(i), boxes[i], LibMath::Vector3(offset, 0.f, 0.f));
+				offset = -offset;
+			}
+			return treePairs(tree, boxes, pairs);
+		};
+
+		if (count <= 10000)
+		{
+			BENCHMARK("Pairs - brute force" + suffix)
+			{
+				return bruteForcePairs(boxes);
+			};
+		}
+	}
+}
+
+TEST_CASE("Broad Phase Brute Force 100k", "[.benchmark][collision][bruteforce]")
+{
+	// About 5 billion box tests per run, run it with --benchmark-samples 1
+	std::vector<AABB> boxes = createScene(100000);
+
+	BENCHMARK("Pairs - brute force - 100000 objects")
+	{
+		return bruteForcePairs(boxes);
+	};
+}
+
+TEST_CASE("Broad Phase 2D", "[.benchmark][collision][SweepAndPrune]")
+{
+	// Game server tick : 10000 moving circles, integrate then find the colliding pairs
+	size_t constexpr count = 10000;
+	float constexpr deltaTime = 1.f / 60.f;
+
+	std::mt19937 generator(42);
+	float side = 3.f * std::sqrt(static_cast<float>(count));
+
+	std::uniform_real_distribution<float> position(0.f, side);
+	std::uniform_real_distribution<float> velocity(-2.f, 2.f);
+	std::uniform_real_distribution<float> radius(0.25f, 1.f);
+
+	std::vector<LibMath::Geometry2D::Circle> circles;
+	std::vector<LibMath::Vector2> velocities;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		circles.emplace_back(LibMath::Geometry2D::Point(position(generator), position(generator)), radius(generator));
+		velocities.emplace_back(velocity(generator), velocity(generator));
+	}
+
+	auto integrate = [&]()
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			circles[i].m_center.m_x += velocities[i].m_x * deltaTime;
+			circles[i].m_center.m_y += velocities[i].m_y * deltaTime;
+
+			// Bounce on the borders of the world
+			if (circles[i].m_center.m_x < 0.f || circles[i].m_center.m_x > side)
+			{
+				velocities[i].m_x = -velocities[i].m_x;
+			}
+			if (circles[i].m_center.m_y < 0.f || circles[i].m_center.m_y > side)
+			{
+				velocities[i].m_y = -velocities[i].m_y;
+			}
+		}
+	};
+
+	LibMath::Collision2D::SweepAndPrune broadPhase;
+	for (LibMath::Geometry2D::Circle const& circle : circles)
+	{
+		broadPhase.insert(LibMath::Geometry2D::getBoundingAABB(circle));
+	}
+
+	std::vector<std::pair<int, int>> candidates;
+
+	BENCHMARK("10000 entities tick - brute force")
+	{
+		integrate();
+
+		size_t pairCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			for (size_t j = i + 1; j < count; ++j)
+			{
+				pairCount += LibMath::Collision2D::checkCollisionCircleCircle(circles[i], circles[j]);
+			}
+		}
+		return pairCount;
+	};
+
+	BENCHMARK("10000 entities tick - SweepAndPrune rebuilt")
+	{
+		integrate();
+
+		LibMath::Collision2D::SweepAndPrune rebuilt;
+		for (LibMath::Geometry2D::Circle const& circle : circles)
+		{
+			rebuilt.insert(LibMath::Geometry2D::getBoundingAABB(circle));
+		}
+
+		candidates.clear();
+		rebuilt.queryPairs(candidates);
+
+		size_t pairCount = 0;
+		for (auto [first, second] : candidates)
+		{
+			pairCount += LibMath::Collision2D::checkCollisionCircleCircle(circles[first], circles[second]);
+		}
+		return pairCount;
+	};
+
+	BENCHMARK("10000 entities tick - SweepAndPrune incremental")
+	{
+		integrate();
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			broadPhase.move(static_cast<int>(i), LibMath::Geometry2D::getBoundingAABB(circles[i]));
+		}
+
+		candidates.clear();
+		broadPhase.queryPairs(candidates);
+
+		size_t pairCount = 0;
+		for (auto [first, second] : candidates)
+		{
+			pairCount += LibMath::Collision2D::checkCollisionCircleCircle(circles[first], circles[second]);
+		}
+		return pairCount;
+	};
+}
+
+TEST_CASE("Raycast", "[.benchmark][collision][raycast]")
+{
+	// Picking like workload : a packet of rays fired at one shape
+	size_t constexpr count = 10000;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> spread(-3.f, 3.f);
+
+	std::vector<Line> rays;
+	rays.reserve(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		LibMath::Vector3 direction(10.f, spread(generator), spread(generator));
+		direction.normalize();
+
+		rays.emplace_back(Point(-10.f, 0.f, 0.f), direction, 100.f);
+	}
+
+	std::vector<LibMath::Intersection3D::RaycastHit> hits(count);
+
+	AABB aabb(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f);
+	OBB obb(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f, LibMath::Radian(0.5f));
+
+	BENCHMARK("AABB - checkCollisionAABBLine (no hit data)")
+	{
+		size_t hitCount = 0;
+		for (Line const& ray : rays)
+		{
+			hitCount += Collision::checkCollisionAABBLine(aabb, ray);
+		}
+		return hitCount;
+	};
+
+	BENCHMARK("AABB - raycast")
+	{
+		size_t hitCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			hitCount += LibMath::Intersection3D::raycast(rays[i], aabb, hits[i]);
+		}
+		return hitCount;
+	};
+
+	BENCHMARK("AABB - raycast packet")
+	{
+		return LibMath::Intersection3D::raycast(rays, aabb, hits);
+	};
+
+	BENCHMARK("OBB - raycast")
+	{
+		size_t hitCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			hitCount += LibMath::Intersection3D::raycast(rays[i], obb, hits[i]);
+		}
+		return hitCount;
+	};
+
+	BENCHMARK("OBB - raycast packet")
+	{
+		return LibMath::Intersection3D::raycast(rays, obb, hits);
+	};
+}
+
+TEST_CASE("Narrow Phase 3D", "[.benchmark][collision][Collision3D]")
+{
+	size_t constexpr count = 10000;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> position(0.f, 10.f);
+	std::uniform_real_distribution<float> direction(-1.f, 1.f);
+	std::uniform_real_distribution<float> size(0.5f, 3.f);
+
+	auto randomPoint = [&]()
+	{
+		return Point(position(generator), position(generator), position(generator));
+	};
+
+	auto randomRotation = [&]()
+	{
+		LibMath::Quaternion rotation(direction(generator), direction(generator), direction(generator), direction(generator));
+		rotation.normalize();
+		return rotation;
+	};
+
+	std::vector<Point> points;
+	std::vector<Line> lines;
+	std::vector<Plan> plans;
+	std::vector<Plan> otherPlans;
+	std::vector<AABB> boxes;
+	std::vector<AABB> otherBoxes;
+	std::vector<OBB> orientedBoxes;
+	std::vector<OBB> otherOrientedBoxes;
+	std::vector<Sphere> spheres;
+	std::vector<Sphere> otherSpheres;
+	std::vector<Capsule> capsules;
+	std::vector<Capsule> otherCapsules;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		points.push_back(randomPoint());
+		lines.emplace_back(randomPoint(), randomPoint());
+		plans.emplace_back(LibMath::Vector3(direction(generator), direction(generator), direction(generator) + 2.f), position(generator));
+		otherPlans.emplace_back(LibMath::Vector3(direction(generator), direction(generator), direction(generator) + 2.f), position(generator));
+		boxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator));
+		otherBoxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator));
+		orientedBoxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator), randomRotation());
+		otherOrientedBoxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator), randomRotation());
+		spheres.emplace_back(randomPoint(), size(generator));
+		otherSpheres.emplace_back(randomPoint(), size(generator));
+		capsules.emplace_back(randomPoint(), randomPoint(), size(generator) * 0.5f);
+		otherCapsules.emplace_back(randomPoint(), randomPoint(), size(generator) * 0.5f);
+	}
+
+	BENCHMARK("checkCollisionSphereSphere")
+	{
+		return countCollisions(spheres, otherSpheres, &Collision::checkCollisionSphereSphere);
+	};
+
+	BENCHMARK("checkCollisionSpherePoint")
+	{
+		return countCollisions(spheres, points, &Collision::checkCollisionSpherePoint);
+	};
+
+	BENCHMARK("checkCollisionSphereLine")
+	{
+		return countCollisions(spheres, lines, &Collision::checkCollisionSphereLine);
+	};
+
+	BENCHMARK("checkCollisionSpherePlan")
+	{
+		return countCollisions(spheres, plans, &Collision::checkCollisionSpherePlan);
+	};
+
+	BENCHMARK("checkCollisionPlanPlan")
+	{
+		return countCollisions(plans, otherPlans, &Collision::checkCollisionPlanPlan);
+	};
+
+	BENCHMARK("checkCollisionPlanLine")
+	{
+		return countCollisions(plans, lines, &Collision::checkCollisionPlanLine);
+	};
+
+	BENCHMARK("checkCollisionPlanPoint")
+	{
+		return countCollisions(plans, points, &Collision::checkCollisionPlanPoint);
+	};
+
+	BENCHMARK("checkCollisionCapsulePoint")
+	{
+		return countCollisions(capsules, points, &Collision::checkCollisionCapsulePoint);
+	};
+
+	BENCHMARK("checkCollisionCapsuleLine")
+	{
+		return countCollisions(capsules, lines, &Collision::checkCollisionCapsuleLine);
+	};
+
+	BENCHMARK("checkCollisionCapsuleAABB")
+	{
+		return countCollisions(capsules, boxes, &Collision::checkCollisionCapsuleAABB);
+	};
+
+	BENCHMARK("checkCollisionCapsuleCapsule")
+	{
+		return countCollisions(capsules, otherCapsules, &Collision::checkCollisionCapsuleCapsule);
+	};
+
+	BENCHMARK("checkCollisionCapsulePlan")
+	{
+		return countCollisions(capsules, plans, &Collision::checkCollisionCapsulePlan);
+	};
+
+	BENCHMARK("checkCollisionCapsuleSphere")
+	{
+		return countCollisions(capsules, spheres, &Collision::checkCollisionCapsuleSphere);
+	};
+
+	BENCHMARK("checkCollisionAABBLine")
+	{
+		return countCollisions(boxes, lines, &Collision::checkCollisionAABBLine);
+	};
+
+	BENCHMARK("checkCollisionAABBAABB")
+	{
+		return countCollisions(boxes, otherBoxes, &Collision::checkCollisionAABBAABB);
+	};
+
+	BENCHMARK("checkCollisionAABBPoint")
+	{
+		return countCollisions(boxes, points, &Collision::checkCollisionAABBPoint);
+	};
+
+	BENCHMARK("checkCollisionAABBShpere")
+	{
+		return countCollisions(boxes, spheres, &Collision::checkCollisionAABBShpere);
+	};
+
+	// the face axes come first, most of the disjoint pairs return before the 9 edge axes
+	BENCHMARK("checkCollisionOBBOBB")
+	{
+		return countCollisions(orientedBoxes, otherOrientedBoxes, &Collision::checkCollisionOBBOBB);
+	};
+
+	BENCHMARK("checkCollisionOBBAABB")
+	{
+		return countCollisions(orientedBoxes, boxes, &Collision::checkCollisionOBBAABB);
+	};
+
+	BENCHMARK("checkCollisionOBBSphere")
+	{
+		return countCollisions(orientedBoxes, spheres, &Collision::checkCollisionOBBSphere);
+	};
+
+	BENCHMARK("checkCollisionOBBCapsule")
+	{
+		return countCollisions(orientedBoxes, capsules, &Collision::checkCollisionOBBCapsule);
+	};
+
+	BENCHMARK("checkCollisionOBBLine")
+	{
+		return countCollisions(orientedBoxes, lines, &Collision::checkCollisionOBBLine);
+	};
+
+	BENCHMARK("checkCollisionOBBPoint")
+	{
+		return countCollisions(orientedBoxes, points, &Collision::checkCollisionOBBPoint);
+	};
+}
+
+TEST_CASE("Contact Manifolds", "[.benchmark][collision][manifold]")
+{
+	// Each manifold next to its boolean test on the same pairs : the difference is the price of the contact data
+	size_t constexpr count = 10000;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> position(0.f, 10.f);
+	std::uniform_real_distribution<float> direction(-1.f, 1.f);
+	std::uniform_real_distribution<float> size(0.5f, 3.f);
+
+	auto randomPoint = [&]()
+	{
+		return Point(position(generator), position(generator), position(generator));
+	};
+
+	std::vector<Plan> plans;
+	std::vector<AABB> boxes;
+	std::vector<AABB> otherBoxes;
+	std::vector<Sphere> spheres;
+	std::vector<Sphere> otherSpheres;
+	std::vector<Capsule> capsules;
+	std::vector<Capsule> otherCapsules;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		plans.emplace_back(LibMath::Vector3(direction(generator), direction(generator), direction(generator) + 2.f), -position(generator));
+		boxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator));
+		otherBoxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator));
+		spheres.emplace_back(randomPoint(), size(generator));
+		otherSpheres.emplace_back(randomPoint(), size(generator));
+		capsules.emplace_back(randomPoint(), randomPoint(), size(generator) * 0.5f);
+		otherCapsules.emplace_back(randomPoint(), randomPoint(), size(generator) * 0.5f);
+	}
+
+	BENCHMARK("checkCollisionSphereSphere")
+	{
+		return countCollisions(spheres, otherSpheres, &Collision::checkCollisionSphereSphere);
+	};
+
+	BENCHMARK("getManifoldSphereSphere")
+	{
+		return sumDepths(spheres, otherSpheres, &Collision::getManifoldSphereSphere);
+	};
+
+	BENCHMARK("checkCollisionCapsuleSphere")
+	{
+		return countCollisions(capsules, spheres, &Collision::checkCollisionCapsuleSphere);
+	};
+
+	BENCHMARK("getManifoldSphereCapsule")
+	{
+		return sumDepths(spheres, capsules, &Collision::getManifoldSphereCapsule);
+	};
+
+	BENCHMARK("checkCollisionAABBShpere")
+	{
+		return countCollisions(boxes, spheres, &Collision::checkCollisionAABBShpere);
+	};
+
+	BENCHMARK("getManifoldSphereAABB")
+	{
+		return sumDepths(spheres, boxes, &Collision::getManifoldSphereAABB);
+	};
+
+	BENCHMARK("checkCollisionCapsuleCapsule")
+	{
+		return countCollisions(capsules, otherCapsules, &Collision::checkCollisionCapsuleCapsule);
+	};
+
+	BENCHMARK("getManifoldCapsuleCapsule")
+	{
+		return sumDepths(capsules, otherCapsules, &Collision::getManifoldCapsuleCapsule);
+	};
+
+	BENCHMARK("checkCollisionCapsulePlan")
+	{
+		return countCollisions(capsules, plans, &Collision::checkCollisionCapsulePlan);
+	};
+
+	BENCHMARK("getManifoldCapsulePlan")
+	{
+		return sumDepths(capsules, plans, &Collision::getManifoldCapsulePlan);
+	};
+
+	BENCHMARK("checkCollisionAABBAABB")
+	{
+		return countCollisions(boxes, otherBoxes, &Collision::checkCollisionAABBAABB);
+	};
+
+	BENCHMARK("getManifoldAABBAABB")
+	{
+		return sumDepths(boxes, otherBoxes, &Collision::getManifoldAABBAABB);
+	};
+}
+
+TEST_CASE("Convex Narrow Phase", "[.benchmark][collision][gjk]")
+{
+	// GJK against the specialised tests on the same pairs, to decide which pairs to dispatch to GJK
+	// every GJK call goes through the support functions of ConvexShape, the specialised ones are straight code
+	size_t constexpr count = 10000;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> position(0.f, 6.f);
+	std::uniform_real_distribution<float> component(-1.f, 1.f);
+	std::uniform_real_distribution<float> size(0.5f, 3.f);
+
+	auto randomPoint = [&]()
+	{
+		return Point(position(generator), position(generator), position(generator));
+	};
+
+	std::vector<Sphere> spheres;
+	std::vector<Sphere> otherSpheres;
+	std::vector<OBB> orientedBoxes;
+	std::vector<OBB> otherOrientedBoxes;
+	std::vector<Capsule> capsules;
+	std::vector<Capsule> otherCapsules;
+	std::vector<ConvexHull> hulls;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		LibMath::Quaternion rotation(component(generator), component(generator), component(generator), component(generator));
+		LibMath::Quaternion otherRotation(component(generator), component(generator), component(generator), component(generator));
+		rotation.normalize();
+		otherRotation.normalize();
+
+		spheres.emplace_back(randomPoint(), size(generator));
+		otherSpheres.emplace_back(randomPoint(), size(generator));
+		orientedBoxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator), rotation);
+		otherOrientedBoxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator), otherRotation);
+		capsules.emplace_back(randomPoint(), randomPoint(), size(generator) * 0.5f);
+		otherCapsules.emplace_back(randomPoint(), randomPoint(), size(generator) * 0.5f);
+
+		// 12 points on a rough ball, like a small collision hull
+		std::vector<Point> points;
+		Point center = randomPoint();
+		for (int j = 0; j < 12; ++j)
+		{
+			points.emplace_back(center.toVector3() + LibMath::Vector3(component(generator), component(generator), component(generator)));
+		}
+		hulls.emplace_back(points);
+	}
+
+	BENCHMARK("Sphere Sphere - checkCollisionSphereSphere")
+	{
+		return countCollisions(spheres, otherSpheres, &Collision::checkCollisionSphereSphere);
+	};
+
+	BENCHMARK("Sphere Sphere - GJK")
+	{
+		size_t collisionCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			collisionCount += Collision::checkCollisionConvex(spheres[i], otherSpheres[i]);
+		}
+		return collisionCount;
+	};
+
+	BENCHMARK("OBB OBB - checkCollisionOBBOBB")
+	{
+		return countCollisions(orientedBoxes, otherOrientedBoxes, &Collision::checkCollisionOBBOBB);
+	};
+
+	BENCHMARK("OBB OBB - GJK")
+	{
+		size_t collisionCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			collisionCount += Collision::checkCollisionConvex(orientedBoxes[i], otherOrientedBoxes[i]);
+		}
+		return collisionCount;
+	};
+
+	BENCHMARK("OBB Sphere - checkCollisionOBBSphere")
+	{
+		return countCollisions(orientedBoxes, spheres, &Collision::checkCollisionOBBSphere);
+	};
+
+	BENCHMARK("OBB Sphere - GJK")
+	{
+		size_t collisionCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			collisionCount += Collision::checkCollisionConvex(orientedBoxes[i], spheres[i]);
+		}
+		return collisionCount;
+	};
+
+	BENCHMARK("OBB Capsule - checkCollisionOBBCapsule")
+	{
+		return countCollisions(orientedBoxes, capsules, &Collision::checkCollisionOBBCapsule);
+	};
+
+	BENCHMARK("OBB Capsule - GJK")
+	{
+		size_t collisionCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			collisionCount += Collision::checkCollisionConvex(orientedBoxes[i], capsules[i]);
+		}
+		return collisionCount;
+	};
+
+	BENCHMARK("Capsule Capsule - checkCollisionCapsuleCapsule")
+	{
+		return countCollisions(capsules, otherCapsules, &Collision::checkCollisionCapsuleCapsule);
+	};
+
+	BENCHMARK("Capsule Capsule - GJK")
+	{
+		size_t collisionCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			collisionCount += Collision::checkCollisionConvex(capsules[i], otherCapsules[i]);
+		}
+		return collisionCount;
+	};
+
+	BENCHMARK("Hull OBB - GJK (12 points)")
+	{
+		size_t collisionCount = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			collisionCount += Collision::checkCollisionConvex(hulls[i], orientedBoxes[i]);
+		}
+		return collisionCount;
+	};
+
+	// Distance of slowly moving pairs, every pair keeps its cache from one frame to the next
+	std::vector<Collision::GjkCache> caches(count);
+	LibMath::Vector3 const step(0.001f, 0.f, 0.f);
+
+	BENCHMARK("OBB Capsule distance - GJK cold start")
+	{
+		float total = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			orientedBoxes[i].m_center = orientedBoxes[i].m_center.toVector3() + step;
+			total += Collision::getDistanceConvex(orientedBoxes[i], capsules[i]).m_distance;
+		}
+		return total;
+	};
+
+	BENCHMARK("OBB Capsule distance - GJK warm start")
+	{
+		float total = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			orientedBoxes[i].m_center = orientedBoxes[i].m_center.toVector3() - step;
+			total += Collision::getDistanceConvex(orientedBoxes[i], capsules[i], &caches[i]).m_distance;
+		}
+		return total;
+	};
+
+	BENCHMARK("OBB OBB penetration - GJK + EPA")
+	{
+		Collision::Penetration penetration;
+		float total = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (Collision::getPenetrationConvex(orientedBoxes[i], otherOrientedBoxes[i], penetration))
+			{
+				total += penetration.m_depth;
+			}
+		}
+		return total;
+	};
+}
+
+TEST_CASE("Swept Tests", "[.benchmark][collision][sweep]")
+{
+	// Closed form sweeps against conservative advancement on the same moves, GJK is the fallback of the other pairs
+	size_t constexpr count = 10000;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> position(0.f, 6.f);
+	std::uniform_real_distribution<float> component(-1.f, 1.f);
+	std::uniform_real_distribution<float> size(0.5f, 3.f);
+
+	auto randomPoint = [&]()
+	{
+		return Point(position(generator), position(generator), position(generator));
+	};
+
+	std::vector<Sphere> spheres;
+	std::vector<LibMath::Vector3> velocities;
+	std::vector<Sphere> otherSpheres;
+	std::vector<AABB> boxes;
+	std::vector<OBB> orientedBoxes;
+	std::vector<Capsule> capsules;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		LibMath::Quaternion rotation(component(generator), component(generator), component(generator), component(generator));
+		rotation.normalize();
+
+		spheres.emplace_back(randomPoint(), size(generator) * 0.25f);
+		velocities.emplace_back(LibMath::Vector3(component(generator), component(generator), component(generator)) * 6.f);
+		otherSpheres.emplace_back(randomPoint(), size(generator) * 0.5f);
+		boxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator));
+		orientedBoxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator), rotation);
+		capsules.emplace_back(randomPoint(), randomPoint(), size(generator) * 0.25f);
+	}
+
+	LibMath::Vector3 const still(0.f, 0.f, 0.f);
+
+	// sum of the times of impact, the sweeps and the advancement land on the same total within the tolerance
+	auto sumSweeps = [&](auto const& targets)
+	{
+		float total = 0.f;
+		LibMath::Intersection3D::SweepHit hit;
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (LibMath::Intersection3D::sweep(spheres[i], velocities[i], targets[i], hit))
+			{
+				total += hit.m_time;
+			}
+		}
+		return total;
+	};
+
+	auto sumAdvancements = [&](auto const& targets)
+	{
+		float total = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			float time = 0.f;
+			if (Collision::getTimeOfImpactConvex(spheres[i], velocities[i], targets[i], still, time))
+			{
+				total += time;
+			}
+		}
+		return total;
+	};
+
+	BENCHMARK("Sphere Sphere - sweep")
+	{
+		return sumSweeps(otherSpheres);
+	};
+
+	BENCHMARK("Sphere Sphere - conservative advancement")
+	{
+		return sumAdvancements(otherSpheres);
+	};
+
+	BENCHMARK("Sphere AABB - sweep")
+	{
+		return sumSweeps(boxes);
+	};
+
+	BENCHMARK("Sphere AABB - conservative advancement")
+	{
+		return sumAdvancements(boxes);
+	};
+
+	BENCHMARK("Sphere Capsule - sweep")
+	{
+		return sumSweeps(capsules);
+	};
+
+	BENCHMARK("Sphere Capsule - conservative advancement")
+	{
+		return sumAdvancements(capsules);
+	};
+
+	BENCHMARK("Sphere OBB - conservative advancement")
+	{
+		return sumAdvancements(orientedBoxes);
+	};
+
+	BENCHMARK("AABB AABB - sweep")
+	{
+		float total = 0.f;
+		LibMath::Intersection3D::SweepHit hit;
+		for (size_t i = 0; i < count; ++i)
+		{
+			AABB moving(spheres[i].m_center, spheres[i].m_radius * 2.f, spheres[i].m_radius * 2.f, spheres[i].m_radius * 2.f);
+			if (LibMath::Intersection3D::sweep(moving, velocities[i], boxes[i], hit))
+			{
+				total += hit.m_time;
+			}
+		}
+		return total;
+	};
+}
+
+TEST_CASE("Batched Overlaps", "[.benchmark][collision][batch]")
+{
+	// The pair tests in a loop against the batched kernels on the same shapes, the test counts are part of the names :
+	// tests per second = test count / mean time
+	size_t constexpr count = 100000;
+	size_t constexpr blockCount = 1000;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> position(0.f, 100.f);
+	std::uniform_real_distribution<float> size(0.5f, 3.f);
+
+	auto randomPoint = [&]()
+	{
+		return Point(position(generator), position(generator), position(generator));
+	};
+
+	std::vector<Sphere> spheres;
+	std::vector<AABB> boxes;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		spheres.emplace_back(randomPoint(), size(generator));
+		boxes.emplace_back(randomPoint(), size(generator), size(generator), size(generator));
+	}
+
+	Sphere const sphere(Point(50.f, 50.f, 50.f), 10.f);
+	AABB const aabb(Point(50.f, 50.f, 50.f), 20.f, 20.f, 20.f);
+
+	Collision::SphereBatch sphereBatch;
+	Collision::AABBBatch boxBatch;
+	sphereBatch.load(spheres);
+	boxBatch.load(boxes);
+
+	// 2 blocks of 1000 shapes for the N x M tests
+	std::span<Sphere const> const sphereBlock1(spheres.data(), blockCount);
+	std::span<Sphere const> const sphereBlock2(spheres.data() + blockCount, blockCount);
+	std::span<AABB const> const boxBlock1(boxes.data(), blockCount);
+	std::span<AABB const> const boxBlock2(boxes.data() + blockCount, blockCount);
+
+	Collision::SphereBatch sphereBatch1;
+	Collision::SphereBatch sphereBatch2;
+	Collision::AABBBatch boxBatch1;
+	Collision::AABBBatch boxBatch2;
+	sphereBatch1.load(sphereBlock1);
+	sphereBatch2.load(sphereBlock2);
+	boxBatch1.load(boxBlock1);
+	boxBatch2.load(boxBlock2);
+
+	std::vector<int> indices;
+	std::vector<std::pair<int, int>> pairs;
+	indices.reserve(count);
+	pairs.reserve(blockCount * blockCount);
+
+	std::string const oneAgainstMany = " 1 x " + std::to_string(count) + " tests";
+	std::string const manyAgainstMany = " " + std::to_string(blockCount) + " x " + std::to_string(blockCount) + " tests";
+
+	BENCHMARK("Sphere Sphere" + oneAgainstMany + " - checkCollisionSphereSphere")
+	{
+		indices.clear();
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (Collision::checkCollisionSphereSphere(sphere, spheres[i]))
+			{
+				indices.push_back(static_cast<int>(i));
+			}
+		}
+		return indices.size();
+	};
+
+	BENCHMARK("Sphere Sphere" + oneAgainstMany + " - SphereBatch")
+	{
+		indices.clear();
+		Collision::checkCollisionSphereSphere(sphere, sphereBatch, indices);
+		return indices.size();
+	};
+
+	BENCHMARK("AABB AABB" + oneAgainstMany + " - checkCollisionAABBAABB")
+	{
+		indices.clear();
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (Collision::checkCollisionAABBAABB(aabb, boxes[i]))
+			{
+				indices.push_back(static_cast<int>(i));
+			}
+		}
+		return indices.size();
+	};
+
+	BENCHMARK("AABB AABB" + oneAgainstMany + " - AABBBatch")
+	{
+		indices.clear();
+		Collision::checkCollisionAABBAABB(aabb, boxBatch, indices);
+		return indices.size();
+	};
+
+	BENCHMARK("Sphere Sphere" + manyAgainstMany + " - checkCollisionSphereSphere")
+	{
+		pairs.clear();
+		for (size_t i = 0; i < blockCount; ++i)
+		{
+			for (size_t j = 0; j < blockCount; ++j)
+			{
+				if (Collision::checkCollisionSphereSphere(sphereBlock1[i], sphereBlock2[j]))
+				{
+					pairs.emplace_back(static_cast<int>(i), static_cast<int>(j));
+				}
+			}
+		}
+		return pairs.size();
+	};
+
+	BENCHMARK("Sphere Sphere" + manyAgainstMany + " - SphereBatch")
+	{
+		pairs.clear();
+		Collision::checkCollisionSphereSphere(sphereBatch1, sphereBatch2, pairs);
+		return pairs.size();
+	};
+
+	BENCHMARK("AABB AABB" + manyAgainstMany + " - checkCollisionAABBAABB")
+	{
+		pairs.clear();
+		for (size_t i = 0; i < blockCount; ++i)
+		{
+			for (size_t j = 0; j < blockCount; ++j)
+			{
+				if (Collision::checkCollisionAABBAABB(boxBlock1[i], boxBlock2[j]))
+				{
+					pairs.emplace_back(static_cast<int>(i), static_cast<int>(j));
+				}
+			}
+		}
+		return pairs.size();
+	};
+
+	BENCHMARK("AABB AABB" + manyAgainstMany + " - AABBBatch")
+	{
+		pairs.clear();
+		Collision::checkCollisionAABBAABB(boxBatch1, boxBatch2, pairs);
+		return pairs.size();
+	};
+}
+
+TEST_CASE("Narrow Phase 2D", "[.benchmark][collision][Collision2D]")
+{
+	namespace Geometry2D = LibMath::Geometry2D;
+	namespace Collision2D = LibMath::Collision2D;
+
+	size_t constexpr count = 10000;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> position(0.f, 10.f);
+	std::uniform_real_distribution<float> size(0.5f, 3.f);
+	std::uniform_real_distribution<float> angle(0.f, 6.28f);
+
+	auto randomPoint = [&]()
+	{
+		return Geometry2D::Point(position(generator), position(generator));
+	};
+
+	std::vector<Geometry2D::Point> points;
+	std::vector<Geometry2D::Line> lines;
+	std::vector<Geometry2D::Line> otherLines;
+	std::vector<Geometry2D::AABB> boxes;
+	std::vector<Geometry2D::AABB> otherBoxes;
+	std::vector<Geometry2D::OBB> orientedBoxes;
+	std::vector<Geometry2D::OBB> otherOrientedBoxes;
+	std::vector<Geometry2D::Circle> circles;
+	std::vector<Geometry2D::Circle> otherCircles;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		points.push_back(randomPoint());
+		lines.emplace_back(randomPoint(), randomPoint());
+		otherLines.emplace_back(randomPoint(), randomPoint());
+		boxes.emplace_back(randomPoint(), size(generator), size(generator));
+		otherBoxes.emplace_back(randomPoint(), size(generator), size(generator));
+		orientedBoxes.emplace_back(randomPoint(), size(generator), size(generator));
+		orientedBoxes.back().rotate(LibMath::Radian(angle(generator)));
+		otherOrientedBoxes.emplace_back(randomPoint(), size(generator), size(generator));
+		otherOrientedBoxes.back().rotate(LibMath::Radian(angle(generator)));
+		circles.emplace_back(randomPoint(), size(generator));
+		otherCircles.emplace_back(randomPoint(), size(generator));
+	}
+
+	BENCHMARK("checkCollisionLinePoint 2D")
+	{
+		return countCollisions(lines, points, &Collision2D::checkCollisionLinePoint);
+	};
+
+	BENCHMARK("checkCollisionLineLine 2D")
+	{
+		return countCollisions(lines, otherLines, &Collision2D::checkCollisionLineLine);
+	};
+
+	BENCHMARK("checkCollisionAABBPoint 2D")
+	{
+		return countCollisions(boxes, points, &Collision2D::checkCollisionAABBPoint);
+	};
+
+	BENCHMARK("checkCollisionAABBLine 2D")
+	{
+		return countCollisions(boxes, lines, &Collision2D::checkCollisionAABBLine);
+	};
+
+	BENCHMARK("checkCollisionAABBAABB 2D")
+	{
+		return countCollisions(boxes, otherBoxes, &Collision2D::checkCollisionAABBAABB);
+	};
+
+	BENCHMARK("checkCollisionOBBOBB 2D")
+	{
+		return countCollisions(orientedBoxes, otherOrientedBoxes, &Collision2D::checkCollisionOBBOBB);
+	};
+
+	BENCHMARK("checkCollisionCirclePoint 2D")
+	{
+		return countCollisions(circles, points, &Collision2D::checkCollisionCirclePoint);
+	};
+
+	BENCHMARK("checkCollisionCircleLine 2D")
+	{
+		return countCollisions(circles, lines, &Collision2D::checkCollisionCircleLine);
+	};
+
+	BENCHMARK("checkCollisionCircleCircle 2D")
+	{
+		return countCollisions(circles, otherCircles, &Collision2D::checkCollisionCircleCircle);
+	};
+
+	BENCHMARK("checkCollisionCircleOBB 2D")
+	{
+		return countCollisions(circles, orientedBoxes, &Collision2D::checkCollisionCircleOBB);
+	};
+
+	BENCHMARK("getManifoldCircleOBB 2D")
+	{
+		return sumDepths(circles, orientedBoxes, &Collision2D::getManifoldCircleOBB);
+	};
+}
@@ -0,0 +1,33 @@
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+
+/*
+* Every benchmark is tagged [.benchmark] plus the tags of the function under test ([vector], [matrix], [Quaternion], [angle], [collision], ...)
+* and runs next to its glm counterpart when glm has one
+*
+* With no argument, every benchmark but the [bruteforce] one runs and the results are written to the console and to LibMathBench.json,
+* the json files of two commits can be diffed to spot a regression
+* The 100k brute force takes about a minute per sample, run it alone: LibMathBench "[bruteforce]" --benchmark-samples 1
+* Any argument replaces the defaults, ex: LibMathBench "[matrix]" -r json::out=matrix.json
+*/
+
+int main(int argc, char* argv[])
+{
+	std::vector<char const*> arguments;
+	for (int i = 0; i < argc; i++)
+	{
+		arguments.push_back(argv[i]);
+	}
+
+	if (argc == 1)
+	{
+		arguments.push_back("[benchmark]~[bruteforce]");
+		arguments.push_back("--reporter");
+		arguments.push_back("console");
+		arguments.push_back("--reporter");
+		arguments.push_back("json::out=LibMathBench.json");
+	}
+
+	return Catch::Session().run((int)arguments.size(), arguments.data());
+}
@@ -0,0 +1,434 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <vector>
+
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/matrix_decompose.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/matrix.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Matrix4Vector4Operation.h"
+#include "LibMath/Quaternion.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+/*
+* Scalar reference going through the bounds-checked accessor,
+* kept here to measure the vectorized kernels against the original implementation
+*/
+static LibMath::Vector4 scalarMultiply(LibMath::Matrix4 const& m, LibMath::Vector4 const& vec)
+{
+	return LibMath::Vector4(
+		(m[0][0] * vec.m_x) + (m[1][0] * vec.m_y) + (m[2][0] * vec.m_z) + (m[3][0] * vec.m_w),
+		(m[0][1] * vec.m_x) + (m[1][1] * vec.m_y) + (m[2][1] * vec.m_z) + (m[3][1] * vec.m_w),
+		(m[0][2] * vec.m_x) + (m[1][2] * vec.m_y) + (m[2][2] * vec.m_z) + (m[3][2] * vec.m_w),
+		(m[0][3] * vec.m_x) + (m[1][3] * vec.m_y) + (m[2][3] * vec.m_z) + (m[3][3] * vec.m_w)
+	);
+}
+
+static LibMath::Matrix4 scalarMultiply(LibMath::Matrix4 const& m1, LibMath::Matrix4 const& m2)
+{
+	LibMath::Matrix4 result;
+
+	for (size_t column = 0; column < 4; ++column)
+	{
+		for (size_t row = 0; row < 4; ++row)
+		{
+			result[column][row] = (m1[0][row] * m2[column][0]) + (m1[1][row] * m2[column][1]) +
+								  (m1[2][row] * m2[column][2]) + (m1[3][row] * m2[column][3]);
+		}
+	}
+
+	return result;
+}
+
+static LibMath::Matrix4 scalarMultiplyUnchecked(LibMath::Matrix4 const& m1, LibMath::Matrix4 const& m2)
+{
+	// same loop as scalarMultiply through the unchecked accessor, only bounds checked in debug builds
+	LibMath::Matrix4 result;
+
+	for (size_t column = 0; column < 4; ++column)
+	{
+		for (size_t row = 0; row < 4; ++row)
+		{
+			result.at_unchecked(column, row) = (m1.at_unchecked(0, row) * m2.at_unchecked(column, 0)) + (m1.at_unchecked(1, row) * m2.at_unchecked(column, 1)) +
+											   (m1.at_unchecked(2, row) * m2.at_unchecked(column, 2)) + (m1.at_unchecked(3, row) * m2.at_unchecked(column, 3));
+		}
+	}
+
+	return result;
+}
+
+static LibMath::Matrix4 scalarMultiplyRaw(LibMath::Matrix4 const& m1, LibMath::Matrix4 const& m2)
+{
+	// same loop as scalarMultiply on the raw column major storage
+	LibMath::Matrix4 result;
+	float const* lhs = m1.data();
+	float const* rhs = m2.data();
+	float* out = result.data();
+
+	for (size_t column = 0; column < 4; ++column)
+	{
+		for (size_t row = 0; row < 4; ++row)
+		{
+			out[column * 4 + row] = (lhs[row] * rhs[column * 4]) + (lhs[4 + row] * rhs[column * 4 + 1]) +
+									(lhs[8 + row] * rhs[column * 4 + 2]) + (lhs[12 + row] * rhs[column * 4 + 3]);
+		}
+	}
+
+	return result;
+}
+
+static LibMath::Matrix4 scalarTranspose(LibMath::Matrix4 const& m)
+{
+	LibMath::Matrix4 result;
+
+	for (size_t column = 0; column < 4; ++column)
+	{
+		for (size_t row = 0; row < 4; ++row)
+		{
+			result[column][row] = m[row][column];
+		}
+	}
+
+	return result;
+}
+
+static LibMath::Matrix4 scalarAdd(LibMath::Matrix4 const& m1, LibMath::Matrix4 const& m2)
+{
+	LibMath::Matrix4 result;
+
+	for (size_t column = 0; column < 4; ++column)
+	{
+		for (size_t row = 0; row < 4; ++row)
+		{
+			result[column][row] = m1[column][row] + m2[column][row];
+		}
+	}
+
+	return result;
+}
+
+static LibMath::Matrix4 adjugateInverse(LibMath::Matrix4 const& m)
+{
+	// previous implementation : determinant and adjugate each expand every 3x3 minor
+	return m.adjugate() * (1.0f / m.determinant());
+}
+
+static std::vector<LibMath::Matrix4> createMatrices(size_t count)
+{
+	std::vector<LibMath::Matrix4> matrices(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float offset = static_cast<float>(i % 97) * 0.01f;
+
+		matrices[i] = LibMath::Matrix4(
+			1.f + offset, 0.5f, 0.f, 0.f,
+			-0.5f, 1.f, offset, 0.f,
+			offset, 0.f, 1.f, 0.f,
+			2.f, -3.f, 4.f + offset, 1.f
+		);
+	}
+
+	return matrices;
+}
+
+TEST_CASE("Matrix4 Kernels", "[.benchmark][matrix][Matrix4]")
+{
+	// skinning like workload : chains of transforms applied to many vertices
+	size_t constexpr count = 10000;
+
+	std::vector<LibMath::Matrix4> matrices = createMatrices(count);
+	std::vector<glm::mat4> matricesGlm(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		for (size_t column = 0; column < 4; ++column)
+		{
+			for (size_t row = 0; row < 4; ++row)
+			{
+				matricesGlm[i][static_cast<glm::length_t>(column)][static_cast<glm::length_t>(row)] = matrices[i][column][row];
+			}
+		}
+	}
+
+	LibMath::Vector4 const vec(1.f, 2.f, 3.f, 1.f);
+	glm::vec4 const vecGlm(1.f, 2.f, 3.f, 1.f);
+
+	BENCHMARK("Matrix4 * Vector4 - scalar checked")
+	{
+		LibMath::Vector4 sum;
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			sum = sum + scalarMultiply(matrix, vec);
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 * Vector4 - LibMath")
+	{
+		LibMath::Vector4 sum;
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			sum = sum + matrix * vec;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 * Vector4 - glm")
+	{
+		glm::vec4 sum{ 0.f };
+		for (glm::mat4 const& matrix : matricesGlm)
+		{
+			sum += matrix * vecGlm;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 * Matrix4 - scalar checked")
+	{
+		LibMath::Matrix4 product = LibMath::Matrix4::identity();
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			product = scalarMultiply(matrix, product);
+		}
+		return product;
+	};
+
+	// in release builds "unchecked" and "raw" should match, "checked" keeps its range checks
+	BENCHMARK("Matrix4 * Matrix4 - scalar unchecked")
+	{
+		LibMath::Matrix4 product = LibMath::Matrix4::identity();
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			product = scalarMultiplyUnchecked(matrix, product);
+		}
+		return product;
+	};
+
+	BENCHMARK("Matrix4 * Matrix4 - scalar raw")
+	{
+		LibMath::Matrix4 product = LibMath::Matrix4::identity();
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			product = scalarMultiplyRaw(matrix, product);
+		}
+		return product;
+	};
+
+	BENCHMARK("Matrix4 * Matrix4 - LibMath")
+	{
+		LibMath::Matrix4 product = LibMath::Matrix4::identity();
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			product = matrix * product;
+		}
+		return product;
+	};
+
+	BENCHMARK("Matrix4 * Matrix4 - glm")
+	{
+		glm::mat4 product{ 1.f };
+		for (glm::mat4 const& matrix : matricesGlm)
+		{
+			product = matrix * product;
+		}
+		return product;
+	};
+
+	BENCHMARK("Matrix4 transpose - scalar checked")
+	{
+		LibMath::Matrix4 sum;
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			sum = scalarAdd(sum, scalarTranspose(matrix));
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 transpose - LibMath")
+	{
+		LibMath::Matrix4 sum;
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			sum = sum + matrix.transpose();
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 inverse - adjugate")
+	{
+		LibMath::Matrix4 sum;
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			sum = sum + adjugateInverse(matrix);
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 inverse - LibMath")
+	{
+		LibMath::Matrix4 sum;
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			sum = sum + matrix.inverse();
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 inverse affine - LibMath")
+	{
+		LibMath::Matrix4 sum;
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			sum = sum + matrix.inverseAffine();
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 inverse rigid - LibMath")
+	{
+		LibMath::Matrix4 sum;
+		for (LibMath::Matrix4 const& matrix : matrices)
+		{
+			sum = sum + matrix.inverseRigid();
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 inverse - glm")
+	{
+		glm::mat4 sum{ 0.f };
+		for (glm::mat4 const& matrix : matricesGlm)
+		{
+			sum += glm::inverse(matrix);
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("Matrix4 Vertex Transform", "[.benchmark][matrix][Matrix4]")
+{
+	// vertices per second = vertex count / mean time of the benchmark
+	size_t constexpr count = 100000;
+
+	std::vector<LibMath::Vector3> vertices(count);
+	std::vector<LibMath::Vector3> transformed(count);
+	std::vector<glm::vec3> verticesGlm(count);
+	std::vector<glm::vec3> transformedGlm(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float offset = static_cast<float>(i % 97) * 0.01f;
+
+		vertices[i] = LibMath::Vector3(offset, 1.f - offset, -2.f - offset);
+		verticesGlm[i] = glm::vec3(offset, 1.f - offset, -2.f - offset);
+	}
+
+	LibMath::Matrix4 const transform = createMatrices(1)[0];
+	glm::mat4 transformGlm;
+
+	for (size_t column = 0; column < 4; ++column)
+	{
+		for (size_t row = 0; row < 4; ++row)
+		{
+			transformGlm[static_cast<glm::length_t>(column)][static_cast<glm::length_t>(row)] = transform[column][row];
+		}
+	}
+
+	BENCHMARK("100000 points - Matrix4 * Vector4")
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			transformed[i] = transform * LibMath::Vector4(vertices[i], 1.f);
+		}
+		return transformed.back();
+	};
+
+	BENCHMARK("100000 points - transformPoints")
+	{
+		transform.transformPoints(vertices, transformed);
+		return transformed.back();
+	};
+
+	BENCHMARK("100000 points homogenized - transformPoints")
+	{
+		transform.transformPoints(vertices, transformed, true);
+		return transformed.back();
+	};
+
+	BENCHMARK("100000 directions - transformDirections")
+	{
+		transform.transformDirections(vertices, transformed);
+		return transformed.back();
+	};
+
+	BENCHMARK("100000 points - glm")
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			transformedGlm[i] = glm::vec3(transformGlm * glm::vec4(verticesGlm[i], 1.f));
+		}
+		return transformedGlm.back();
+	};
+}
+
+TEST_CASE("Matrix4 Decompose", "[.benchmark][matrix][Matrix4]")
+{
+	// scene graph like workload : recover the local TRS of every node from its matrix
+	size_t constexpr count = 10000;
+
+	std::vector<LibMath::Matrix4> transforms(count);
+	std::vector<glm::mat4> transformsGlm(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float offset = static_cast<float>(i % 97) * 0.01f;
+
+		transforms[i] = LibMath::Matrix4::createTransform(LibMath::Vector3(offset, 2.f, -offset), LibMath::Radian(offset * 3.f), LibMath::Vector3(1.f + offset, 2.f, 0.5f));
+
+		for (size_t column = 0; column < 4; ++column)
+		{
+			for (size_t row = 0; row < 4; ++row)
+			{
+				transformsGlm[i][static_cast<glm::length_t>(column)][static_cast<glm::length_t>(row)] = transforms[i][column][row];
+			}
+		}
+	}
+
+	BENCHMARK("Matrix4 decompose - LibMath")
+	{
+		float sum = 0.f;
+		for (LibMath::Matrix4 const& transform : transforms)
+		{
+			LibMath::Vector3 translation;
+			LibMath::Quaternion rotation;
+			LibMath::Vector3 scale;
+			transform.decompose(translation, rotation, scale);
+
+			sum += translation.m_x + rotation.m_w + scale.m_y;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Matrix4 decompose - glm")
+	{
+		float sum = 0.f;
+		for (glm::mat4 const& transform : transformsGlm)
+		{
+			glm::vec3 translation;
+			glm::quat rotation;
+			glm::vec3 scale;
+			glm::vec3 skew;
+			glm::vec4 perspective;
+			glm::decompose(transform, scale, rotation, translation, skew, perspective);
+
+			sum += translation.x + rotation.w + scale.y;
+		}
+		return sum;
+	};
+}
@@ -0,0 +1,264 @@
+#include <span>
+#include <string>
+#include <vector>
+
+#include <glm/gtc/quaternion.hpp>
+#include <glm/mat3x3.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include "LibMath/Angle/Radian.h"
+#include "LibMath/Matrix/Matrix3.h"
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Vector/Vector3.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Quaternion Operations", "[.benchmark][quaternion][Quaternion]")
+{
+	// animation like workload : blend two poses per joint, then rotate the joint offsets
+	size_t constexpr count = 10000;
+
+	std::vector<LibMath::Quaternion> starts;
+	std::vector<LibMath::Quaternion> ends;
+	std::vector<LibMath::Vector3> offsets;
+	std::vector<glm::quat> startsGlm;
+	std::vector<glm::quat> endsGlm;
+	std::vector<glm::vec3> offsetsGlm;
+
+	starts.reserve(count);
+	ends.reserve(count);
+	offsets.reserve(count);
+	startsGlm.reserve(count);
+	endsGlm.reserve(count);
+	offsetsGlm.reserve(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float angle = static_cast<float>(i % 101) * 0.03f;
+		LibMath::Vector3 axis(0.f, 1.f, 0.f);
+		LibMath::Vector3 otherAxis(1.f, 0.f, 0.f);
+
+		starts.emplace_back(LibMath::Radian(angle), axis);
+		ends.emplace_back(LibMath::Radian(angle + 1.f), otherAxis);
+		offsets.emplace_back(angle, 1.f, 0.5f);
+
+		startsGlm.push_back(glm::angleAxis(angle, glm::vec3(0.f, 1.f, 0.f)));
+		endsGlm.push_back(glm::angleAxis(angle + 1.f, glm::vec3(1.f, 0.f, 0.f)));
+		offsetsGlm.emplace_back(angle, 1.f, 0.5f);
+	}
+
+	float constexpr t = 0.35f;
+
+	BENCHMARK("Quaternion slerp - LibMath")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += LibMath::Quaternion::slerp(starts[i], ends[i], t).m_w;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Quaternion slerp - glm")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += glm::slerp(startsGlm[i], endsGlm[i], t).w;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Quaternion nlerp - LibMath")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += LibMath::Quaternion::nlerp(starts[i], ends[i], t).m_w;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Quaternion * Quaternion - LibMath")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += (starts[i] * ends[i]).m_w;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Quaternion * Quaternion - glm")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += (startsGlm[i] * endsGlm[i]).w;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Quaternion rotate - LibMath")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += starts[i].rotate(offsets[i]).m_x;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Quaternion rotate span - LibMath")
+	{
+		// one bone rotating all its vertices
+		starts[0].rotate(std::span<LibMath::Vector3>(offsets));
+		return offsets[count / 2].m_x;
+	};
+
+	BENCHMARK("Quaternion rotate - glm")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += (startsGlm[i] * offsetsGlm[i]).x;
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("Bone Blending", "[.benchmark][quaternion][Quaternion]")
+{
+	// 50 characters of 200 bones blending two animation poses
+	// the bone count is part of the benchmark names, divide it by the mean time to get the blends per second
+	size_t constexpr count = 50 * 200;
+
+	std::vector<LibMath::Quaternion> poseA;
+	std::vector<LibMath::Quaternion> poseB;
+	std::vector<float> weights;
+	std::vector<LibMath::Quaternion> blended(count);
+	std::vector<glm::quat> poseAGlm;
+	std::vector<glm::quat> poseBGlm;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float angle = static_cast<float>(i % 101) * 0.03f;
+
+		poseA.emplace_back(LibMath::Radian(angle), LibMath::Vector3(0.f, 1.f, 0.f));
+		poseB.emplace_back(LibMath::Radian(angle + 0.8f), LibMath::Vector3(1.f, 0.f, 0.f));
+		weights.push_back(static_cast<float>(i % 7) / 6.f);
+
+		poseAGlm.push_back(glm::angleAxis(angle, glm::vec3(0.f, 1.f, 0.f)));
+		poseBGlm.push_back(glm::angleAxis(angle + 0.8f, glm::vec3(1.f, 0.f, 0.f)));
+	}
+
+	std::string const bones = std::to_string(count) + " bones";
+
+	BENCHMARK("Blend " + bones + " - slerp")
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			blended[i] = LibMath::Quaternion::slerp(poseA[i], poseB[i], weights[i]);
+		}
+		return blended.back().m_w;
+	};
+
+	BENCHMARK("Blend " + bones + " - slerpFast")
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			blended[i] = LibMath::Quaternion::slerpFast(poseA[i], poseB[i], weights[i]);
+		}
+		return blended.back().m_w;
+	};
+
+	BENCHMARK("Blend " + bones + " - slerp span")
+	{
+		LibMath::Quaternion::slerp(poseA, poseB, weights, blended);
+		return blended.back().m_w;
+	};
+
+	BENCHMARK("Blend " + bones + " - nlerp span")
+	{
+		LibMath::Quaternion::nlerp(poseA, poseB, weights, blended);
+		return blended.back().m_w;
+	};
+
+	BENCHMARK("Blend " + bones + " - glm slerp")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += glm::slerp(poseAGlm[i], poseBGlm[i], weights[i]).w;
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("Quaternion Matrix Conversion", "[.benchmark][quaternion][Quaternion]")
+{
+	size_t constexpr count = 10000;
+
+	std::vector<LibMath::Quaternion> rotations;
+	std::vector<LibMath::Matrix4> matrices;
+	std::vector<glm::quat> rotationsGlm;
+	std::vector<glm::mat4> matricesGlm;
+
+	LibMath::Vector3 axis(1.f, 2.f, -3.f);
+	axis.normalize();
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		// the whole circle, every branch of Shepperd's method is taken
+		float angle = static_cast<float>(i % 101) * 0.0622f;
+
+		rotations.emplace_back(LibMath::Radian(angle), axis);
+		matrices.push_back(rotations.back().toMatrix4());
+
+		rotationsGlm.push_back(glm::angleAxis(angle, glm::vec3(axis.m_x, axis.m_y, axis.m_z)));
+		matricesGlm.push_back(glm::mat4_cast(rotationsGlm.back()));
+	}
+
+	BENCHMARK("Quaternion toMatrix4 - LibMath")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += rotations[i].toMatrix4()[1][2];
+		}
+		return sum;
+	};
+
+	BENCHMARK("Quaternion toMatrix4 - glm")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += glm::mat4_cast(rotationsGlm[i])[1][2];
+		}
+		return sum;
+	};
+
+	BENCHMARK("Quaternion fromMatrix - LibMath")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += LibMath::Quaternion::fromMatrix(matrices[i]).m_w;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Quaternion fromMatrix - glm")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += glm::quat_cast(matricesGlm[i]).w;
+		}
+		return sum;
+	};
+}
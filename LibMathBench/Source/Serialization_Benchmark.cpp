@@ -0,0 +1,83 @@
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "LibMath/Quaternion.h"
+#include "LibMath/Serialization.h"
+#include "LibMath/Vector/Vector3.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace LibMath::Serialization;
+
+TEST_CASE("Binary Serialization", "[.benchmark][serialization]")
+{
+	// network snapshot like workload : a position and a rotation per entity
+	// the payload size is part of the benchmark names, divide it by the mean time to get the throughput in MB/s
+	size_t constexpr count = 10000;
+
+	std::vector<LibMath::Vector3> positions;
+	std::vector<LibMath::Quaternion> rotations;
+	for (size_t i = 0; i < count; ++i)
+	{
+		float offset = static_cast<float>(i % 101) * 0.37f;
+
+		positions.emplace_back(offset, -1.f / (1.f + offset), offset * 10.f);
+		rotations.emplace_back(LibMath::Radian(offset), LibMath::Vector3(offset, 1.f, -0.5f));
+	}
+
+	std::vector<std::byte> full;
+	std::vector<std::byte> quantized;
+	{
+		BinaryWriter fullWriter(full);
+		fullWriter.writeArray<LibMath::Vector3>(positions);
+		fullWriter.writeArray<LibMath::Quaternion>(rotations);
+
+		BinaryWriter quantizedWriter(quantized, Precision::Quantized);
+		quantizedWriter.writeArray<LibMath::Vector3>(positions);
+		quantizedWriter.writeArray<LibMath::Quaternion>(rotations);
+	}
+
+	std::string const fullPayload = std::to_string(full.size() / 1024) + " KB";
+	std::string const quantizedPayload = std::to_string(quantized.size() / 1024) + " KB";
+
+	std::vector<std::byte> buffer;
+	buffer.reserve(full.size());
+	std::vector<LibMath::Vector3> positionsRead;
+	std::vector<LibMath::Quaternion> rotationsRead;
+
+	BENCHMARK("Write " + fullPayload + " - Full")
+	{
+		buffer.clear();
+		BinaryWriter writer(buffer);
+		writer.writeArray<LibMath::Vector3>(positions);
+		writer.writeArray<LibMath::Quaternion>(rotations);
+		return writer.size();
+	};
+
+	BENCHMARK("Write " + quantizedPayload + " - Quantized")
+	{
+		buffer.clear();
+		BinaryWriter writer(buffer, Precision::Quantized);
+		writer.writeArray<LibMath::Vector3>(positions);
+		writer.writeArray<LibMath::Quaternion>(rotations);
+		return writer.size();
+	};
+
+	BENCHMARK("Read " + fullPayload + " - Full")
+	{
+		BinaryReader reader(full);
+		reader.readArray(positionsRead);
+		reader.readArray(rotationsRead);
+		return positionsRead.back().m_x + rotationsRead.back().m_w;
+	};
+
+	BENCHMARK("Read " + quantizedPayload + " - Quantized")
+	{
+		BinaryReader reader(quantized, Precision::Quantized);
+		reader.readArray(positionsRead);
+		reader.readArray(rotationsRead);
+		return positionsRead.back().m_x + rotationsRead.back().m_w;
+	};
+}
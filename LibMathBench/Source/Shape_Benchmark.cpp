@@ -0,0 +1,147 @@
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "LibMath/Angle/Radian.h"
+#include "LibMath/GeometricObject3.h"
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/ShapeStorage.h"
+#include "LibMath/Vector/Vector3.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace LibMath::Geometry3D;
+
+namespace
+{
+	// the former layout : a vptr in front of every shape, each one allocated on its own
+	struct VirtualShape
+	{
+		virtual			~VirtualShape() = default;
+		virtual void	update(LibMath::Matrix4 const& transMat) = 0;
+		virtual float	minX(void) const = 0;
+	};
+
+	struct VirtualSphere : VirtualShape
+	{
+		explicit		VirtualSphere(Sphere const& sphere) : m_sphere(sphere) {}
+		void			update(LibMath::Matrix4 const& transMat) override { m_sphere.update(transMat); }
+		float			minX(void) const override { return m_sphere.m_center.m_x - m_sphere.m_radius; }
+
+		Sphere			m_sphere;
+	};
+
+	struct VirtualCapsule : VirtualShape
+	{
+		explicit		VirtualCapsule(Capsule const& capsule) : m_capsule(capsule) {}
+		void			update(LibMath::Matrix4 const& transMat) override { m_capsule.update(transMat); }
+		float			minX(void) const override
+		{
+			AABB bounds = getBoundingAABB(m_capsule);
+			return bounds.m_center.m_x - bounds.extentX();
+		}
+
+		Capsule			m_capsule;
+	};
+}
+
+TEST_CASE("Shape Storage", "[.benchmark][shape][ShapeStorage]")
+{
+	// half spheres, half capsules, interleaved like objects created in any order
+	// the shape count and the sizes are part of the benchmark names
+	size_t constexpr count = 10000;
+
+	std::vector<std::unique_ptr<VirtualShape>> virtualShapes;
+	std::vector<Shape> variantShapes;
+	ShapeStorage storage;
+
+	virtualShapes.reserve(count);
+	variantShapes.reserve(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float offset = static_cast<float>(i % 101);
+
+		if (i % 2 == 0)
+		{
+			Sphere sphere(Point(offset, 1.f, -offset), 0.5f);
+			virtualShapes.push_back(std::make_unique<VirtualSphere>(sphere));
+			variantShapes.push_back(sphere);
+			storage.add(sphere);
+		}
+		else
+		{
+			Capsule capsule(Point(offset, 0.f, 0.f), Point(offset, 2.f, 0.f), 0.25f);
+			virtualShapes.push_back(std::make_unique<VirtualCapsule>(capsule));
+			variantShapes.push_back(capsule);
+			storage.add(capsule);
+		}
+	}
+
+	// close to the identity so the shapes do not drift away over the iterations
+	LibMath::Matrix4 const transform = LibMath::Matrix4::createTransform(LibMath::Vector3(1e-6f, 0.f, 0.f), LibMath::Radian(1e-6f), LibMath::Vector3::one());
+
+	std::string const shapes = std::to_string(count) + " shapes";
+
+	BENCHMARK("Update " + shapes + " - virtual (Sphere " + std::to_string(sizeof(VirtualSphere)) + " bytes + heap)")
+	{
+		for (std::unique_ptr<VirtualShape>& shape : virtualShapes)
+		{
+			shape->update(transform);
+		}
+		return virtualShapes.back()->minX();
+	};
+
+	BENCHMARK("Update " + shapes + " - std::variant (" + std::to_string(sizeof(Shape)) + " bytes)")
+	{
+		for (Shape& shape : variantShapes)
+		{
+			update(shape, transform);
+		}
+		return getBoundingAABB(variantShapes.back()).m_center.m_x;
+	};
+
+	BENCHMARK("Update " + shapes + " - ShapeStorage (Sphere " + std::to_string(sizeof(Sphere)) + " bytes)")
+	{
+		storage.update(transform);
+		return storage.getAll<Sphere>().back().m_center.m_x;
+	};
+
+	BENCHMARK("Bounds " + shapes + " - virtual")
+	{
+		float minX = 0.f;
+		for (std::unique_ptr<VirtualShape> const& shape : virtualShapes)
+		{
+			minX += shape->minX();
+		}
+		return minX;
+	};
+
+	BENCHMARK("Bounds " + shapes + " - std::variant")
+	{
+		float minX = 0.f;
+		for (Shape const& shape : variantShapes)
+		{
+			AABB bounds = getBoundingAABB(shape);
+			minX += bounds.m_center.m_x - bounds.extentX();
+		}
+		return minX;
+	};
+
+	BENCHMARK("Bounds " + shapes + " - ShapeStorage")
+	{
+		float minX = 0.f;
+		for (Sphere const& sphere : storage.getAll<Sphere>())
+		{
+			minX += sphere.m_center.m_x - sphere.m_radius;
+		}
+		for (Capsule const& capsule : storage.getAll<Capsule>())
+		{
+			AABB bounds = getBoundingAABB(capsule);
+			minX += bounds.m_center.m_x - bounds.extentX();
+		}
+		return minX;
+	};
+}
@@ -0,0 +1,192 @@
+#include <string>
+#include <vector>
+
+#include "LibMath/Angle/Radian.h"
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Transform.h"
+#include "LibMath/TransformHierarchy.h"
+#include "LibMath/Vector/Vector3.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Transform Hierarchy", "[.benchmark][transform][Transform]")
+{
+	// scene graph like workload : nodes sorted parent first, world = parent world * local
+	// per node the Matrix4 path costs 64 multiplies and 48 adds, the Transform one about 40 multiplies and 30 adds
+	// the node count is part of the benchmark names, divide it by the mean time to get the nodes per second
+	size_t constexpr count = 10000;
+
+	std::vector<int> parents(count);
+	std::vector<LibMath::Transform> locals(count);
+	std::vector<LibMath::Matrix4> localMatrices(count);
+	std::vector<LibMath::Transform> worlds(count);
+	std::vector<LibMath::Matrix4> worldMatrices(count);
+
+	LibMath::Vector3 axis(1.f, 2.f, -3.f);
+	axis.normalize();
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float offset = static_cast<float>(i % 97) * 0.01f;
+
+		// 8 children per node, the root is its own parent with an identity world
+		parents[i] = static_cast<int>(i / 8);
+		locals[i] = LibMath::Transform(LibMath::Vector3(offset, 1.f, -offset), LibMath::Quaternion(LibMath::Radian(offset), axis), LibMath::Vector3(1.f + offset * 0.1f));
+		localMatrices[i] = locals[i].toMatrix();
+	}
+
+	std::string const nodes = std::to_string(count) + " nodes";
+
+	BENCHMARK("Propagate " + nodes + " - Matrix4")
+	{
+		worldMatrices[0] = localMatrices[0];
+		for (size_t i = 1; i < count; ++i)
+		{
+			worldMatrices[i] = worldMatrices[parents[i]] * localMatrices[i];
+		}
+		return worldMatrices.back().data()[12];
+	};
+
+	BENCHMARK("Propagate " + nodes + " - Matrix4 built from TRS")
+	{
+		// the local matrix is rebuilt from its components like after an animation update
+		worldMatrices[0] = localMatrices[0];
+		for (size_t i = 1; i < count; ++i)
+		{
+			LibMath::Matrix4 local = LibMath::Matrix4::createTranslate(locals[i].m_translation) * locals[i].m_rotation.toMatrix4() * LibMath::Matrix4::createScale(locals[i].m_scale);
+			worldMatrices[i] = worldMatrices[parents[i]] * local;
+		}
+		return worldMatrices.back().data()[12];
+	};
+
+	BENCHMARK("Propagate " + nodes + " - Transform")
+	{
+		worlds[0] = locals[0];
+		for (size_t i = 1; i < count; ++i)
+		{
+			worlds[i] = worlds[parents[i]] * locals[i];
+		}
+		return worlds.back().m_translation.m_x;
+	};
+
+	BENCHMARK("Propagate " + nodes + " - Transform then toMatrix")
+	{
+		// the matrices are only needed for rendering
+		worlds[0] = locals[0];
+		for (size_t i = 1; i < count; ++i)
+		{
+			worlds[i] = worlds[parents[i]] * locals[i];
+			worldMatrices[i] = worlds[i].toMatrix();
+		}
+		return worldMatrices.back().data()[12];
+	};
+
+	BENCHMARK("Invert " + nodes + " - Matrix4 inverse")
+	{
+		float sum = 0.f;
+		for (LibMath::Matrix4 const& local : localMatrices)
+		{
+			sum += local.inverse().data()[12];
+		}
+		return sum;
+	};
+
+	BENCHMARK("Invert " + nodes + " - Matrix4 inverseAffine")
+	{
+		float sum = 0.f;
+		for (LibMath::Matrix4 const& local : localMatrices)
+		{
+			sum += local.inverseAffine().data()[12];
+		}
+		return sum;
+	};
+
+	BENCHMARK("Invert " + nodes + " - Transform")
+	{
+		float sum = 0.f;
+		for (LibMath::Transform const& local : locals)
+		{
+			sum += local.inverse().m_translation.m_x;
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("Transform Hierarchy Update", "[.benchmark][transform][TransformHierarchy]")
+{
+	// 1000 characters of 100 nodes, 1% of the nodes move every frame
+	// each benchmark is a frame : set the moved locals, then bring every world matrix up to date
+	int constexpr rootCount = 1000;
+	int constexpr nodesPerRoot = 100;
+	int constexpr movedPerFrame = rootCount * nodesPerRoot / 100;
+
+	LibMath::TransformHierarchy hierarchy;
+	hierarchy.reserve(rootCount * nodesPerRoot);
+
+	std::vector<int> parents;
+	std::vector<LibMath::Matrix4> locals;
+	std::vector<LibMath::Matrix4> worlds(rootCount * nodesPerRoot);
+
+	for (int root = 0; root < rootCount; ++root)
+	{
+		int first = static_cast<int>(locals.size());
+
+		for (int i = 0; i < nodesPerRoot; ++i)
+		{
+			float offset = static_cast<float>(i % 13) * 0.1f;
+			LibMath::Matrix4 local = LibMath::Matrix4::createTransform(LibMath::Vector3(offset, 1.f, -offset), LibMath::Radian(offset), LibMath::Vector3(1.f));
+
+			// a few chains and branches, every parent comes before its children
+			int parent = i == 0 ? LibMath::TransformHierarchy::noParent : first + (i - 1) / 3;
+
+			parents.push_back(parent);
+			locals.push_back(local);
+			hierarchy.addNode(local, parent);
+		}
+	}
+	hierarchy.update();
+
+	LibMath::Matrix4 const moved = LibMath::Matrix4::createTranslate(LibMath::Vector3(0.f, 0.1f, 0.f));
+	int frame = 0;
+
+	BENCHMARK("100000 nodes, 1% moving - recompute every node")
+	{
+		++frame;
+		for (int i = 0; i < movedPerFrame; ++i)
+		{
+			locals[(i * 97 + frame) % locals.size()] = moved;
+		}
+
+		for (size_t i = 0; i < locals.size(); ++i)
+		{
+			worlds[i] = parents[i] == LibMath::TransformHierarchy::noParent ? locals[i] : worlds[parents[i]] * locals[i];
+		}
+		return worlds.back().data()[12];
+	};
+
+	BENCHMARK("100000 nodes, 1% moving - update")
+	{
+		++frame;
+		for (int i = 0; i < movedPerFrame; ++i)
+		{
+			hierarchy.setLocal((i * 97 + frame) % static_cast<int>(hierarchy.size()), moved);
+		}
+
+		hierarchy.update();
+		return hierarchy.getWorld(0).data()[12];
+	};
+
+	BENCHMARK("100000 nodes, 1% moving - updateParallel")
+	{
+		++frame;
+		for (int i = 0; i < movedPerFrame; ++i)
+		{
+			hierarchy.setLocal((i * 97 + frame) % static_cast<int>(hierarchy.size()), moved);
+		}
+
+		hierarchy.updateParallel();
+		return hierarchy.getWorld(0).data()[12];
+	};
+}
@@ -0,0 +1,117 @@
+#include <vector>
+
+#include <glm/trigonometric.hpp>
+
+#include "LibMath/Angle/Radian.h"
+#include "LibMath/Trigonometry.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Sin Cos", "[.benchmark][trigonometry]")
+{
+	// rotation like workload : sin and cos of the same angle, as rotateX or a 2D rotation matrix need
+	size_t constexpr count = 10000;
+
+	std::vector<LibMath::Radian> angles;
+	std::vector<float> anglesGlm;
+	std::vector<float> sins(count);
+	std::vector<float> coss(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float angle = (static_cast<float>(i % 101) / 100.f * 2.f - 1.f) * 4.f;
+
+		angles.emplace_back(angle);
+		anglesGlm.push_back(angle);
+	}
+
+	BENCHMARK("sin and cos - LibMath")
+	{
+		float sum = 0.f;
+		for (LibMath::Radian const& angle : angles)
+		{
+			sum += LibMath::sin(angle) + LibMath::cos(angle);
+		}
+		return sum;
+	};
+
+	BENCHMARK("sincos - LibMath")
+	{
+		float sum = 0.f;
+		for (LibMath::Radian const& angle : angles)
+		{
+			LibMath::SinCos result = LibMath::sincos(angle);
+			sum += result.m_sin + result.m_cos;
+		}
+		return sum;
+	};
+
+	BENCHMARK("sincosFast - LibMath")
+	{
+		float sum = 0.f;
+		for (LibMath::Radian const& angle : angles)
+		{
+			LibMath::SinCos result = LibMath::sincosFast(angle);
+			sum += result.m_sin + result.m_cos;
+		}
+		return sum;
+	};
+
+	BENCHMARK("sincos array - LibMath")
+	{
+		LibMath::sincos(angles, sins, coss);
+		return sins[count / 2] + coss[count / 2];
+	};
+
+	BENCHMARK("sin and cos - glm")
+	{
+		float sum = 0.f;
+		for (float angle : anglesGlm)
+		{
+			sum += glm::sin(angle) + glm::cos(angle);
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("Atan", "[.benchmark][trigonometry]")
+{
+	size_t constexpr count = 10000;
+
+	std::vector<float> values;
+	for (size_t i = 0; i < count; ++i)
+	{
+		values.push_back((static_cast<float>(i % 101) / 100.f * 2.f - 1.f) * 10.f);
+	}
+
+	BENCHMARK("atan2 - LibMath")
+	{
+		float sum = 0.f;
+		for (size_t i = 1; i < count; ++i)
+		{
+			sum += LibMath::atan(values[i], values[i - 1]).raw();
+		}
+		return sum;
+	};
+
+	BENCHMARK("atanFast atan2 - LibMath")
+	{
+		float sum = 0.f;
+		for (size_t i = 1; i < count; ++i)
+		{
+			sum += LibMath::atanFast(values[i], values[i - 1]).raw();
+		}
+		return sum;
+	};
+
+	BENCHMARK("atan2 - glm")
+	{
+		float sum = 0.f;
+		for (size_t i = 1; i < count; ++i)
+		{
+			sum += glm::atan(values[i], values[i - 1]);
+		}
+		return sum;
+	};
+}
@@ -0,0 +1,221 @@
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <glm/vec3.hpp>
+#include <glm/geometric.hpp>
+
+#include "LibMath/Vector/Vector3.h"
+#include "LibMath/Vector/Vector3Batch.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+/*
+* Calls through volatile function pointers cannot be inlined,
+* which is what every vector operation cost when it was defined in Vector.cpp
+*/
+static float (LibMath::Vector3::* volatile opaqueDot)(LibMath::Vector3 const&) const = &LibMath::Vector3::dot;
+static LibMath::Vector3(* volatile opaqueAdd)(LibMath::Vector3, LibMath::Vector3 const&) = &LibMath::operator+;
+static LibMath::Vector3(* volatile opaqueScale)(LibMath::Vector3, float) = &LibMath::operator*;
+
+TEST_CASE("Vector3 Operations", "[.benchmark][vector][Vector3]")
+{
+	// physics step like workload : integrate velocities then sum kinetic energy and plane distances
+	size_t constexpr count = 10000;
+	float constexpr deltaTime = 1.f / 60.f;
+
+	std::vector<LibMath::Vector3> positions(count);
+	std::vector<LibMath::Vector3> velocities(count);
+	std::vector<glm::vec3> positionsGlm(count);
+	std::vector<glm::vec3> velocitiesGlm(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float offset = static_cast<float>(i % 101) * 0.01f;
+
+		positions[i] = LibMath::Vector3(offset, 1.f - offset, 2.f * offset);
+		velocities[i] = LibMath::Vector3(1.f, -offset, 0.5f);
+		positionsGlm[i] = glm::vec3(offset, 1.f - offset, 2.f * offset);
+		velocitiesGlm[i] = glm::vec3(1.f, -offset, 0.5f);
+	}
+
+	LibMath::Vector3 const normal = LibMath::Vector3::up();
+	glm::vec3 const normalGlm(0.f, 1.f, 0.f);
+
+	BENCHMARK("Vector3 dot loop - out of line")
+	{
+		float energy = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			LibMath::Vector3 position = opaqueAdd(positions[i], opaqueScale(velocities[i], deltaTime));
+			energy += (velocities[i].*opaqueDot)(velocities[i]) + (position.*opaqueDot)(normal);
+		}
+		return energy;
+	};
+
+	BENCHMARK("Vector3 dot loop - LibMath")
+	{
+		float energy = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			LibMath::Vector3 position = positions[i] + velocities[i] * deltaTime;
+			energy += velocities[i].dot(velocities[i]) + position.dot(normal);
+		}
+		return energy;
+	};
+
+	BENCHMARK("Vector3 dot loop - glm")
+	{
+		float energy = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			glm::vec3 position = positionsGlm[i] + velocitiesGlm[i] * deltaTime;
+			energy += glm::dot(velocitiesGlm[i], velocitiesGlm[i]) + glm::dot(position, normalGlm);
+		}
+		return energy;
+	};
+}
+
+TEST_CASE("Vector3Batch Operations", "[.benchmark][vector][Vector3Batch]")
+{
+	// particle system like workload : integrate, then normalize the directions and project them on a plane normal
+	size_t constexpr count = 10000;
+	float constexpr deltaTime = 1.f / 60.f;
+
+	std::vector<LibMath::Vector3> positions(count);
+	std::vector<LibMath::Vector3> velocities(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		float offset = static_cast<float>(i % 101) * 0.01f;
+
+		positions[i] = LibMath::Vector3(offset, 1.f - offset, 2.f * offset);
+		velocities[i] = LibMath::Vector3(1.f, -offset, 0.5f);
+	}
+
+	LibMath::Vector3Batch positionsBatch(positions);
+	LibMath::Vector3Batch velocitiesBatch(velocities);
+	LibMath::Vector3Batch normalsBatch(std::vector<LibMath::Vector3>(count, LibMath::Vector3::up()));
+	LibMath::Vector3Batch scratch;
+	std::vector<float> projections(count);
+
+	LibMath::Vector3 const normal = LibMath::Vector3::up();
+
+	BENCHMARK("Particles - std::vector<Vector3>")
+	{
+		float sum = 0.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			LibMath::Vector3 direction = positions[i] + velocities[i] * deltaTime;
+			direction.normalize();
+			sum += direction.dot(normal);
+		}
+		return sum;
+	};
+
+	BENCHMARK("Particles - Vector3Batch")
+	{
+		LibMath::Vector3Batch::scale(velocitiesBatch, deltaTime, scratch);
+		LibMath::Vector3Batch::add(positionsBatch, scratch, scratch);
+		LibMath::Vector3Batch::normalize(scratch);
+		LibMath::Vector3Batch::dot(scratch, normalsBatch, projections);
+
+		float sum = 0.f;
+		for (float projection : projections)
+		{
+			sum += projection;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Load and store - Vector3Batch")
+	{
+		positionsBatch.load(positions);
+		positionsBatch.store(positions);
+		return positionsBatch.size();
+	};
+}
+
+TEST_CASE("Vector3 Serialization", "[.benchmark][vector][Vector3][serialization]")
+{
+	// replay dump like workload : write every position as text, then read them back
+	// the payload size is part of the benchmark names, divide it by the mean time to get the throughput in MB/s
+	size_t constexpr count = 10000;
+
+	std::vector<LibMath::Vector3> positions;
+	for (size_t i = 0; i < count; ++i)
+	{
+		float offset = static_cast<float>(i % 101) * 0.37f;
+
+		positions.emplace_back(offset, -1.f / (1.f + offset), offset * 1000.f);
+	}
+
+	std::string text(count * LibMath::Vector3::c_maxChars, '\0');
+	char* last = text.data() + text.size();
+	{
+		char* end = text.data();
+		for (LibMath::Vector3 const& position : positions)
+		{
+			end = LibMath::toChars(end, last, position).ptr;
+		}
+		text.resize(end - text.data());
+	}
+
+	std::string const payload = std::to_string(text.size() / 1024) + " KB";
+
+	std::string buffer(count * LibMath::Vector3::c_maxChars, '\0');
+	std::vector<LibMath::Vector3> readBack(count);
+
+	BENCHMARK("Write " + payload + " - std::stringstream")
+	{
+		std::stringstream stream;
+		for (LibMath::Vector3 const& position : positions)
+		{
+			stream << position;
+		}
+		return stream.tellp();
+	};
+
+	BENCHMARK("Write " + payload + " - Vector3::string")
+	{
+		size_t size = 0;
+		for (LibMath::Vector3 const& position : positions)
+		{
+			size += position.string().size();
+		}
+		return size;
+	};
+
+	BENCHMARK("Write " + payload + " - toChars")
+	{
+		char* end = buffer.data();
+		char* bufferLast = buffer.data() + buffer.size();
+		for (LibMath::Vector3 const& position : positions)
+		{
+			end = LibMath::toChars(end, bufferLast, position).ptr;
+		}
+		return end - buffer.data();
+	};
+
+	BENCHMARK("Read " + payload + " - std::stringstream")
+	{
+		std::stringstream stream(text);
+		for (LibMath::Vector3& position : readBack)
+		{
+			stream >> position;
+		}
+		return readBack.back().m_x;
+	};
+
+	BENCHMARK("Read " + payload + " - fromChars")
+	{
+		char const* current = text.data();
+		char const* textLast = text.data() + text.size();
+		for (LibMath::Vector3& position : readBack)
+		{
+			current = LibMath::fromChars(current, textLast, position).ptr;
+		}
+		return readBack.back().m_x;
+	};
+}
@@ -1,4 +1,7 @@
-﻿#include <LibMath/Angle.h>
+﻿#include <vector>
+
+#include <LibMath/Angle.h>
+#include <LibMath/Arithmetic.h>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -366,4 +369,92 @@ TEST_CASE("Radian", "[.all][angle]")
 		auto wrapped = 7_rad;
 		CHECK(wrapped.radian(true) == Catch::Approx(7.f - glm::two_pi<float>()));
 	}
-}
\ No newline at end of file
+}
+
+TEST_CASE("Wrap", "[.all][angle][wrap]")
+{
+	using namespace LibMath;
+
+	SECTION("Range Contract")
+	{
+		CHECK(wrap(180.f, -180.f, 180.f) == -180.f);
+		CHECK(wrap(-180.f, -180.f, 180.f) == -180.f);
+		CHECK(wrap(540.f, -180.f, 180.f) == -180.f);
+		CHECK(wrap(-900.f, -180.f, 180.f) == -180.f);
+		CHECK(wrap(1080.f, 0.f, 360.f) == 0.f);
+		CHECK(wrap(-1.f, 0.f, 360.f) == 359.f);
+
+		// one range away keeps the exact result of a single step
+		CHECK(wrap(370.f, 0.f, 360.f) == 10.f);
+		CHECK(wrap(radianCircle + 0.5f, 0.f, radianCircle) == (radianCircle + 0.5f) - radianCircle);
+
+		// range not starting at 0
+		CHECK(wrap(125.f, 100.f, 110.f) == Catch::Approx(105.f));
+		CHECK(wrap(-5.f, 100.f, 110.f) == Catch::Approx(105.f));
+	}
+
+	SECTION("Large Values")
+	{
+		// hours of a spinning wheel, the wrap used to step one turn at a time
+		float turns = 100000.f * 360.f;
+
+		float wrapped = wrap(turns + 90.f, -180.f, 180.f);
+		CHECK(wrapped == Catch::Approx(90.f).margin(4.f));
+		CHECK(wrapped >= -180.f);
+		CHECK(wrapped < 180.f);
+
+		CHECK(wrap(-1.e30f, 0.f, 360.f) >= 0.f);
+		CHECK(wrap(-1.e30f, 0.f, 360.f) < 360.f);
+		CHECK(wrap(1.e30f, -180.f, 180.f) >= -180.f);
+		CHECK(wrap(1.e30f, -180.f, 180.f) < 180.f);
+
+		Radian accumulated{ 1.2f + 1000.f * radianCircle };
+		CHECK(accumulated.radian(true) == Catch::Approx(1.2f).margin(1e-3f));
+
+		accumulated.wrap(false);
+		CHECK(accumulated.raw() == Catch::Approx(1.2f).margin(1e-3f));
+
+		Degree degree{ -5000.f * 360.f - 45.f };
+		CHECK(degree.degree(false) == Catch::Approx(315.f).margin(1e-2f));
+		CHECK(degree.degree(true) == Catch::Approx(-45.f).margin(1e-2f));
+	}
+
+	SECTION("Array")
+	{
+		// 37 values so the vectorized loop leaves a scalar tail
+		std::vector<float> angles;
+		for (int i = 0; i < 37; ++i)
+		{
+			angles.push_back(static_cast<float>(i * i * (i % 2 == 0 ? 1 : -1)) * 17.3f);
+		}
+		angles[0] = 180.f;
+		angles[1] = -180.f;
+
+		std::vector<float> wrapped = angles;
+		wrap(wrapped, -180.f, 180.f);
+
+		for (size_t i = 0; i < angles.size(); ++i)
+		{
+			CHECK(wrapped[i] >= -180.f);
+			CHECK(wrapped[i] < 180.f);
+			CHECK(wrapped[i] == wrap(angles[i], -180.f, 180.f));
+		}
+
+		// far values take the reduction of every range at once, it must round like the single value wrap
+		std::vector<float> far;
+		for (int i = 0; i < 1003; ++i)
+		{
+			far.push_back(static_cast<float>(i % 2 == 0 ? 1 : -1) * 1.e5f * (1.f + static_cast<float>(i) * 0.0137f));
+		}
+
+		std::vector<float> farWrapped = far;
+		wrap(farWrapped, -radianCircle * 0.5f, radianCircle * 0.5f);
+
+		for (size_t i = 0; i < far.size(); ++i)
+		{
+			CHECK(farWrapped[i] == wrap(far[i], -radianCircle * 0.5f, radianCircle * 0.5f));
+		}
+
+		wrap(std::span<float>(), -180.f, 180.f);
+	}
+}
@@ -0,0 +1,496 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "LibMath/Collisions.h"
+#include "LibMath/ConvexCollisions.h"
+#include "LibMath/GeometricObject3.h"
+#include "LibMath/Intersection.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Vector/Vector3.h"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace LibMath::Geometry3D;
+using LibMath::Vector3;
+
+namespace Collision = LibMath::Collisions3D;
+
+#define CHECK_VECTOR3(vector, x, y, z, epsilon) \
+	CHECK(vector.m_x == Catch::Approx(x).margin(epsilon)); \
+	CHECK(vector.m_y == Catch::Approx(y).margin(epsilon)); \
+	CHECK(vector.m_z == Catch::Approx(z).margin(epsilon))
+
+namespace
+{
+	// Largest gap between the projections of 2 boxes on the 15 axes of the separating axis test, a lower bound of their distance
+	float getSeparatingGap(OBB const& obb1, OBB const& obb2)
+	{
+		Vector3 axes1[3];
+		Vector3 axes2[3];
+		obb1.getAxes(axes1[0], axes1[1], axes1[2]);
+		obb2.getAxes(axes2[0], axes2[1], axes2[2]);
+
+		float const halfSize1[3] = { obb1.m_width * 0.5f, obb1.m_height * 0.5f, obb1.m_depth * 0.5f };
+		float const halfSize2[3] = { obb2.m_width * 0.5f, obb2.m_height * 0.5f, obb2.m_depth * 0.5f };
+		Vector3 offset = obb2.m_center.toVector3() - obb1.m_center.toVector3();
+
+		float gap = -std::numeric_limits<float>::infinity();
+		auto project = [&](Vector3 axis)
+		{
+			float length = axis.magnitude();
+			if (length < 1e-4f)
+			{
+				return;
+			}
+
+			axis = axis / length;
+
+			float reach = 0.f;
+			for (int i = 0; i < 3; ++i)
+			{
+				reach += halfSize1[i] * std::abs(axes1[i].dot(axis)) + halfSize2[i] * std::abs(axes2[i].dot(axis));
+			}
+
+			gap = std::max(gap, std::abs(offset.dot(axis)) - reach);
+		};
+
+		for (int i = 0; i < 3; ++i)
+		{
+			project(axes1[i]);
+			project(axes2[i]);
+
+			for (int j = 0; j < 3; ++j)
+			{
+				project(axes1[i].cross(axes2[j]));
+			}
+		}
+
+		return gap;
+	}
+}
+
+TEST_CASE("Support Point", "[.all][Collision3D][gjk]")
+{
+	Vector3 const direction(1.f, -2.f, 0.5f);
+
+	SECTION("Shapes")
+	{
+		CHECK_VECTOR3(getSupportPoint(Point(1.f, 2.f, 3.f), direction), 1.f, 2.f, 3.f, 1e-6);
+		CHECK_VECTOR3(getSupportPoint(Line(Point(0.f, 0.f, 0.f), Point(0.f, -4.f, 0.f)), direction), 0.f, -4.f, 0.f, 1e-6);
+		CHECK_VECTOR3(getSupportPoint(AABB(Point(1.f, 1.f, 1.f), 2.f, 4.f, 6.f), direction), 2.f, -1.f, 4.f, 1e-6);
+		CHECK_VECTOR3(getSupportPoint(Sphere(Point(1.f, 0.f, 0.f), 3.f), Vector3(0.f, 0.f, -2.f)), 1.f, 0.f, -3.f, 1e-6);
+		CHECK_VECTOR3(getSupportPoint(Capsule(Point(0.f, 0.f, 0.f), Point(0.f, 2.f, 0.f), 0.5f), Vector3(0.f, 1.f, 0.f)), 0.f, 2.5f, 0.f, 1e-6);
+
+		// Quarter turn around Z : the 2 x 4 box is 4 wide on X
+		OBB obb(Point(0.f, 0.f, 0.f), 2.f, 4.f, 6.f, LibMath::Radian(std::acos(0.f)));
+		CHECK_VECTOR3(getSupportPoint(obb, direction), 2.f, -1.f, 3.f, 1e-5);
+	}
+
+	SECTION("Convex Hull")
+	{
+		ConvexHull hull({ Point(0.f, 0.f, 0.f), Point(1.f, 0.f, 0.f), Point(0.f, 1.f, 0.f), Point(0.f, 0.f, 1.f), Point(0.1f, 0.1f, 0.1f) });
+
+		CHECK_VECTOR3(getSupportPoint(hull, Vector3(0.f, 1.f, 0.2f)), 0.f, 1.f, 0.f, 1e-6);
+		CHECK_VECTOR3(getSupportPoint(hull, Vector3(-1.f, -1.f, -1.f)), 0.f, 0.f, 0.f, 1e-6);
+
+		AABB bounds = getBoundingAABB(hull);
+		CHECK(bounds.m_center.m_x == Catch::Approx(0.5f));
+		CHECK(bounds.extentZ() == Catch::Approx(0.5f));
+
+		CHECK_THROWS_AS(getSupportPoint(ConvexHull(), direction), std::invalid_argument);
+		CHECK_THROWS_AS(getBoundingAABB(ConvexHull()), std::invalid_argument);
+	}
+}
+
+TEST_CASE("GJK", "[.all][Collision3D][gjk]")
+{
+	std::mt19937 generator(3);
+	std::uniform_real_distribution<float> position(-3.f, 3.f);
+	std::uniform_real_distribution<float> size(0.2f, 2.f);
+	std::uniform_real_distribution<float> component(-1.f, 1.f);
+
+	auto randomPoint = [&]()
+	{
+		return Point(position(generator), position(generator), position(generator));
+	};
+
+	auto randomOBB = [&]()
+	{
+		LibMath::Quaternion rotation(component(generator), component(generator), component(generator), component(generator));
+		rotation.normalize();
+
+		return OBB(randomPoint(), size(generator), size(generator), size(generator), rotation);
+	};
+
+	SECTION("Same answer as the specialised tests")
+	{
+		int mismatches = 0;
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			Sphere sphere1(randomPoint(), size(generator));
+			Sphere sphere2(randomPoint(), size(generator));
+			mismatches += Collision::checkCollisionConvex(sphere1, sphere2) != Collision::checkCollisionSphereSphere(sphere1, sphere2);
+
+			AABB aabb1(randomPoint(), size(generator), size(generator), size(generator));
+			AABB aabb2(randomPoint(), size(generator), size(generator), size(generator));
+			mismatches += Collision::checkCollisionConvex(aabb1, aabb2) != Collision::checkCollisionAABBAABB(aabb1, aabb2);
+
+			OBB obb1 = randomOBB();
+			OBB obb2 = randomOBB();
+			mismatches += Collision::checkCollisionConvex(obb1, obb2) != Collision::checkCollisionOBBOBB(obb1, obb2);
+			mismatches += Collision::checkCollisionConvex(obb1, sphere1) != Collision::checkCollisionOBBSphere(obb1, sphere1);
+			mismatches += Collision::checkCollisionConvex(obb1, aabb1) != Collision::checkCollisionOBBAABB(obb1, aabb1);
+		}
+
+		CHECK(mismatches == 0);
+	}
+
+	SECTION("Distance")
+	{
+		Sphere sphere1(Point(0.f, 0.f, 0.f), 1.f);
+		Sphere sphere2(Point(3.f, 4.f, 0.f), 2.f);
+
+		Collision::ConvexDistance distance = Collision::getDistanceConvex(sphere1, sphere2);
+		CHECK(distance.m_distance == Catch::Approx(2.f).epsilon(1e-3));
+		CHECK_VECTOR3(distance.m_pointA, 0.6f, 0.8f, 0.f, 1e-2);
+		CHECK_VECTOR3(distance.m_pointB, 1.8f, 2.4f, 0.f, 1e-2);
+
+		// Face of a box against the edge of a turned one
+		AABB box(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f);
+		OBB diamond(Point(4.f, 0.f, 0.f), 2.f, 2.f, 2.f, LibMath::Radian(std::acos(0.f) * 0.5f));
+
+		distance = Collision::getDistanceConvex(box, diamond);
+		CHECK(distance.m_distance == Catch::Approx(3.f - std::sqrt(2.f)).epsilon(1e-4));
+		CHECK(distance.m_pointA.m_x == Catch::Approx(1.f));
+		CHECK(distance.m_pointB.m_x == Catch::Approx(4.f - std::sqrt(2.f)));
+
+		// Segment above the apex of a tetrahedron
+		ConvexHull tetrahedron({ Point(0.f, 0.f, 0.f), Point(1.f, 0.f, 0.f), Point(0.f, 1.f, 0.f), Point(0.f, 0.f, 1.f) });
+		Line segment(Point(-1.f, -1.f, 2.f), Point(2.f, 2.f, 2.f));
+
+		distance = Collision::getDistanceConvex(tetrahedron, segment);
+		CHECK(distance.m_distance == Catch::Approx(1.f).epsilon(1e-4));
+		CHECK_VECTOR3(distance.m_pointA, 0.f, 0.f, 1.f, 1e-4);
+
+		CHECK(Collision::getDistanceConvex(sphere1, Sphere(Point(1.f, 1.f, 0.f), 1.f)).m_distance == 0.f);
+	}
+
+	SECTION("Boxes close to each other")
+	{
+		// Nearly flat simplices, a rounding error must not turn them into a containing tetrahedron
+		std::uniform_real_distribution<float> near(0.f, 1.5f);
+
+		int separated = 0;
+		int mismatches = 0;
+		int tooClose = 0;
+
+		for (int i = 0; i < 20000; ++i)
+		{
+			OBB obb1 = randomOBB();
+			OBB obb2 = randomOBB();
+			obb1.m_center = Point(near(generator), near(generator), near(generator));
+			obb2.m_center = Point(near(generator), near(generator), near(generator)) + Vector3(1.5f, 0.f, 0.f);
+
+			float gap = getSeparatingGap(obb1, obb2);
+			if (std::abs(gap) < 1e-3f)
+			{
+				continue;
+			}
+
+			mismatches += Collision::checkCollisionConvex(obb1, obb2) != Collision::checkCollisionOBBOBB(obb1, obb2);
+
+			if (gap > 0.f)
+			{
+				++separated;
+				tooClose += Collision::getDistanceConvex(obb1, obb2).m_distance < gap - 1e-4f;
+			}
+		}
+
+		CHECK(separated > 1000);
+		CHECK(mismatches == 0);
+		CHECK(tooClose == 0);
+
+		// Pairs an almost flat tetrahedron once reported as touching
+		using LibMath::Quaternion;
+		std::pair<OBB, OBB> const pairs[] =
+		{
+			{ OBB(Point(3.78817201f, 3.6586957f, 1.48278046f), 2.73162675f, 2.30526257f, 0.603623629f, Quaternion(-0.0527094901f, 0.69972074f, 0.671490133f, 0.238146171f)),
+				OBB(Point(1.66258681f, 2.91504002f, 2.53488898f), 0.683022261f, 2.43314385f, 2.75629544f, Quaternion(0.328870952f, 0.033213567f, 0.617775261f, 0.713508546f)) },
+			{ OBB(Point(0.765784383f, 2.39741373f, 2.21401453f), 1.97232473f, 2.15328193f, 1.47755539f, Quaternion(-0.487378806f, 0.54610765f, -0.22731021f, -0.642307103f)),
+				OBB(Point(3.18581557f, 2.98874736f, 2.54338098f), 2.31725931f, 0.948310673f, 2.18404078f, Quaternion(-0.723783135f, -0.14839448f, -0.620507836f, 0.262844592f)) },
+			{ OBB(Point(1.10901296f, 0.0933173075f, 1.70614004f), 2.91570497f, 2.43736315f, 2.48114085f, Quaternion(0.339495987f, -0.183053449f, -0.483036816f, -0.786072135f)),
+				OBB(Point(3.01537776f, 1.92119312f, 2.98995376f), 1.72208333f, 1.8747443f, 0.579811215f, Quaternion(-0.241247207f, -0.703580618f, -0.640125453f, -0.192388847f)) },
+		};
+
+		for (auto const& [obb1, obb2] : pairs)
+		{
+			float gap = getSeparatingGap(obb1, obb2);
+			REQUIRE(gap > 1e-3f);
+
+			CHECK_FALSE(Collision::checkCollisionConvex(obb1, obb2));
+			CHECK(Collision::getDistanceConvex(obb1, obb2).m_distance >= gap - 1e-4f);
+		}
+	}
+
+	SECTION("Warm start")
+	{
+		Capsule capsule(Point(0.f, 0.f, 0.f), Point(0.f, 2.f, 0.f), 0.5f);
+		OBB obb = randomOBB();
+		obb.m_center = Point(3.f, 1.f, 0.f);
+
+		Collision::GjkCache cache;
+		Collision::ConvexDistance cold = Collision::getDistanceConvex(capsule, obb, &cache);
+		CHECK(cache.m_count > 0);
+
+		// A small step, the replayed simplex is close to the answer
+		obb.m_center.m_x -= 0.01f;
+
+		Collision::ConvexDistance warm = Collision::getDistanceConvex(capsule, obb, &cache);
+		Collision::ConvexDistance reference = Collision::getDistanceConvex(capsule, obb);
+
+		CHECK(warm.m_distance == Catch::Approx(reference.m_distance).epsilon(1e-4));
+		CHECK(warm.m_iterations <= cold.m_iterations);
+		CHECK(warm.m_iterations <= 2);
+	}
+}
+
+TEST_CASE("EPA", "[.all][Collision3D][gjk]")
+{
+	Collision::Penetration penetration;
+
+	SECTION("Separated")
+	{
+		CHECK_FALSE(Collision::getPenetrationConvex(Sphere(Point(0.f, 0.f, 0.f), 1.f), Sphere(Point(3.f, 0.f, 0.f), 1.f), penetration));
+	}
+
+	SECTION("Boxes")
+	{
+		AABB box1(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f);
+		AABB box2(Point(1.7f, 0.2f, -0.1f), 2.f, 2.f, 2.f);
+
+		REQUIRE(Collision::getPenetrationConvex(box1, box2, penetration));
+		CHECK(penetration.m_depth == Catch::Approx(0.3f).epsilon(1e-4));
+		CHECK_VECTOR3(penetration.m_normal, 1.f, 0.f, 0.f, 1e-5);
+		CHECK(penetration.m_pointA.m_x == Catch::Approx(1.f));
+		CHECK(penetration.m_pointB.m_x == Catch::Approx(0.7f));
+	}
+
+	SECTION("Spheres")
+	{
+		Sphere sphere1(Point(0.f, 0.f, 0.f), 1.f);
+		Sphere sphere2(Point(0.f, 1.5f, 0.f), 1.f);
+
+		// Exact : only the centers go through GJK, the radii are added back
+		REQUIRE(Collision::getPenetrationConvex(sphere1, sphere2, penetration));
+		CHECK(penetration.m_depth == Catch::Approx(0.5f).margin(1e-5));
+		CHECK_VECTOR3(penetration.m_normal, 0.f, 1.f, 0.f, 1e-5);
+		CHECK(penetration.m_pointA.m_y == Catch::Approx(1.f).margin(1e-5));
+		CHECK(penetration.m_pointB.m_y == Catch::Approx(0.5f).margin(1e-5));
+
+		// Same center, any normal, the depth is the sum of the radii
+		REQUIRE(Collision::getPenetrationConvex(sphere1, sphere1, penetration));
+		CHECK(penetration.m_depth == Catch::Approx(2.f).margin(1e-5));
+		CHECK(penetration.m_normal.magnitude() == Catch::Approx(1.f));
+
+		// Capsules through each other, the cores cross : EPA on the segments then the radii
+		Capsule capsule1(Point(-1.f, 0.f, 0.f), Point(1.f, 0.f, 0.f), 0.5f);
+		Capsule capsule2(Point(0.f, 0.f, -1.f), Point(0.f, 0.f, 1.f), 0.5f);
+
+		REQUIRE(Collision::getPenetrationConvex(capsule1, capsule2, penetration));
+		CHECK(penetration.m_depth == Catch::Approx(1.f).margin(1e-5));
+		CHECK(std::abs(penetration.m_normal.m_y) == Catch::Approx(1.f).margin(1e-5));
+	}
+
+	SECTION("Capsule into a hull")
+	{
+		ConvexHull floor({ Point(-5.f, -1.f, -5.f), Point(5.f, -1.f, -5.f), Point(-5.f, -1.f, 5.f), Point(5.f, -1.f, 5.f),
+			Point(-5.f, 0.f, -5.f), Point(5.f, 0.f, -5.f), Point(-5.f, 0.f, 5.f), Point(5.f, 0.f, 5.f) });
+		Capsule capsule(Point(0.f, 0.3f, 0.f), Point(1.f, 0.3f, 0.f), 0.5f);
+
+		REQUIRE(Collision::getPenetrationConvex(floor, capsule, penetration));
+		CHECK(penetration.m_depth == Catch::Approx(0.2f).margin(1e-3));
+		CHECK_VECTOR3(penetration.m_normal, 0.f, 1.f, 0.f, 1e-3);
+
+		// Moving B along the normal by the depth leaves the shapes touching
+		Capsule moved(Point(0.f, 0.3f + penetration.m_depth, 0.f), Point(1.f, 0.3f + penetration.m_depth, 0.f), 0.5f);
+		CHECK(Collision::getDistanceConvex(floor, moved).m_distance < 1e-3f);
+	}
+
+	SECTION("Random boxes")
+	{
+		// Pushed out by the depth along the normal, B touches A and a bit more separates them
+		std::mt19937 generator(11);
+		std::uniform_real_distribution<float> position(-1.f, 1.f);
+		std::uniform_real_distribution<float> size(0.5f, 2.f);
+
+		int tested = 0;
+		int wrong = 0;
+
+		for (int i = 0; i < 500; ++i)
+		{
+			LibMath::Quaternion rotation(position(generator), position(generator), position(generator), position(generator));
+			rotation.normalize();
+
+			OBB obb1(Point(0.f, 0.f, 0.f), size(generator), size(generator), size(generator), LibMath::Quaternion::identity());
+			OBB obb2(Point(position(generator), position(generator), position(generator)), size(generator), size(generator), size(generator), rotation);
+
+			if (!Collision::getPenetrationConvex(obb1, obb2, penetration))
+			{
+				continue;
+			}
+
+			++tested;
+
+			OBB touching = obb2;
+			touching.m_center = touching.m_center.toVector3() + penetration.m_normal * (penetration.m_depth - 1e-3f);
+
+			OBB separated = obb2;
+			separated.m_center = separated.m_center.toVector3() + penetration.m_normal * (penetration.m_depth + 1e-3f);
+
+			wrong += !Collision::checkCollisionOBBOBB(obb1, touching) || Collision::checkCollisionOBBOBB(obb1, separated);
+		}
+
+		CHECK(tested > 100);
+		CHECK(wrong == 0);
+	}
+}
+
+TEST_CASE("Time Of Impact", "[.all][Collision3D][gjk]")
+{
+	float time = -1.f;
+
+	SECTION("Head on")
+	{
+		Sphere bullet(Point(-5.f, 0.f, 0.f), 0.5f);
+		OBB wall(Point(0.f, 0.f, 0.f), 0.1f, 4.f, 4.f, LibMath::Quaternion::identity());
+
+		REQUIRE(Collision::getTimeOfImpactConvex(bullet, Vector3(20.f, 0.f, 0.f), wall, Vector3(0.f, 0.f, 0.f), time));
+		CHECK(time == Catch::Approx(4.45f / 20.f).margin(1e-4f));
+
+		// Both moving, only the relative velocity matters
+		REQUIRE(Collision::getTimeOfImpactConvex(bullet, Vector3(10.f, 0.f, 0.f), wall, Vector3(-10.f, 0.f, 0.f), time));
+		CHECK(time == Catch::Approx(4.45f / 20.f).margin(1e-4f));
+
+		// Already touching
+		REQUIRE(Collision::getTimeOfImpactConvex(Sphere(Point(0.5f, 0.f, 0.f), 0.5f), Vector3(1.f, 0.f, 0.f), wall, Vector3(0.f, 0.f, 0.f), time));
+		CHECK(time == 0.f);
+	}
+
+	SECTION("Misses")
+	{
+		Sphere bullet(Point(-5.f, 0.f, 0.f), 0.5f);
+		OBB wall(Point(0.f, 0.f, 0.f), 0.1f, 4.f, 4.f, LibMath::Quaternion::identity());
+		time = -1.f;
+
+		// Too short, moving away, passing by
+		CHECK_FALSE(Collision::getTimeOfImpactConvex(bullet, Vector3(4.f, 0.f, 0.f), wall, Vector3(0.f, 0.f, 0.f), time));
+		CHECK_FALSE(Collision::getTimeOfImpactConvex(bullet, Vector3(-4.f, 0.f, 0.f), wall, Vector3(0.f, 0.f, 0.f), time));
+		CHECK_FALSE(Collision::getTimeOfImpactConvex(Sphere(Point(-5.f, 3.f, 0.f), 0.5f), Vector3(20.f, 0.f, 0.f), wall, Vector3(0.f, 0.f, 0.f), time));
+		CHECK(time == -1.f);
+
+		// A zero tolerance is never reached against a turned box, the advancement does not converge and is not a hit
+		Sphere grazing(Point(-3.f, 0.9f, 0.f), 0.5f);
+		OBB turned(Point(0.f, 0.f, 0.f), 1.f, 1.f, 1.f, LibMath::Quaternion(LibMath::Radian(0.3f), Vector3(1.f, 1.f, 0.f)));
+
+		CHECK_FALSE(Collision::getTimeOfImpactConvex(grazing, Vector3(6.f, 0.f, 0.f), turned, Vector3(0.f, 0.f, 0.f), time, 0.f));
+		CHECK(time == -1.f);
+	}
+
+	SECTION("Still and apart")
+	{
+		// Turned boxes close to each other that do not move never meet, whatever GJK goes through to find their distance
+		std::mt19937 generator(21);
+		std::uniform_real_distribution<float> near(0.f, 1.5f);
+		std::uniform_real_distribution<float> size(0.2f, 2.f);
+		std::uniform_real_distribution<float> component(-1.f, 1.f);
+
+		auto randomOBB = [&](float offset)
+		{
+			LibMath::Quaternion rotation(component(generator), component(generator), component(generator), component(generator));
+			rotation.normalize();
+
+			return OBB(Point(near(generator) + offset, near(generator), near(generator)), size(generator), size(generator), size(generator), rotation);
+		};
+
+		Vector3 const still(0.f, 0.f, 0.f);
+		float constexpr tolerance = 1e-3f;
+		int tested = 0;
+		int impacts = 0;
+		time = -1.f;
+
+		for (int i = 0; i < 5000; ++i)
+		{
+			OBB obb1 = randomOBB(0.f);
+			OBB obb2 = randomOBB(1.5f);
+
+			if (getSeparatingGap(obb1, obb2) <= tolerance * 2.f)
+			{
+				continue;
+			}
+
+			++tested;
+			impacts += Collision::getTimeOfImpactConvex(obb1, still, obb2, still, time, tolerance);
+		}
+
+		CHECK(tested > 1000);
+		CHECK(impacts == 0);
+		CHECK(time == -1.f);
+	}
+
+	SECTION("Same time as the sweeps")
+	{
+		std::mt19937 generator(9);
+		std::uniform_real_distribution<float> position(-3.f, 3.f);
+		std::uniform_real_distribution<float> size(0.2f, 2.f);
+
+		auto randomPoint = [&]()
+		{
+			return Point(position(generator), position(generator), position(generator));
+		};
+
+		Vector3 const still(0.f, 0.f, 0.f);
+		float constexpr tolerance = 1e-3f;
+		int mismatches = 0;
+		int hits = 0;
+
+		for (int i = 0; i < 500; ++i)
+		{
+			Sphere sphere(randomPoint(), size(generator) * 0.5f);
+			Vector3 velocity = Vector3(position(generator), position(generator), position(generator)) * 2.f;
+			AABB box(randomPoint(), size(generator), size(generator), size(generator));
+			Capsule capsule(randomPoint(), randomPoint(), size(generator) * 0.5f);
+
+			LibMath::Intersection3D::SweepHit hit;
+
+			// The sweep gives the exact contact, GJK stops before it with the shapes within the tolerance
+			auto agrees = [&](bool swept, bool advanced, Collision::ConvexShape const& target)
+			{
+				if (swept != advanced)
+				{
+					return false;
+				}
+
+				return !swept || (time <= hit.m_time + 1e-5f &&
+					Collision::getDistanceConvex(Collision::ConvexShape(sphere).translated(velocity * time), target).m_distance <= tolerance * 1.01f);
+			};
+
+			bool swept = LibMath::Intersection3D::sweep(sphere, velocity, box, hit);
+			mismatches += !agrees(swept, Collision::getTimeOfImpactConvex(sphere, velocity, box, still, time, tolerance), box);
+			hits += swept;
+
+			swept = LibMath::Intersection3D::sweep(sphere, velocity, capsule, hit);
+			mismatches += !agrees(swept, Collision::getTimeOfImpactConvex(sphere, velocity, capsule, still, time, tolerance), capsule);
+			hits += swept;
+		}
+
+		CHECK(mismatches == 0);
+		CHECK(hits > 50);
+	}
+}
@@ -3,6 +3,11 @@
 #include "LibMath/GeometricObject2.h"
 #include "LibMath/Collisions.h"
 
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -814,4 +819,148 @@ TEST_CASE("OBB2D Collisions", "[.all][Collision2D][Circle2D]")
 		LibMath::Geometry2D::Point point3(10.0f, 10.0f);
 		CHECK_FALSE(LibMath::Collision2D::checkCollisionCirclePoint(circle, point3));
 	}
+
+	SECTION("Collision with OBB2") {
+		// 4 wide and 2 high, turned by a quarter it is 2 wide and 4 high
+		LibMath::Geometry2D::OBB box(LibMath::Geometry2D::Point(0.0f, 0.0f), 2.0f, 4.0f);
+		LibMath::Geometry2D::OBB turned(LibMath::Geometry2D::Point(0.0f, 0.0f), 2.0f, 4.0f);
+		turned.rotate(LibMath::Radian(static_cast<float>(M_PI) / 2.f));
+
+		LibMath::Geometry2D::Circle circle(LibMath::Geometry2D::Point(3.0f, 0.0f), 1.5f);
+		CHECK(LibMath::Collision2D::checkCollisionCircleOBB(circle, box));
+		CHECK_FALSE(LibMath::Collision2D::checkCollisionCircleOBB(circle, turned));
+
+		// Touching the corner
+		LibMath::Geometry2D::Circle corner(LibMath::Geometry2D::Point(5.0f, 5.0f), 5.0f);
+		CHECK(LibMath::Collision2D::checkCollisionCircleOBB(corner, box));
+	}
+
+	SECTION("Manifold with OBB2") {
+		LibMath::Geometry2D::OBB box(LibMath::Geometry2D::Point(0.0f, 0.0f), 2.0f, 4.0f);
+		LibMath::Collision2D::Manifold manifold;
+
+		// Outside, the normal goes from the circle toward the box
+		REQUIRE(LibMath::Collision2D::getManifoldCircleOBB(LibMath::Geometry2D::Circle(LibMath::Geometry2D::Point(3.0f, 0.0f), 1.5f), box, manifold));
+		CHECK(manifold.m_normal.m_x == Catch::Approx(-1.0f));
+		CHECK(manifold.m_normal.m_y == Catch::Approx(0.0f).margin(1e-6f));
+		CHECK(manifold.m_depth == Catch::Approx(0.5f));
+		REQUIRE(manifold.m_pointCount == 1);
+		CHECK(manifold.m_points[0].m_position.m_x == Catch::Approx(1.75f));
+
+		// Center inside, out through the nearest side
+		REQUIRE(LibMath::Collision2D::getManifoldCircleOBB(LibMath::Geometry2D::Circle(LibMath::Geometry2D::Point(1.5f, 0.2f), 0.25f), box, manifold));
+		CHECK(manifold.m_normal.m_x == Catch::Approx(-1.0f));
+		CHECK(manifold.m_depth == Catch::Approx(0.75f));
+
+		// Turned box, the normal turns with it
+		LibMath::Geometry2D::OBB turned(LibMath::Geometry2D::Point(0.0f, 0.0f), 2.0f, 4.0f);
+		turned.rotate(LibMath::Radian(static_cast<float>(M_PI) / 2.f));
+		REQUIRE(LibMath::Collision2D::getManifoldCircleOBB(LibMath::Geometry2D::Circle(LibMath::Geometry2D::Point(0.0f, 2.5f), 1.0f), turned, manifold));
+		CHECK(manifold.m_normal.m_x == Catch::Approx(0.0f).margin(1e-6f));
+		CHECK(manifold.m_normal.m_y == Catch::Approx(-1.0f));
+		CHECK(manifold.m_depth == Catch::Approx(0.5f));
+
+		// A miss leaves the manifold untouched
+		manifold.m_pointCount = -1;
+		CHECK_FALSE(LibMath::Collision2D::getManifoldCircleOBB(LibMath::Geometry2D::Circle(LibMath::Geometry2D::Point(3.0f, 2.0f), 0.5f), box, manifold));
+		CHECK(manifold.m_pointCount == -1);
+	}
+}
+
+TEST_CASE("Sweep And Prune", "[.all][Collision2D][broadPhase]")
+{
+	SECTION("Bounding AABB")
+	{
+		LibMath::Geometry2D::AABB circleBounds = LibMath::Geometry2D::getBoundingAABB(LibMath::Geometry2D::Circle(LibMath::Geometry2D::Point(1.0f, 2.0f), 3.0f));
+		CHECK(circleBounds.extentX() == Catch::Approx(3.0f));
+		CHECK(circleBounds.extentY() == Catch::Approx(3.0f));
+
+		// Quarter turn : width and height are swapped
+		LibMath::Geometry2D::OBB obb(LibMath::Geometry2D::Point(0.0f, 0.0f), 2.0f, 4.0f);
+		obb.rotate(LibMath::Radian(static_cast<float>(M_PI) / 2.0f));
+
+		LibMath::Geometry2D::AABB obbBounds = LibMath::Geometry2D::getBoundingAABB(obb);
+		CHECK(obbBounds.extentX() == Catch::Approx(1.0f));
+		CHECK(obbBounds.extentY() == Catch::Approx(2.0f));
+	}
+
+	SECTION("Pairs")
+	{
+		// Row of circles 1.5 apart with radius 1, each one overlaps its direct neighbours
+		std::vector<LibMath::Geometry2D::Circle> circles;
+		for (int i = 0; i < 50; ++i)
+		{
+			circles.emplace_back(LibMath::Geometry2D::Point(1.5f * static_cast<float>((i * 7) % 50), 0.0f), 1.0f);
+		}
+
+		auto bruteForcePairs = [&](std::vector<int> const& proxies)
+		{
+			std::set<std::pair<int, int>> pairs;
+			for (size_t i = 0; i < circles.size(); ++i)
+			{
+				for (size_t j = i + 1; j < circles.size(); ++j)
+				{
+					if (LibMath::Collision2D::checkCollisionCircleCircle(circles[i], circles[j]))
+					{
+						pairs.emplace(std::min(proxies[i], proxies[j]), std::max(proxies[i], proxies[j]));
+					}
+				}
+			}
+			return pairs;
+		};
+
+		auto confirmedPairs = [&](LibMath::Collision2D::SweepAndPrune& broadPhase, std::vector<int> const& proxies)
+		{
+			std::vector<int> circleOfProxy(circles.size());
+			for (size_t i = 0; i < proxies.size(); ++i)
+			{
+				circleOfProxy[proxies[i]] = static_cast<int>(i);
+			}
+
+			std::vector<std::pair<int, int>> candidates;
+			broadPhase.queryPairs(candidates);
+
+			std::set<std::pair<int, int>> pairs;
+			for (auto [first, second] : candidates)
+			{
+				if (LibMath::Collision2D::checkCollisionCircleCircle(circles[circleOfProxy[first]], circles[circleOfProxy[second]]))
+				{
+					pairs.emplace(first, second);
+				}
+			}
+			return pairs;
+		};
+
+		LibMath::Collision2D::SweepAndPrune broadPhase;
+		std::vector<int> proxies;
+		for (LibMath::Geometry2D::Circle const& circle : circles)
+		{
+			proxies.push_back(broadPhase.insert(LibMath::Geometry2D::getBoundingAABB(circle)));
+		}
+
+		CHECK(broadPhase.size() == circles.size());
+		CHECK(confirmedPairs(broadPhase, proxies) == bruteForcePairs(proxies));
+		CHECK(bruteForcePairs(proxies).size() == 49);
+
+		// Shift every other circle up, they only touch each other now
+		for (size_t i = 0; i < circles.size(); i += 2)
+		{
+			circles[i].m_center.m_y = 10.0f;
+			broadPhase.move(proxies[i], LibMath::Geometry2D::getBoundingAABB(circles[i]));
+		}
+		CHECK(confirmedPairs(broadPhase, proxies) == bruteForcePairs(proxies));
+
+		broadPhase.setAxis(LibMath::Collision2D::SweepAndPrune::Axis::Y);
+		CHECK(broadPhase.getAxis() == LibMath::Collision2D::SweepAndPrune::Axis::Y);
+		CHECK(confirmedPairs(broadPhase, proxies) == bruteForcePairs(proxies));
+
+		broadPhase.remove(proxies[3]);
+		proxies[3] = broadPhase.insert(LibMath::Geometry2D::getBoundingAABB(circles[3]));
+		CHECK(confirmedPairs(broadPhase, proxies) == bruteForcePairs(proxies));
+
+		broadPhase.remove(proxies[0]);
+		CHECK(broadPhase.size() == circles.size() - 1);
+		CHECK_THROWS_AS(broadPhase.remove(proxies[0]), std::out_of_range);
+		CHECK_THROWS_AS(broadPhase.move(100, LibMath::Geometry2D::getBoundingAABB(circles[0])), std::out_of_range);
+	}
 }
@@ -3,6 +3,15 @@
 #include "LibMath/Vector/Vector3.h"
 #include "LibMath/GeometricObject3.h"
 #include "LibMath/Collisions.h"
+#include "LibMath/ShapeStorage.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -227,30 +236,78 @@ TEST_CASE("OBB3D", "[.all][geometricObject3D]")
     const float width = 4.f;
     const float height = 6.f;
     const float depth = 8.f;
-    const LibMath::Radian rotation(1.5f); // 1.5 radians
+    const LibMath::Radian rotation(1.5f); // 1.5 radians around Z
+    const LibMath::Quaternion expected(rotation, LibMath::Vector3(0.f, 0.f, 1.f));
 
     SECTION("Default constructor") 
     {
         OBB obb;
-        REQUIRE(obb.m_rotation.raw() == Catch::Approx(0.f));
+        REQUIRE(obb.m_rotation == LibMath::Quaternion::identity());
     }
 
     SECTION("Parameterized constructor") {
         OBB obb(center, width, height, depth, rotation);
-        REQUIRE(obb.m_rotation.raw() == Catch::Approx(1.5f));
+        REQUIRE(obb.m_rotation == expected);
+
+        OBB obbQuaternion(center, width, height, depth, expected);
+        REQUIRE(obbQuaternion.m_rotation == expected);
     }
 
     SECTION("Copy constructor") {
         OBB original(center, width, height, depth, rotation);
         OBB copy(original);
-        REQUIRE(copy.m_rotation.raw() == Catch::Approx(1.5f));
+        REQUIRE(copy.m_rotation == expected);
     }
 
     SECTION("Assignment operator") {
         OBB obb1(center, width, height, depth, rotation);
         OBB obb2;
         obb2 = obb1;
-        REQUIRE(obb2.m_rotation.raw() == Catch::Approx(1.5f));
+        REQUIRE(obb2.m_rotation == expected);
+    }
+
+    SECTION("Axes") {
+        // Quarter turn around Z : X becomes Y and Y becomes -X
+        OBB obb(center, width, height, depth, LibMath::Radian(static_cast<float>(M_PI) / 2.f));
+
+        LibMath::Vector3 axisX, axisY, axisZ;
+        obb.getAxes(axisX, axisY, axisZ);
+
+        CHECK(axisX.m_x == Catch::Approx(0.f).margin(1e-6));
+        CHECK(axisX.m_y == Catch::Approx(1.f));
+        CHECK(axisY.m_x == Catch::Approx(-1.f));
+        CHECK(axisY.m_y == Catch::Approx(0.f).margin(1e-6));
+        CHECK(axisZ.m_z == Catch::Approx(1.f));
+    }
+
+    SECTION("Update") {
+        // The scale of the matrix only moves the center
+        OBB obb(center, width, height, depth, LibMath::Quaternion::identity());
+        LibMath::Matrix4 transform = LibMath::Matrix4::createRotationX(LibMath::Radian(static_cast<float>(M_PI) / 2.f)) * LibMath::Matrix4::createScale(LibMath::Vector3(2.f, 2.f, 2.f));
+
+        obb.update(transform);
+
+        CHECK(obb.m_center.m_x == Catch::Approx(2.f));
+        CHECK(obb.m_center.m_y == Catch::Approx(-6.f));
+        CHECK(obb.m_center.m_z == Catch::Approx(4.f));
+        CHECK(obb.m_width == width);
+        CHECK(obb.m_rotation.isUnit());
+
+        // Y turns into Z around X
+        LibMath::Vector3 axisX, axisY, axisZ;
+        obb.getAxes(axisX, axisY, axisZ);
+
+        CHECK(axisX.m_x == Catch::Approx(1.f));
+        CHECK(axisY.m_z == Catch::Approx(1.f));
+        CHECK(axisZ.m_y == Catch::Approx(-1.f));
+
+        // A flattened matrix moves the center and keeps the rotation
+        LibMath::Quaternion rotation = obb.m_rotation;
+        obb.update(LibMath::Matrix4::createScale(LibMath::Vector3(1.f, 0.f, 1.f)));
+
+        CHECK(obb.m_center.m_y == 0.f);
+        CHECK(obb.m_rotation.m_x == Catch::Approx(rotation.m_x));
+        CHECK(obb.m_rotation.m_w == Catch::Approx(rotation.m_w));
     }
 }
 
@@ -1558,3 +1615,779 @@ TEST_CASE("AABB Collisions", "[.all][Collision3D][aabb]")
     //    }
     //}
 }
+
+TEST_CASE("OBB Collisions", "[.all][Collision3D][obb]")
+{
+    // 2 x 2 x 2 cube turned by 45 degrees around Z : a corner reaches sqrt(2) on X and Y
+    const LibMath::Radian quarterPi(static_cast<float>(M_PI) / 4.f);
+    const OBB diamond(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f, quarterPi);
+    const OBB cube(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f, LibMath::Quaternion::identity());
+
+    SECTION("OBB-Point")
+    {
+        CHECK(Collision::checkCollisionOBBPoint(diamond, Point(1.3f, 0.f, 0.f)));
+        CHECK_FALSE(Collision::checkCollisionOBBPoint(cube, Point(1.3f, 0.f, 0.f)));
+        CHECK_FALSE(Collision::checkCollisionOBBPoint(diamond, Point(0.9f, 0.9f, 0.f)));
+        CHECK(Collision::checkCollisionOBBPoint(cube, Point(0.9f, 0.9f, 0.f)));
+    }
+
+    SECTION("OBB-Sphere")
+    {
+        CHECK_FALSE(Collision::checkCollisionOBBSphere(diamond, Sphere(Point(2.f, 0.f, 0.f), 0.5f)));
+        CHECK(Collision::checkCollisionOBBSphere(diamond, Sphere(Point(2.f, 0.f, 0.f), 0.6f)));
+        CHECK(Collision::checkCollisionOBBSphere(diamond, Sphere(Point(0.f, 0.f, 0.f), 0.1f)));
+        CHECK_FALSE(Collision::checkCollisionOBBSphere(cube, Sphere(Point(2.f, 2.f, 0.f), 1.f)));
+    }
+
+    SECTION("OBB-Capsule")
+    {
+        CHECK_FALSE(Collision::checkCollisionOBBCapsule(diamond, Capsule(Point(2.f, -1.f, 0.f), Point(2.f, 1.f, 0.f), 0.5f)));
+        CHECK(Collision::checkCollisionOBBCapsule(diamond, Capsule(Point(2.f, -1.f, 0.f), Point(2.f, 1.f, 0.f), 0.7f)));
+        CHECK(Collision::checkCollisionOBBCapsule(cube, Capsule(Point(-3.f, 0.f, 0.f), Point(3.f, 0.f, 0.f), 0.1f)));
+    }
+
+    SECTION("OBB-Line")
+    {
+        CHECK(Collision::checkCollisionOBBLine(diamond, Line(Point(-5.f, 1.2f, 0.f), LibMath::Vector3(1.f, 0.f, 0.f), 10.f)));
+        CHECK_FALSE(Collision::checkCollisionOBBLine(cube, Line(Point(-5.f, 1.2f, 0.f), LibMath::Vector3(1.f, 0.f, 0.f), 10.f)));
+        CHECK_FALSE(Collision::checkCollisionOBBLine(diamond, Line(Point(-5.f, 1.5f, 0.f), LibMath::Vector3(1.f, 0.f, 0.f), 10.f)));
+        CHECK_FALSE(Collision::checkCollisionOBBLine(diamond, Line(Point(-5.f, 0.f, 0.f), LibMath::Vector3(1.f, 0.f, 0.f), 3.f)));
+    }
+
+    SECTION("OBB-AABB")
+    {
+        CHECK(Collision::checkCollisionOBBAABB(diamond, AABB(Point(1.8f, 0.f, 0.f), 1.f, 1.f, 1.f)));
+        CHECK_FALSE(Collision::checkCollisionOBBAABB(cube, AABB(Point(1.8f, 0.f, 0.f), 1.f, 1.f, 1.f)));
+        CHECK_FALSE(Collision::checkCollisionOBBAABB(diamond, AABB(Point(2.2f, 0.f, 0.f), 1.f, 1.f, 1.f)));
+    }
+
+    SECTION("OBB-OBB")
+    {
+        OBB other(Point(2.7f, 0.f, 0.f), 2.f, 2.f, 2.f, quarterPi);
+        CHECK(Collision::checkCollisionOBBOBB(diamond, other));
+
+        other.m_center.m_x = 2.9f;
+        CHECK_FALSE(Collision::checkCollisionOBBOBB(diamond, other));
+
+        OBB aligned(Point(2.3f, 0.f, 0.f), 2.f, 2.f, 2.f, LibMath::Quaternion::identity());
+        CHECK(Collision::checkCollisionOBBOBB(diamond, aligned));
+        CHECK(Collision::checkCollisionOBBOBB(aligned, diamond));
+
+        aligned.m_center.m_x = 2.5f;
+        CHECK_FALSE(Collision::checkCollisionOBBOBB(diamond, aligned));
+        CHECK_FALSE(Collision::checkCollisionOBBOBB(aligned, diamond));
+    }
+
+    SECTION("OBB-OBB against the projected corners")
+    {
+        // Reference : the 8 corners of each box projected on the 15 axes, degenerate edge axes skipped
+        auto corners = [](const OBB& obb)
+        {
+            LibMath::Vector3 axes[3];
+            obb.getAxes(axes[0], axes[1], axes[2]);
+            axes[0] *= obb.m_width * 0.5f;
+            axes[1] *= obb.m_height * 0.5f;
+            axes[2] *= obb.m_depth * 0.5f;
+
+            std::vector<LibMath::Vector3> result;
+            for (int corner = 0; corner < 8; ++corner)
+            {
+                result.push_back(obb.m_center.toVector3() + axes[0] * (corner & 1 ? 1.f : -1.f) + axes[1] * (corner & 2 ? 1.f : -1.f) + axes[2] * (corner & 4 ? 1.f : -1.f));
+            }
+            return result;
+        };
+
+        auto separatedOn = [](const LibMath::Vector3& axis, const std::vector<LibMath::Vector3>& corners1, const std::vector<LibMath::Vector3>& corners2)
+        {
+            float min1 = INFINITY, max1 = -INFINITY, min2 = INFINITY, max2 = -INFINITY;
+            for (int i = 0; i < 8; ++i)
+            {
+                min1 = std::min(min1, corners1[i].dot(axis));
+                max1 = std::max(max1, corners1[i].dot(axis));
+                min2 = std::min(min2, corners2[i].dot(axis));
+                max2 = std::max(max2, corners2[i].dot(axis));
+            }
+            return max1 < min2 || max2 < min1;
+        };
+
+        unsigned int seed = 7;
+        auto random = [&seed](float min, float max)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return min + (max - min) * static_cast<float>(seed >> 8) / 16777216.f;
+        };
+
+        auto randomOBB = [&random]()
+        {
+            LibMath::Quaternion rotation(random(-1.f, 1.f), random(-1.f, 1.f), random(-1.f, 1.f), random(-1.f, 1.f));
+            rotation.normalize();
+
+            return OBB(Point(random(-2.f, 2.f), random(-2.f, 2.f), random(-2.f, 2.f)), random(0.2f, 3.f), random(0.2f, 3.f), random(0.2f, 3.f), rotation);
+        };
+
+        int mismatches = 0;
+        int separatedByEdges = 0;
+
+        for (int pair = 0; pair < 2000; ++pair)
+        {
+            OBB obb1 = randomOBB();
+            OBB obb2 = randomOBB();
+
+            LibMath::Vector3 axes1[3], axes2[3];
+            obb1.getAxes(axes1[0], axes1[1], axes1[2]);
+            obb2.getAxes(axes2[0], axes2[1], axes2[2]);
+
+            std::vector<LibMath::Vector3> corners1 = corners(obb1);
+            std::vector<LibMath::Vector3> corners2 = corners(obb2);
+
+            bool separatedByFaces = false;
+            for (int i = 0; i < 3; ++i)
+            {
+                separatedByFaces |= separatedOn(axes1[i], corners1, corners2) || separatedOn(axes2[i], corners1, corners2);
+            }
+
+            bool separated = separatedByFaces;
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    LibMath::Vector3 axis = axes1[i].cross(axes2[j]);
+                    if (axis.magnitudeSquared() > 1e-8f && separatedOn(axis, corners1, corners2))
+                    {
+                        separatedByEdges += !separated;
+                        separated = true;
+                    }
+                }
+            }
+
+            mismatches += Collision::checkCollisionOBBOBB(obb1, obb2) == separated;
+        }
+
+        CHECK(mismatches == 0);
+
+        // the edge axes are exercised
+        CHECK(separatedByEdges > 0);
+    }
+}
+
+TEST_CASE("Contact Manifolds", "[.all][Collision3D][manifold]")
+{
+    // manifold.m_normal goes from the first shape to the second, moving the second by m_normal * m_depth separates them
+    auto checkVector = [](const LibMath::Vector3& vec, float x, float y, float z)
+    {
+        CHECK(vec.m_x == Catch::Approx(x).margin(1e-5f));
+        CHECK(vec.m_y == Catch::Approx(y).margin(1e-5f));
+        CHECK(vec.m_z == Catch::Approx(z).margin(1e-5f));
+    };
+
+    Collision::Manifold manifold;
+
+    SECTION("Sphere-Sphere")
+    {
+        REQUIRE(Collision::getManifoldSphereSphere(Sphere(Point(0.f, 0.f, 0.f), 1.f), Sphere(Point(1.5f, 0.f, 0.f), 1.f), manifold));
+        checkVector(manifold.m_normal, 1.f, 0.f, 0.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.5f));
+        REQUIRE(manifold.m_pointCount == 1);
+        checkVector(manifold.m_points[0].m_position, 0.75f, 0.f, 0.f);
+        CHECK(manifold.m_points[0].m_depth == Catch::Approx(0.5f));
+
+        // same centers, any unit normal
+        REQUIRE(Collision::getManifoldSphereSphere(Sphere(Point(1.f, 1.f, 1.f), 1.f), Sphere(Point(1.f, 1.f, 1.f), 0.5f), manifold));
+        CHECK(manifold.m_normal.magnitude() == Catch::Approx(1.f));
+        CHECK(manifold.m_depth == Catch::Approx(1.5f));
+
+        // a miss leaves the manifold untouched
+        manifold.m_pointCount = -1;
+        CHECK_FALSE(Collision::getManifoldSphereSphere(Sphere(Point(0.f, 0.f, 0.f), 1.f), Sphere(Point(2.5f, 0.f, 0.f), 1.f), manifold));
+        CHECK(manifold.m_pointCount == -1);
+    }
+
+    SECTION("Sphere-Capsule")
+    {
+        const Capsule capsule(Point(-2.f, 0.f, 0.f), Point(2.f, 0.f, 0.f), 1.f);
+
+        REQUIRE(Collision::getManifoldSphereCapsule(Sphere(Point(0.f, 1.5f, 0.f), 1.f), capsule, manifold));
+        checkVector(manifold.m_normal, 0.f, -1.f, 0.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.5f));
+        REQUIRE(manifold.m_pointCount == 1);
+        checkVector(manifold.m_points[0].m_position, 0.f, 0.75f, 0.f);
+
+        // on the end cap
+        REQUIRE(Collision::getManifoldSphereCapsule(Sphere(Point(3.5f, 0.f, 0.f), 1.f), capsule, manifold));
+        checkVector(manifold.m_normal, -1.f, 0.f, 0.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.5f));
+
+        CHECK_FALSE(Collision::getManifoldSphereCapsule(Sphere(Point(0.f, 2.5f, 0.f), 0.4f), capsule, manifold));
+    }
+
+    SECTION("Sphere-AABB")
+    {
+        const AABB box(Point(0.f, 0.f, 0.f), 4.f, 4.f, 4.f);
+
+        REQUIRE(Collision::getManifoldSphereAABB(Sphere(Point(2.5f, 0.f, 0.f), 1.f), box, manifold));
+        checkVector(manifold.m_normal, -1.f, 0.f, 0.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.5f));
+        REQUIRE(manifold.m_pointCount == 1);
+        checkVector(manifold.m_points[0].m_position, 1.75f, 0.f, 0.f);
+
+        // center inside the box, out through the nearest face
+        REQUIRE(Collision::getManifoldSphereAABB(Sphere(Point(1.5f, 0.2f, 0.f), 0.25f), box, manifold));
+        checkVector(manifold.m_normal, -1.f, 0.f, 0.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.75f));
+
+        CHECK_FALSE(Collision::getManifoldSphereAABB(Sphere(Point(2.5f, 2.5f, 0.f), 0.5f), box, manifold));
+    }
+
+    SECTION("Capsule-Capsule")
+    {
+        const Capsule capsule(Point(-2.f, 0.f, 0.f), Point(2.f, 0.f, 0.f), 0.5f);
+
+        // crossing
+        REQUIRE(Collision::getManifoldCapsuleCapsule(capsule, Capsule(Point(0.f, -2.f, 0.8f), Point(0.f, 2.f, 0.8f), 0.5f), manifold));
+        checkVector(manifold.m_normal, 0.f, 0.f, 1.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.2f));
+        REQUIRE(manifold.m_pointCount == 1);
+        checkVector(manifold.m_points[0].m_position, 0.f, 0.f, 0.4f);
+
+        // side by side, the 2 ends of the shared range
+        REQUIRE(Collision::getManifoldCapsuleCapsule(capsule, Capsule(Point(-1.f, 0.8f, 0.f), Point(3.f, 0.8f, 0.f), 0.5f), manifold));
+        checkVector(manifold.m_normal, 0.f, 1.f, 0.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.2f));
+        REQUIRE(manifold.m_pointCount == 2);
+        checkVector(manifold.m_points[0].m_position, -1.f, 0.4f, 0.f);
+        checkVector(manifold.m_points[1].m_position, 2.f, 0.4f, 0.f);
+
+        CHECK_FALSE(Collision::getManifoldCapsuleCapsule(capsule, Capsule(Point(0.f, -2.f, 1.1f), Point(0.f, 2.f, 1.1f), 0.5f), manifold));
+    }
+
+    SECTION("Capsule-Plan")
+    {
+        const Plan ground(LibMath::Vector3(0.f, 1.f, 0.f), 0.f);
+
+        // lying on the plan
+        REQUIRE(Collision::getManifoldCapsulePlan(Capsule(Point(-1.f, 0.3f, 0.f), Point(1.f, 0.3f, 0.f), 0.5f), ground, manifold));
+        checkVector(manifold.m_normal, 0.f, -1.f, 0.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.2f));
+        REQUIRE(manifold.m_pointCount == 2);
+        checkVector(manifold.m_points[0].m_position, -1.f, -0.1f, 0.f);
+        checkVector(manifold.m_points[1].m_position, 1.f, -0.1f, 0.f);
+
+        // standing on one end
+        REQUIRE(Collision::getManifoldCapsulePlan(Capsule(Point(0.f, 0.3f, 0.f), Point(0.f, 2.f, 0.f), 0.5f), ground, manifold));
+        CHECK(manifold.m_pointCount == 1);
+        CHECK(manifold.m_depth == Catch::Approx(0.2f));
+
+        // below the plan, pushed the other way
+        REQUIRE(Collision::getManifoldCapsulePlan(Capsule(Point(0.f, -0.3f, 0.f), Point(0.f, -2.f, 0.f), 0.5f), ground, manifold));
+        checkVector(manifold.m_normal, 0.f, 1.f, 0.f);
+
+        CHECK_FALSE(Collision::getManifoldCapsulePlan(Capsule(Point(-1.f, 0.6f, 0.f), Point(1.f, 0.6f, 0.f), 0.5f), ground, manifold));
+    }
+
+    SECTION("AABB-AABB")
+    {
+        const AABB box(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f);
+
+        REQUIRE(Collision::getManifoldAABBAABB(box, AABB(Point(1.5f, 0.5f, 0.f), 2.f, 2.f, 2.f), manifold));
+        checkVector(manifold.m_normal, 1.f, 0.f, 0.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.5f));
+        REQUIRE(manifold.m_pointCount == 4);
+        for (int i = 0; i < 4; ++i)
+        {
+            CHECK(manifold.m_points[i].m_position.m_x == Catch::Approx(0.75f));
+            CHECK(std::abs(manifold.m_points[i].m_position.m_z) == Catch::Approx(1.f));
+            CHECK(manifold.m_points[i].m_depth == Catch::Approx(0.5f));
+        }
+        CHECK(std::min({ manifold.m_points[0].m_position.m_y, manifold.m_points[1].m_position.m_y, manifold.m_points[2].m_position.m_y }) == Catch::Approx(-0.5f));
+
+        // the other way
+        REQUIRE(Collision::getManifoldAABBAABB(box, AABB(Point(0.f, -1.8f, 0.f), 2.f, 2.f, 2.f), manifold));
+        checkVector(manifold.m_normal, 0.f, -1.f, 0.f);
+        CHECK(manifold.m_depth == Catch::Approx(0.2f));
+
+        // touching by an edge
+        REQUIRE(Collision::getManifoldAABBAABB(box, AABB(Point(2.f, 2.f, 0.f), 2.f, 2.f, 2.f), manifold));
+        CHECK(manifold.m_depth == Catch::Approx(0.f));
+        CHECK(manifold.m_pointCount == 2);
+
+        CHECK_FALSE(Collision::getManifoldAABBAABB(box, AABB(Point(2.1f, 0.f, 0.f), 2.f, 2.f, 2.f), manifold));
+    }
+
+    SECTION("Agreement with the boolean tests")
+    {
+        // every manifold found by the boolean test, and moving the second shape by the normal times the depth separates them
+        unsigned int seed = 11;
+        auto random = [&seed](float min, float max)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return min + (max - min) * static_cast<float>(seed >> 8) / 16777216.f;
+        };
+        auto randomPoint = [&random]()
+        {
+            return Point(random(-2.f, 2.f), random(-2.f, 2.f), random(-2.f, 2.f));
+        };
+        auto pushed = [](const Point& point, const Collision::Manifold& result)
+        {
+            return Point(point.toVector3() + result.m_normal * (result.m_depth + 1e-3f));
+        };
+
+        int mismatches = 0;
+        int unseparated = 0;
+        int hits = 0;
+
+        for (int pair = 0; pair < 1000; ++pair)
+        {
+            Sphere sphere1(randomPoint(), random(0.2f, 1.5f));
+            Sphere sphere2(randomPoint(), random(0.2f, 1.5f));
+            Capsule capsule1(randomPoint(), randomPoint(), random(0.2f, 1.f));
+            Capsule capsule2(randomPoint(), randomPoint(), random(0.2f, 1.f));
+            AABB box1(randomPoint(), random(0.2f, 3.f), random(0.2f, 3.f), random(0.2f, 3.f));
+            AABB box2(randomPoint(), random(0.2f, 3.f), random(0.2f, 3.f), random(0.2f, 3.f));
+            LibMath::Vector3 normal(random(-1.f, 1.f), random(-1.f, 1.f), random(-1.f, 1.f));
+            Plan plan(normal, random(-1.f, 1.f));
+
+            bool hit = Collision::getManifoldSphereSphere(sphere1, sphere2, manifold);
+            mismatches += hit != Collision::checkCollisionSphereSphere(sphere1, sphere2);
+            unseparated += hit && Collision::checkCollisionSphereSphere(sphere1, Sphere(pushed(sphere2.m_center, manifold), sphere2.m_radius));
+            hits += hit;
+
+            hit = Collision::getManifoldSphereCapsule(sphere1, capsule1, manifold);
+            mismatches += hit != Collision::checkCollisionCapsuleSphere(capsule1, sphere1);
+            unseparated += hit && Collision::checkCollisionCapsuleSphere(Capsule(pushed(capsule1.m_pointA, manifold), pushed(capsule1.m_pointB, manifold), capsule1.m_radius), sphere1);
+            hits += hit;
+
+            hit = Collision::getManifoldSphereAABB(sphere1, box1, manifold);
+            mismatches += hit != Collision::checkCollisionAABBShpere(box1, sphere1);
+            unseparated += hit && Collision::checkCollisionAABBShpere(AABB(pushed(box1.m_center, manifold), box1.m_width, box1.m_height, box1.m_depth), sphere1);
+            hits += hit;
+
+            hit = Collision::getManifoldCapsuleCapsule(capsule1, capsule2, manifold);
+            mismatches += hit != Collision::checkCollisionCapsuleCapsule(capsule1, capsule2);
+            unseparated += hit && Collision::checkCollisionCapsuleCapsule(capsule1, Capsule(pushed(capsule2.m_pointA, manifold), pushed(capsule2.m_pointB, manifold), capsule2.m_radius));
+            hits += hit;
+
+            hit = Collision::getManifoldCapsulePlan(capsule1, plan, manifold);
+            mismatches += hit != Collision::checkCollisionCapsulePlan(capsule1, plan);
+            unseparated += hit && Collision::checkCollisionCapsulePlan(capsule1, Plan(plan.m_normal, plan.m_distance - plan.m_normal.dot(manifold.m_normal) * (manifold.m_depth + 1e-3f)));
+            hits += hit;
+
+            hit = Collision::getManifoldAABBAABB(box1, box2, manifold);
+            mismatches += hit != Collision::checkCollisionAABBAABB(box1, box2);
+            unseparated += hit && Collision::checkCollisionAABBAABB(box1, AABB(pushed(box2.m_center, manifold), box2.m_width, box2.m_height, box2.m_depth));
+            hits += hit;
+        }
+
+        CHECK(mismatches == 0);
+        CHECK(unseparated == 0);
+        CHECK(hits > 1000);
+    }
+}
+
+TEST_CASE("Batched Collisions", "[.all][Collision3D][batch]")
+{
+    SECTION("Sphere against a batch")
+    {
+        // 11 spheres along x : a full SIMD block and a scalar tail
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 11; ++i)
+        {
+            spheres.emplace_back(Point(static_cast<float>(i) * 2.f, 0.f, 0.f), 0.5f);
+        }
+
+        Collision::SphereBatch batch;
+        batch.load(spheres);
+        REQUIRE(batch.size() == 11);
+
+        // overlaps the sphere at 18, touches the one at 20
+        Sphere sphere(Point(19.f, 0.f, 0.f), 0.5f);
+
+        std::vector<int> result = { -1 };
+        Collision::checkCollisionSphereSphere(sphere, batch, result);
+        CHECK(result == std::vector<int>{ -1, 9, 10 });
+
+        // Empty batch
+        result.clear();
+        Collision::checkCollisionSphereSphere(sphere, Collision::SphereBatch(), result);
+        CHECK(result.empty());
+    }
+
+    SECTION("AABB against a batch")
+    {
+        std::vector<AABB> boxes;
+        for (int i = 0; i < 11; ++i)
+        {
+            boxes.emplace_back(Point(0.f, static_cast<float>(i) * 2.f, 0.f), 1.f, 1.f, 1.f);
+        }
+
+        Collision::AABBBatch batch;
+        batch.load(boxes);
+        REQUIRE(batch.size() == 11);
+
+        // touches the boxes at 0 and 2
+        AABB aabb(Point(0.f, 1.f, 0.f), 1.f, 1.f, 1.f);
+
+        std::vector<int> result;
+        Collision::checkCollisionAABBAABB(aabb, batch, result);
+        CHECK(result == std::vector<int>{ 0, 1 });
+
+        result.clear();
+        Collision::checkCollisionAABBAABB(AABB(Point(0.f, 1.f, 5.f), 1.f, 1.f, 1.f), batch, result);
+        CHECK(result.empty());
+    }
+
+    SECTION("Same results as the pair tests")
+    {
+        std::mt19937 generator(5);
+        std::uniform_real_distribution<float> position(-10.f, 10.f);
+        std::uniform_real_distribution<float> size(0.1f, 3.f);
+
+        // sizes off the SIMD width, the second batch spans 2 blocks
+        std::vector<Sphere> spheres1;
+        std::vector<Sphere> spheres2;
+        std::vector<AABB> boxes1;
+        std::vector<AABB> boxes2;
+
+        for (int i = 0; i < 37; ++i)
+        {
+            spheres1.emplace_back(Point(position(generator), position(generator), position(generator)), size(generator));
+            boxes1.emplace_back(Point(position(generator), position(generator), position(generator)), size(generator), size(generator), size(generator));
+        }
+
+        for (int i = 0; i < 2500; ++i)
+        {
+            spheres2.emplace_back(Point(position(generator), position(generator), position(generator)), size(generator));
+            boxes2.emplace_back(Point(position(generator), position(generator), position(generator)), size(generator), size(generator), size(generator));
+        }
+
+        Collision::SphereBatch sphereBatch1;
+        Collision::SphereBatch sphereBatch2;
+        Collision::AABBBatch boxBatch1;
+        Collision::AABBBatch boxBatch2;
+        sphereBatch1.load(spheres1);
+        sphereBatch2.load(spheres2);
+        boxBatch1.load(boxes1);
+        boxBatch2.load(boxes2);
+
+        std::vector<std::pair<int, int>> expectedSpheres;
+        std::vector<std::pair<int, int>> expectedBoxes;
+        int mismatches = 0;
+
+        for (int i = 0; i < 37; ++i)
+        {
+            std::vector<int> expected;
+            std::vector<int> result;
+
+            for (int j = 0; j < 2500; ++j)
+            {
+                if (Collision::checkCollisionSphereSphere(spheres1[i], spheres2[j]))
+                {
+                    expected.push_back(j);
+                    expectedSpheres.emplace_back(i, j);
+                }
+            }
+
+            Collision::checkCollisionSphereSphere(spheres1[i], sphereBatch2, result);
+            mismatches += result != expected;
+
+            expected.clear();
+            result.clear();
+
+            for (int j = 0; j < 2500; ++j)
+            {
+                if (Collision::checkCollisionAABBAABB(boxes1[i], boxes2[j]))
+                {
+                    expected.push_back(j);
+                    expectedBoxes.emplace_back(i, j);
+                }
+            }
+
+            Collision::checkCollisionAABBAABB(boxes1[i], boxBatch2, result);
+            mismatches += result != expected;
+        }
+
+        CHECK(mismatches == 0);
+        CHECK(expectedSpheres.size() > 100);
+        CHECK(expectedBoxes.size() > 100);
+
+        // Pairs come block by block, compare them sorted
+        std::vector<std::pair<int, int>> spherePairs;
+        std::vector<std::pair<int, int>> boxPairs;
+        Collision::checkCollisionSphereSphere(sphereBatch1, sphereBatch2, spherePairs);
+        Collision::checkCollisionAABBAABB(boxBatch1, boxBatch2, boxPairs);
+
+        std::sort(spherePairs.begin(), spherePairs.end());
+        std::sort(boxPairs.begin(), boxPairs.end());
+        CHECK(spherePairs == expectedSpheres);
+        CHECK(boxPairs == expectedBoxes);
+    }
+
+    SECTION("Touching spheres")
+    {
+        // centers a radius sum away give distances rounding on both sides of it, a fused multiply add on one side only would flip some
+        std::mt19937 generator(11);
+        std::uniform_real_distribution<float> coordinate(-1.f, 1.f);
+        std::uniform_real_distribution<float> size(0.1f, 3.f);
+
+        Sphere sphere(Point(1.3f, -0.7f, 2.9f), 1.7f);
+        std::vector<Sphere> spheres;
+
+        while (spheres.size() < 5003)
+        {
+            LibMath::Vector3 direction(coordinate(generator), coordinate(generator), coordinate(generator));
+            if (direction.magnitudeSquared() < 0.01f)
+            {
+                continue;
+            }
+
+            float radius = size(generator);
+            direction.normalize();
+            direction *= sphere.m_radius + radius;
+            spheres.emplace_back(Point(sphere.m_center.m_x + direction.m_x, sphere.m_center.m_y + direction.m_y, sphere.m_center.m_z + direction.m_z), radius);
+        }
+
+        Collision::SphereBatch batch;
+        batch.load(spheres);
+
+        std::vector<int> expected;
+        for (int i = 0; i < static_cast<int>(spheres.size()); ++i)
+        {
+            if (Collision::checkCollisionSphereSphere(sphere, spheres[i]))
+            {
+                expected.push_back(i);
+            }
+        }
+
+        std::vector<int> result;
+        Collision::checkCollisionSphereSphere(sphere, batch, result);
+
+        CHECK(result == expected);
+        CHECK(expected.size() > 500);
+        CHECK(expected.size() < 4500);
+    }
+}
+
+TEST_CASE("Bounding AABB", "[.all][Collision3D][broadPhase]")
+{
+    SECTION("Shapes")
+    {
+        AABB sphereBounds = getBoundingAABB(Sphere(Point(1.f, 2.f, 3.f), 2.f));
+        CHECK(sphereBounds.m_center.m_x == Catch::Approx(1.f));
+        CHECK(sphereBounds.extentX() == Catch::Approx(2.f));
+        CHECK(sphereBounds.extentY() == Catch::Approx(2.f));
+        CHECK(sphereBounds.extentZ() == Catch::Approx(2.f));
+
+        AABB capsuleBounds = getBoundingAABB(Capsule(Point(0.f, 0.f, 0.f), Point(4.f, 0.f, 0.f), 1.f));
+        CHECK(capsuleBounds.m_center.m_x == Catch::Approx(2.f));
+        CHECK(capsuleBounds.extentX() == Catch::Approx(3.f));
+        CHECK(capsuleBounds.extentY() == Catch::Approx(1.f));
+
+        AABB lineBounds = getBoundingAABB(Line(Point(0.f, 0.f, 0.f), Point(0.f, -2.f, 2.f)));
+        CHECK(lineBounds.m_center.m_y == Catch::Approx(-1.f));
+        CHECK(lineBounds.m_center.m_z == Catch::Approx(1.f));
+        CHECK(lineBounds.extentX() == Catch::Approx(0.f));
+        CHECK(lineBounds.extentY() == Catch::Approx(1.f));
+
+        // Tight around the corners of the turned box
+        AABB obbBounds = getBoundingAABB(OBB(Point(1.f, 0.f, 0.f), 2.f, 2.f, 4.f, LibMath::Radian(static_cast<float>(M_PI) / 4.f)));
+        CHECK(obbBounds.m_center.m_x == Catch::Approx(1.f));
+        CHECK(obbBounds.extentX() == Catch::Approx(std::sqrt(2.f)));
+        CHECK(obbBounds.extentY() == Catch::Approx(std::sqrt(2.f)));
+        CHECK(obbBounds.extentZ() == Catch::Approx(2.f));
+    }
+
+    SECTION("Shape")
+    {
+        Sphere sphere(Point(1.f, 2.f, 3.f), 2.f);
+        const Shape shape = sphere;
+        CHECK(getBoundingAABB(shape).extentX() == Catch::Approx(2.f));
+
+        Plan plan(LibMath::Vector3(0.f, 1.f, 0.f), 0.f);
+        CHECK_THROWS_AS(getBoundingAABB(Shape(plan)), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Dynamic AABB Tree", "[.all][Collision3D][broadPhase]")
+{
+    // 8 x 8 x 8 grid of unit boxes spaced 0.9 apart, each box overlaps its direct neighbours
+    std::vector<AABB> boxes;
+    for (int x = 0; x < 8; ++x)
+    {
+        for (int y = 0; y < 8; ++y)
+        {
+            for (int z = 0; z < 8; ++z)
+            {
+                boxes.emplace_back(Point(x * 0.9f, y * 0.9f, z * 0.9f), 1.f, 1.f, 1.f);
+            }
+        }
+    }
+
+    Collision::DynamicAABBTree tree(0.f);
+    std::vector<int> proxies;
+    for (AABB& box : boxes)
+    {
+        proxies.push_back(tree.insert(box, &box));
+    }
+
+    auto bruteForcePairs = [&]()
+    {
+        std::set<std::pair<int, int>> pairs;
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            for (size_t j = i + 1; j < boxes.size(); ++j)
+            {
+                if (Collision::checkCollisionAABBAABB(boxes[i], boxes[j]))
+                {
+                    pairs.emplace(std::min(proxies[i], proxies[j]), std::max(proxies[i], proxies[j]));
+                }
+            }
+        }
+        return pairs;
+    };
+
+    SECTION("Insert")
+    {
+        CHECK(tree.size() == boxes.size());
+        CHECK(tree.validate());
+        CHECK(tree.height() < 20);
+        CHECK(tree.getObject(proxies[5]) == &boxes[5]);
+    }
+
+    SECTION("Pairs")
+    {
+        std::vector<std::pair<int, int>> pairs;
+        tree.queryPairs(pairs);
+
+        std::set<std::pair<int, int>> uniquePairs(pairs.begin(), pairs.end());
+        CHECK(uniquePairs.size() == pairs.size());
+        CHECK(uniquePairs == bruteForcePairs());
+    }
+
+    SECTION("Query")
+    {
+        std::vector<int> result;
+        tree.query(AABB(Point(0.f, 0.f, 0.f), 0.2f, 0.2f, 0.2f), result);
+
+        REQUIRE(result.size() == 1);
+        CHECK(result[0] == proxies[0]);
+
+        result.clear();
+        tree.query(AABB(Point(100.f, 0.f, 0.f), 1.f, 1.f, 1.f), result);
+        CHECK(result.empty());
+    }
+
+    SECTION("Move And Remove")
+    {
+        Collision::DynamicAABBTree fatTree(0.5f);
+        int proxy = fatTree.insert(boxes[0]);
+
+        // Inside the fat AABB, the tree is left untouched
+        AABB moved(Point(0.3f, 0.f, 0.f), 1.f, 1.f, 1.f);
+        CHECK_FALSE(fatTree.move(proxy, moved));
+        CHECK(fatTree.getFatAABB(proxy).extentX() == Catch::Approx(1.f));
+
+        // Outside, the fat AABB is rebuilt around the new bounds and stretched by the displacement
+        moved.m_center.m_x = 2.f;
+        CHECK(fatTree.move(proxy, moved, LibMath::Vector3(1.f, 0.f, 0.f)));
+        CHECK(fatTree.getFatAABB(proxy).extentX() == Catch::Approx(1.5f));
+
+        for (size_t i = 0; i < boxes.size(); i += 2)
+        {
+            boxes[i].m_center.m_y += 20.f;
+            tree.move(proxies[i], boxes[i]);
+        }
+        for (size_t i = 1; i < boxes.size(); i += 3)
+        {
+            tree.remove(proxies[i]);
+            proxies[i] = tree.insert(boxes[i]);
+        }
+
+        CHECK(tree.validate());
+
+        std::vector<std::pair<int, int>> pairs;
+        tree.queryPairs(pairs);
+        CHECK(std::set<std::pair<int, int>>(pairs.begin(), pairs.end()) == bruteForcePairs());
+
+        tree.remove(proxies[0]);
+        CHECK(tree.size() == boxes.size() - 1);
+        CHECK_THROWS_AS(tree.remove(proxies[0]), std::out_of_range);
+        CHECK_THROWS_AS(tree.getFatAABB(-1), std::out_of_range);
+
+        tree.clear();
+        CHECK(tree.size() == 0);
+        CHECK(tree.height() == -1);
+    }
+}
+
+TEST_CASE("Shape Storage", "[.all][geometricObject3D]")
+{
+    SECTION("Layout")
+    {
+        CHECK(sizeof(Point) == 3 * sizeof(float));
+        CHECK(sizeof(Sphere) == 4 * sizeof(float));
+        CHECK(sizeof(Capsule) == 7 * sizeof(float));
+    }
+
+    SECTION("Handles")
+    {
+        ShapeStorage storage;
+        ShapeHandle first = storage.add(Sphere(Point(1.f, 0.f, 0.f), 1.f));
+        ShapeHandle second = storage.add(Sphere(Point(2.f, 0.f, 0.f), 2.f));
+        ShapeHandle third = storage.add(Sphere(Point(3.f, 0.f, 0.f), 3.f));
+        ShapeHandle capsule = storage.add(Shape(Capsule(Point(0.f, 0.f, 0.f), Point(0.f, 1.f, 0.f), 0.5f)));
+
+        CHECK(storage.size() == 4);
+        CHECK(capsule.m_type == ShapeType::Capsule);
+        CHECK(storage.getAll<Sphere>().size() == 3);
+
+        // the last sphere moves into the hole, its handle follows it
+        storage.remove(first);
+        CHECK(storage.getAll<Sphere>().size() == 2);
+        CHECK(storage.get<Sphere>(third).m_radius == 3.f);
+        CHECK(storage.get<Sphere>(second).m_radius == 2.f);
+        CHECK_THROWS_AS(storage.get<Sphere>(first), std::out_of_range);
+        CHECK_THROWS_AS(storage.get<Sphere>(capsule), std::out_of_range);
+
+        ShapeHandle reused = storage.add(Sphere(Point(4.f, 0.f, 0.f), 4.f));
+        CHECK(reused.m_id == first.m_id);
+        CHECK(std::get<Sphere>(storage.getShape(reused)).m_radius == 4.f);
+        CHECK(std::get<Capsule>(storage.getShape(capsule)).m_radius == 0.5f);
+
+        storage.clear();
+        CHECK(storage.size() == 0);
+    }
+
+    SECTION("Update")
+    {
+        ShapeStorage storage;
+        storage.add(Point(1.f, 2.f, 3.f));
+        storage.add(Sphere(Point(1.f, 2.f, 3.f), 1.f));
+        storage.add(Capsule(Point(0.f, 0.f, 0.f), Point(0.f, 1.f, 0.f), 0.5f));
+        storage.add(Plan(LibMath::Vector3(0.f, 1.f, 0.f), 2.f));
+
+        LibMath::Matrix4 transform = LibMath::Matrix4::createTransform(LibMath::Vector3(1.f, -1.f, 2.f), LibMath::Radian(0.5f), LibMath::Vector3(2.f, 2.f, 2.f));
+        storage.update(transform);
+
+        // same result as update on each shape
+        Point point(1.f, 2.f, 3.f);
+        Shape capsule = Capsule(Point(0.f, 0.f, 0.f), Point(0.f, 1.f, 0.f), 0.5f);
+        point.update(transform);
+        update(capsule, transform);
+
+        CHECK(storage.getAll<Point>()[0].m_x == Catch::Approx(point.m_x));
+        CHECK(storage.getAll<Point>()[0].m_y == Catch::Approx(point.m_y));
+        CHECK(storage.getAll<Sphere>()[0].m_center.m_z == Catch::Approx(point.m_z));
+        CHECK(storage.getAll<Capsule>()[0].m_pointB.m_x == Catch::Approx(std::get<Capsule>(capsule).m_pointB.m_x));
+        CHECK(storage.getAll<Capsule>()[0].m_pointB.m_y == Catch::Approx(std::get<Capsule>(capsule).m_pointB.m_y));
+        CHECK(storage.getAll<Plan>()[0].m_distance == 2.f);
+
+        int bounded = 0;
+        storage.forEach([&bounded](auto const& shape)
+        {
+            if constexpr (!std::is_same_v<std::decay_t<decltype(shape)>, Plan>)
+            {
+                bounded += getBoundingAABB(shape).m_width >= 0.f;
+            }
+        });
+        CHECK(bounded == 3);
+    }
+}
@@ -0,0 +1,362 @@
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "LibMath/Collisions.h"
+#include "LibMath/Intersection.h"
+#include "LibMath/Trigonometry.h"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace LibMath::Geometry3D;
+using LibMath::Vector3;
+
+namespace Intersection = LibMath::Intersection3D;
+
+#define CHECK_VECTOR3(vector, x, y, z) \
+	CHECK(vector.m_x == Catch::Approx(x).margin(1e-5)); \
+	CHECK(vector.m_y == Catch::Approx(y).margin(1e-5)); \
+	CHECK(vector.m_z == Catch::Approx(z).margin(1e-5))
+
+TEST_CASE("Raycast", "[.all][intersection][raycast]")
+{
+	Line rayX(Point(-10.f, 0.f, 0.f), Vector3(1.f, 0.f, 0.f));
+	Intersection::RaycastHit hit;
+
+	SECTION("Sphere")
+	{
+		Sphere sphere(Point(0.f, 0.f, 0.f), 2.f);
+
+		REQUIRE(Intersection::raycast(rayX, sphere, hit));
+		CHECK(hit.m_t == Catch::Approx(8.f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), -2.f, 0.f, 0.f);
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		// Grazing ray at 45 degrees of the surface normal
+		Line offsetRay(Point(-10.f, std::sqrt(2.f), 0.f), Vector3(1.f, 0.f, 0.f));
+		REQUIRE(Intersection::raycast(offsetRay, sphere, hit));
+		CHECK(hit.m_t == Catch::Approx(10.f - std::sqrt(2.f)));
+		CHECK_VECTOR3(hit.m_normal, -std::sqrt(0.5f), std::sqrt(0.5f), 0.f);
+
+		CHECK_FALSE(Intersection::raycast(rayX, sphere, hit, 5.f));
+		CHECK_FALSE(Intersection::raycast(Line(Point(-10.f, 3.f, 0.f), Vector3(1.f, 0.f, 0.f)), sphere, hit));
+		CHECK_FALSE(Intersection::raycast(Line(Point(-10.f, 0.f, 0.f), Vector3(-1.f, 0.f, 0.f)), sphere, hit));
+
+		// Starting inside
+		REQUIRE(Intersection::raycast(Line(Point(0.5f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f)), sphere, hit));
+		CHECK(hit.m_t == 0.f);
+		CHECK_VECTOR3(hit.m_normal, 0.f, -1.f, 0.f);
+	}
+
+	SECTION("AABB")
+	{
+		AABB aabb(Point(0.f, 0.f, 0.f), 2.f, 4.f, 6.f);
+
+		REQUIRE(Intersection::raycast(rayX, aabb, hit));
+		CHECK(hit.m_t == Catch::Approx(9.f));
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		Line down(Point(0.5f, 10.f, 2.f), Vector3(0.f, -1.f, 0.f));
+		REQUIRE(Intersection::raycast(down, aabb, hit));
+		CHECK(hit.m_t == Catch::Approx(8.f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), 0.5f, 2.f, 2.f);
+		CHECK_VECTOR3(hit.m_normal, 0.f, 1.f, 0.f);
+
+		CHECK_FALSE(Intersection::raycast(Line(Point(-10.f, 2.5f, 0.f), Vector3(1.f, 0.f, 0.f)), aabb, hit));
+		CHECK_FALSE(Intersection::raycast(rayX, aabb, hit, 8.f));
+	}
+
+	SECTION("OBB")
+	{
+		// Quarter turn around Z : the 2 x 4 face becomes 4 wide on X
+		OBB obb(Point(0.f, 0.f, 0.f), 2.f, 4.f, 6.f, LibMath::Radian(LibMath::c_half_pi));
+
+		REQUIRE(Intersection::raycast(rayX, obb, hit));
+		CHECK(hit.m_t == Catch::Approx(8.f));
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		REQUIRE(Intersection::raycast(Line(Point(0.f, -10.f, 0.f), Vector3(0.f, 1.f, 0.f)), obb, hit));
+		CHECK(hit.m_t == Catch::Approx(9.f));
+		CHECK_VECTOR3(hit.m_normal, 0.f, -1.f, 0.f);
+	}
+
+	SECTION("Capsule")
+	{
+		Capsule capsule(Point(0.f, -2.f, 0.f), Point(0.f, 2.f, 0.f), 1.f);
+
+		// Cylinder part
+		REQUIRE(Intersection::raycast(rayX, capsule, hit));
+		CHECK(hit.m_t == Catch::Approx(9.f));
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		// Cap along the axis
+		REQUIRE(Intersection::raycast(Line(Point(0.f, 10.f, 0.f), Vector3(0.f, -1.f, 0.f)), capsule, hit));
+		CHECK(hit.m_t == Catch::Approx(7.f));
+		CHECK_VECTOR3(hit.m_normal, 0.f, 1.f, 0.f);
+
+		// Cap from the side, above the end point
+		REQUIRE(Intersection::raycast(Line(Point(-10.f, 2.5f, 0.f), Vector3(1.f, 0.f, 0.f)), capsule, hit));
+		CHECK(hit.m_point.m_y == Catch::Approx(2.5f));
+		CHECK(hit.m_point.m_x == Catch::Approx(-std::sqrt(0.75f)));
+
+		CHECK_FALSE(Intersection::raycast(Line(Point(-10.f, 3.5f, 0.f), Vector3(1.f, 0.f, 0.f)), capsule, hit));
+	}
+
+	SECTION("Plan")
+	{
+		Plan plan(Vector3(0.f, 1.f, 0.f), 2.f);
+
+		REQUIRE(Intersection::raycast(Line(Point(1.f, 10.f, 0.f), Vector3(0.f, -1.f, 0.f)), plan, hit));
+		CHECK(hit.m_t == Catch::Approx(8.f));
+		CHECK_VECTOR3(hit.m_normal, 0.f, 1.f, 0.f);
+
+		// From below, the normal faces the ray
+		REQUIRE(Intersection::raycast(Line(Point(1.f, -10.f, 0.f), Vector3(0.f, 1.f, 0.f)), plan, hit));
+		CHECK(hit.m_t == Catch::Approx(12.f));
+		CHECK_VECTOR3(hit.m_normal, 0.f, -1.f, 0.f);
+
+		CHECK_FALSE(Intersection::raycast(rayX, plan, hit));
+		CHECK_FALSE(Intersection::raycast(Line(Point(1.f, 10.f, 0.f), Vector3(0.f, 1.f, 0.f)), plan, hit));
+	}
+
+	SECTION("Triangle")
+	{
+		Vector3 a(0.f, 0.f, 0.f);
+		Vector3 b(0.f, 4.f, 0.f);
+		Vector3 c(0.f, 0.f, 4.f);
+
+		Line ray(Point(-10.f, 1.f, 1.f), Vector3(1.f, 0.f, 0.f));
+		REQUIRE(Intersection::raycast(ray, a, b, c, hit));
+		CHECK(hit.m_t == Catch::Approx(10.f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), 0.f, 1.f, 1.f);
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		// Both sides
+		REQUIRE(Intersection::raycast(Line(Point(10.f, 1.f, 1.f), Vector3(-1.f, 0.f, 0.f)), a, b, c, hit));
+		CHECK_VECTOR3(hit.m_normal, 1.f, 0.f, 0.f);
+
+		CHECK_FALSE(Intersection::raycast(Line(Point(-10.f, 3.f, 3.f), Vector3(1.f, 0.f, 0.f)), a, b, c, hit));
+		CHECK_FALSE(Intersection::raycast(Line(Point(-10.f, 1.f, 1.f), Vector3(0.f, 1.f, 0.f)), a, b, c, hit));
+	}
+
+	SECTION("Packet")
+	{
+		AABB aabb(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f);
+
+		std::vector<Line> rays;
+		for (int i = 0; i < 5; ++i)
+		{
+			rays.emplace_back(Point(-10.f, static_cast<float>(i) * 0.5f, 0.f), Vector3(1.f, 0.f, 0.f));
+		}
+
+		std::vector<Intersection::RaycastHit> hits(rays.size());
+		CHECK(Intersection::raycast(rays, aabb, hits) == 3);
+
+		for (size_t i = 0; i < rays.size(); ++i)
+		{
+			Intersection::RaycastHit single;
+			bool singleHit = Intersection::raycast(rays[i], aabb, single);
+
+			CHECK(singleHit == (hits[i].m_t != Intersection::noHit));
+			if (singleHit)
+			{
+				CHECK(hits[i].m_t == single.m_t);
+			}
+		}
+
+		std::vector<Intersection::RaycastHit> tooFew(2);
+		CHECK_THROWS_AS(Intersection::raycast(rays, aabb, tooFew), std::invalid_argument);
+	}
+}
+
+TEST_CASE("Sweep", "[.all][intersection][sweep]")
+{
+	Intersection::SweepHit hit;
+
+	SECTION("Sphere against a thin wall")
+	{
+		// A step long enough to jump over the wall, the discrete test misses it at both ends
+		Plan wall(Vector3(1.f, 0.f, 0.f), 0.f);
+		Sphere bullet(Point(-5.f, 0.f, 0.f), 0.5f);
+		Vector3 velocity(20.f, 0.f, 0.f);
+
+		CHECK_FALSE(LibMath::Collisions3D::checkCollisionSpherePlan(bullet, wall));
+		CHECK_FALSE(LibMath::Collisions3D::checkCollisionSpherePlan(Sphere(Point(15.f, 0.f, 0.f), 0.5f), wall));
+
+		REQUIRE(Intersection::sweep(bullet, velocity, wall, hit));
+		CHECK(hit.m_time == Catch::Approx(0.225f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), 0.f, 0.f, 0.f);
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		// From the other side
+		REQUIRE(Intersection::sweep(Sphere(Point(5.f, 1.f, 0.f), 0.5f), -velocity, wall, hit));
+		CHECK(hit.m_time == Catch::Approx(0.225f));
+		CHECK_VECTOR3(hit.m_normal, 1.f, 0.f, 0.f);
+
+		// Moving away, already touching
+		hit.m_time = -1.f;
+		CHECK_FALSE(Intersection::sweep(bullet, -velocity, wall, hit));
+		CHECK(hit.m_time == -1.f);
+
+		REQUIRE(Intersection::sweep(Sphere(Point(-0.2f, 0.f, 0.f), 0.5f), -velocity, wall, hit));
+		CHECK(hit.m_time == 0.f);
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+	}
+
+	SECTION("Sphere against a sphere")
+	{
+		Sphere target(Point(0.f, 0.f, 0.f), 1.f);
+
+		REQUIRE(Intersection::sweep(Sphere(Point(-5.f, 0.f, 0.f), 1.f), Vector3(10.f, 0.f, 0.f), target, hit));
+		CHECK(hit.m_time == Catch::Approx(0.3f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), -1.f, 0.f, 0.f);
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		CHECK_FALSE(Intersection::sweep(Sphere(Point(-5.f, 0.f, 0.f), 1.f), Vector3(2.f, 0.f, 0.f), target, hit));
+		CHECK_FALSE(Intersection::sweep(Sphere(Point(-5.f, 2.1f, 0.f), 1.f), Vector3(10.f, 0.f, 0.f), target, hit));
+
+		// No velocity, only a start overlap is reported
+		CHECK(Intersection::sweep(Sphere(Point(1.5f, 0.f, 0.f), 1.f), Vector3(0.f, 0.f, 0.f), target, hit));
+		CHECK(hit.m_time == 0.f);
+		CHECK_FALSE(Intersection::sweep(Sphere(Point(2.5f, 0.f, 0.f), 1.f), Vector3(0.f, 0.f, 0.f), target, hit));
+	}
+
+	SECTION("Sphere against a capsule")
+	{
+		Capsule pillar(Point(0.f, -2.f, 0.f), Point(0.f, 2.f, 0.f), 0.5f);
+
+		REQUIRE(Intersection::sweep(Sphere(Point(-5.f, 1.f, 0.f), 0.5f), Vector3(10.f, 0.f, 0.f), pillar, hit));
+		CHECK(hit.m_time == Catch::Approx(0.4f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), -0.5f, 1.f, 0.f);
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		// Over the top cap
+		REQUIRE(Intersection::sweep(Sphere(Point(0.f, 5.f, 0.f), 0.5f), Vector3(0.f, -10.f, 0.f), pillar, hit));
+		CHECK(hit.m_time == Catch::Approx(0.2f));
+		CHECK_VECTOR3(hit.m_normal, 0.f, 1.f, 0.f);
+	}
+
+	SECTION("Sphere against an AABB")
+	{
+		AABB box(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f);
+
+		// Face
+		REQUIRE(Intersection::sweep(Sphere(Point(-5.f, 0.f, 0.f), 1.f), Vector3(10.f, 0.f, 0.f), box, hit));
+		CHECK(hit.m_time == Catch::Approx(0.3f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), -1.f, 0.f, 0.f);
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		// Edge along Z : the center passes 0.5 above it, contact at 30 degrees
+		REQUIRE(Intersection::sweep(Sphere(Point(-5.f, 1.5f, 0.f), 1.f), Vector3(10.f, 0.f, 0.f), box, hit));
+		CHECK(hit.m_time == Catch::Approx((4.f - std::sqrt(0.75f)) / 10.f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), -1.f, 1.f, 0.f);
+		CHECK_VECTOR3(hit.m_normal, -std::sqrt(0.75f), 0.5f, 0.f);
+
+		// Corner : inside the square grown box but outside its rounded corner
+		Intersection::RaycastHit squareHit;
+		CHECK(Intersection::raycast(Line(Point(-5.f, 1.9f, 1.9f), Vector3(1.f, 0.f, 0.f)), AABB(Point(0.f, 0.f, 0.f), 4.f, 4.f, 4.f), squareHit));
+		CHECK_FALSE(Intersection::sweep(Sphere(Point(-5.f, 1.9f, 1.9f), 1.f), Vector3(10.f, 0.f, 0.f), box, hit));
+
+		REQUIRE(Intersection::sweep(Sphere(Point(-5.f, 1.5f, 1.5f), 1.f), Vector3(10.f, 0.f, 0.f), box, hit));
+		CHECK(hit.m_time == Catch::Approx((4.f - std::sqrt(0.5f)) / 10.f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), -1.f, 1.f, 1.f);
+	}
+
+	SECTION("AABB against an AABB")
+	{
+		AABB box(Point(0.f, 0.f, 0.f), 2.f, 2.f, 2.f);
+
+		REQUIRE(Intersection::sweep(AABB(Point(-5.f, 0.5f, 0.f), 2.f, 2.f, 2.f), Vector3(10.f, 0.f, 0.f), box, hit));
+		CHECK(hit.m_time == Catch::Approx(0.3f));
+		CHECK_VECTOR3(hit.m_point.toVector3(), -1.f, 0.5f, 0.f);
+		CHECK_VECTOR3(hit.m_normal, -1.f, 0.f, 0.f);
+
+		CHECK_FALSE(Intersection::sweep(AABB(Point(-5.f, 2.5f, 0.f), 2.f, 2.f, 2.f), Vector3(10.f, 0.f, 0.f), box, hit));
+	}
+
+	SECTION("Against the discrete tests")
+	{
+		// Just before the time of impact the shapes, shrunk a little, are apart, and at that time, grown a little, they touch
+		// a miss is apart all along the step
+		std::mt19937 generator(5);
+		std::uniform_real_distribution<float> position(-3.f, 3.f);
+		std::uniform_real_distribution<float> size(0.2f, 2.f);
+		float constexpr margin = 1e-3f;
+
+		auto randomPoint = [&]()
+		{
+			return Point(position(generator), position(generator), position(generator));
+		};
+
+		auto moved = [](const Point& point, const Vector3& velocity, float time)
+		{
+			return Point(point.toVector3() + velocity * time);
+		};
+
+		int errors = 0;
+		int hits = 0;
+
+		for (int i = 0; i < 500; ++i)
+		{
+			Sphere sphere(randomPoint(), size(generator) * 0.5f);
+			AABB aabb(randomPoint(), size(generator), size(generator), size(generator));
+			Vector3 velocity = Vector3(position(generator), position(generator), position(generator)) * 2.f;
+
+			Sphere sphereTarget(randomPoint(), size(generator) * 0.5f);
+			AABB boxTarget(randomPoint(), size(generator), size(generator), size(generator));
+			Capsule capsuleTarget(randomPoint(), randomPoint(), size(generator) * 0.5f);
+
+			auto sphereAt = [&](float time, float grow)
+			{
+				return Sphere(moved(sphere.m_center, velocity, time), sphere.m_radius + grow);
+			};
+
+			auto boxAt = [&](float time, float grow)
+			{
+				return AABB(moved(aabb.m_center, velocity, time), aabb.m_width + 2.f * grow, aabb.m_height + 2.f * grow, aabb.m_depth + 2.f * grow);
+			};
+
+			auto check = [&](bool found, auto touching)
+			{
+				hits += found;
+
+				if (!found)
+				{
+					for (int step = 0; step <= 64; ++step)
+					{
+						errors += touching(static_cast<float>(step) / 64.f, -margin);
+					}
+					return;
+				}
+
+				errors += !touching(hit.m_time, margin);
+				errors += hit.m_time > margin && touching(hit.m_time - margin, -margin);
+			};
+
+			check(Intersection::sweep(sphere, velocity, sphereTarget, hit), [&](float time, float grow)
+			{
+				return LibMath::Collisions3D::checkCollisionSphereSphere(sphereAt(time, grow), sphereTarget);
+			});
+
+			check(Intersection::sweep(sphere, velocity, boxTarget, hit), [&](float time, float grow)
+			{
+				return LibMath::Collisions3D::checkCollisionAABBShpere(boxTarget, sphereAt(time, grow));
+			});
+
+			check(Intersection::sweep(sphere, velocity, capsuleTarget, hit), [&](float time, float grow)
+			{
+				return LibMath::Collisions3D::checkCollisionCapsuleSphere(capsuleTarget, sphereAt(time, grow));
+			});
+
+			check(Intersection::sweep(aabb, velocity, boxTarget, hit), [&](float time, float grow)
+			{
+				return LibMath::Collisions3D::checkCollisionAABBAABB(boxAt(time, grow), boxTarget);
+			});
+		}
+
+		CHECK(errors == 0);
+		CHECK(hits > 100);
+	}
+}
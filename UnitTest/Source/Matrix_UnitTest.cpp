@@ -1,6 +1,7 @@
 #define	_USE_MATH_DEFINES
 #define GLM_ENABLE_EXPERIMENTAL
 #include <cmath>
+#include <cstdint>
 #include <glm/mat2x2.hpp>
 #include <glm/mat3x3.hpp>
 #include <glm/vec2.hpp>
@@ -9,11 +10,14 @@
 #include <glm/gtx/matrix_operation.hpp>
 
 #include <iostream>
+#include <stdexcept>
+#include <vector>
 
 #include "LibMath/Matrix/Matrix2.h"
 #include "LibMath/Matrix/Matrix3.h"
 #include "LibMath/Matrix/Matrix4.h"
 #include "LibMath/Matrix4Vector4Operation.h"
+#include "LibMath/Quaternion.h"
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -527,6 +531,13 @@ TEST_CASE("Matrix3", "[.all][matrix][Matrix3D]")
         // Const access (if applicable)
         LibMath::Matrix3 const constMat(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f);
         CHECK(constMat[0][0] == 1.0f);
+
+        // Unchecked access reads the same storage
+        CHECK(constMat.at_unchecked(1, 2) == constMat[1][2]);
+        CHECK(constMat.data()[5] == constMat[1][2]);
+
+        mat.at_unchecked(2, 1) = 20.0f;
+        CHECK(mat[2][1] == 20.0f);
     }
 
     SECTION("Matrix Properties")
@@ -889,6 +900,25 @@ TEST_CASE("Matrix4", "[.all][matrix][Matrix4]")
         mat[0][0] = 10.0f;
         CHECK(mat[0][0] == 10.0f);
 
+        // Unchecked access reads the same storage
+        mat.at_unchecked(3, 1) = 20.0f;
+        CHECK(mat[3][1] == 20.0f);
+
+        LibMath::Matrix4 const& constMat = mat;
+
+        for (size_t column = 0; column < 4; ++column)
+        {
+            for (size_t row = 0; row < 4; ++row)
+            {
+                CHECK(constMat.at_unchecked(column, row) == constMat[column][row]);
+                CHECK(constMat.data()[column * 4 + row] == constMat[column][row]);
+            }
+        }
+
+#if defined(LIBMATH_CHECKED_ACCESS)
+        CHECK_THROWS_AS(mat.at_unchecked(4, 0), std::out_of_range);
+        CHECK_THROWS_AS(mat.at_unchecked(0, 4), std::out_of_range);
+#endif
     }
 
     SECTION("Matrix Properties")
@@ -1044,6 +1074,53 @@ TEST_CASE("Matrix4", "[.all][matrix][Matrix4]")
             LibMath::Matrix4 identityMat = LibMath::Matrix4::identity();
             LibMath::Matrix4 identityInverse = identityMat.inverse();
             CHECK_MATRIX4(identityInverse, identityMat);
+
+            // Test with a dense matrix
+            LibMath::Matrix4 dense(
+                4.0f, 3.0f, 2.0f, 1.0f,
+                0.5f, -2.0f, 1.0f, 3.0f,
+                1.0f, 0.0f, -3.0f, 2.0f,
+                2.0f, 1.0f, 0.0f, -1.0f
+            );
+
+            glm::mat4 denseGlm(
+                4.0f, 3.0f, 2.0f, 1.0f,
+                0.5f, -2.0f, 1.0f, 3.0f,
+                1.0f, 0.0f, -3.0f, 2.0f,
+                2.0f, 1.0f, 0.0f, -1.0f
+            );
+
+            CHECK(dense.determinant() == Catch::Approx(glm::determinant(denseGlm)));
+            CHECK_MATRIX4(dense.inverse(), glm::inverse(denseGlm));
+        }
+
+        SECTION("Inverse Affine")
+        {
+            LibMath::Matrix4 transform = LibMath::Matrix4::createTransform(LibMath::Vector3(2.0f, -3.0f, 4.0f), LibMath::Radian(0.6f), LibMath::Vector3(2.0f, 3.0f, 0.5f));
+
+            glm::mat4 transformGlm = glm::translate(glm::mat4(1.f), glm::vec3(2.0f, -3.0f, 4.0f));
+            transformGlm = glm::rotate(transformGlm, 0.6f, glm::vec3(0.0f, 0.0f, 1.0f));
+            transformGlm = glm::scale(transformGlm, glm::vec3(2.0f, 3.0f, 0.5f));
+
+            CHECK_MATRIX4(transform.inverseAffine(), glm::inverse(transformGlm));
+            CHECK_MATRIX4(transform.inverseAffine(), transform.inverse());
+
+            LibMath::Matrix4 flat = LibMath::Matrix4::createScale(LibMath::Vector3(1.0f, 0.0f, 1.0f));
+            CHECK_THROWS(flat.inverseAffine());
+        }
+
+        SECTION("Inverse Rigid")
+        {
+            LibMath::Matrix4 transform = LibMath::Matrix4::createTranslate(LibMath::Vector3(2.0f, -3.0f, 4.0f)) *
+                                         LibMath::Matrix4::createRotationX(LibMath::Radian(0.4f)) *
+                                         LibMath::Matrix4::createRotationY(LibMath::Radian(-1.1f));
+
+            glm::mat4 transformGlm = glm::translate(glm::mat4(1.f), glm::vec3(2.0f, -3.0f, 4.0f));
+            transformGlm = glm::rotate(transformGlm, 0.4f, glm::vec3(1.0f, 0.0f, 0.0f));
+            transformGlm = glm::rotate(transformGlm, -1.1f, glm::vec3(0.0f, 1.0f, 0.0f));
+
+            CHECK_MATRIX4(transform.inverseRigid(), glm::inverse(transformGlm));
+            CHECK_MATRIX4(transform.inverseRigid(), transform.inverse());
         }
 
     }
@@ -1131,6 +1208,58 @@ TEST_CASE("Matrix4", "[.all][matrix][Matrix4]")
             CHECK_MATRIX4(transform, manualTRS);
         }
 
+        SECTION("Decompose")
+        {
+            LibMath::Vector3 axis(1.0f, 2.0f, -3.0f);
+            axis.normalize();
+            LibMath::Quaternion rotation(LibMath::Radian(2.0f), axis);
+
+            // the mirror ends up in the x scale
+            std::vector<LibMath::Vector3> scales{ LibMath::Vector3(2.0f, 3.0f, 0.5f), LibMath::Vector3(-2.0f, 3.0f, 0.5f), LibMath::Vector3(0.01f, 100.0f, 1.0f) };
+
+            for (LibMath::Vector3 const& scaleIn : scales)
+            {
+                LibMath::Matrix4 transform = LibMath::Matrix4::createTranslate(LibMath::Vector3(2.0f, -3.0f, 4.0f)) * rotation.toMatrix4() * LibMath::Matrix4::createScale(scaleIn);
+
+                LibMath::Vector3 translation;
+                LibMath::Quaternion rotationOut;
+                LibMath::Vector3 scale;
+                transform.decompose(translation, rotationOut, scale);
+
+                CHECK(translation == LibMath::Vector3(2.0f, -3.0f, 4.0f));
+                CHECK(scale.m_x == Catch::Approx(scaleIn.m_x));
+                CHECK(scale.m_y == Catch::Approx(scaleIn.m_y));
+                CHECK(scale.m_z == Catch::Approx(scaleIn.m_z));
+
+                float sign = rotation.m_w * rotationOut.m_w < 0.0f ? -1.0f : 1.0f;
+                for (unsigned int i = 0; i < 4; ++i)
+                {
+                    CHECK(sign * rotationOut[i] == Catch::Approx(rotation[i]).margin(1e-5f));
+                }
+
+                LibMath::Matrix4 recomposed = LibMath::Matrix4::createTranslate(translation) * rotationOut.toMatrix4() * LibMath::Matrix4::createScale(scale);
+                for (int i = 0; i < 4; ++i)
+                {
+                    for (int j = 0; j < 4; ++j)
+                    {
+                        CHECK(recomposed[i][j] == Catch::Approx(transform[i][j]).margin(1e-4f));
+                    }
+                }
+            }
+
+            LibMath::Vector3 translation;
+            LibMath::Quaternion rotationZ;
+            LibMath::Vector3 scale;
+            LibMath::Matrix4::createTransform(LibMath::Vector3(1.0f, 0.0f, 0.0f), LibMath::Radian(0.6f), LibMath::Vector3(2.0f, 2.0f, 2.0f)).decompose(translation, rotationZ, scale);
+
+            CHECK(rotationZ.m_z == Catch::Approx(std::sin(0.3f)));
+            CHECK(rotationZ.m_w == Catch::Approx(std::cos(0.3f)));
+            CHECK(scale == LibMath::Vector3(2.0f, 2.0f, 2.0f));
+
+            LibMath::Matrix4 flat = LibMath::Matrix4::createScale(LibMath::Vector3(1.0f, 0.0f, 1.0f));
+            CHECK_THROWS_AS(flat.decompose(translation, rotationZ, scale), std::runtime_error);
+        }
+
         SECTION("Remove Translation Component")
         {
             LibMath::Matrix4 transform = LibMath::Matrix4::createTransform(
@@ -1215,6 +1344,95 @@ TEST_CASE("Matrix4", "[.all][matrix][Matrix4]")
             CHECK_MATRIX4(perspNarrow, perspNarrowGlm);
         }
 
+        SECTION("Transform Points And Directions")
+        {
+            LibMath::Matrix4 transform = LibMath::Matrix4::createTransform(LibMath::Vector3(2.0f, -3.0f, 4.0f), LibMath::Radian(0.6f), LibMath::Vector3(2.0f, 3.0f, 0.5f));
+            LibMath::Matrix4 projection = LibMath::Matrix4::perspective(static_cast<float>(M_PI) / 3.0f, 1.5f, 0.1f, 100.0f) * transform;
+
+            glm::mat4 transformGlm = glm::translate(glm::mat4(1.f), glm::vec3(2.0f, -3.0f, 4.0f));
+            transformGlm = glm::rotate(transformGlm, 0.6f, glm::vec3(0.0f, 0.0f, 1.0f));
+            transformGlm = glm::scale(transformGlm, glm::vec3(2.0f, 3.0f, 0.5f));
+            glm::mat4 projectionGlm = glm::perspective(static_cast<float>(M_PI) / 3.0f, 1.5f, 0.1f, 100.0f) * transformGlm;
+
+            // 7 vectors : one SIMD block of 4 and a scalar tail
+            std::vector<LibMath::Vector3> points;
+            for (int i = 0; i < 7; ++i)
+            {
+                float value = static_cast<float>(i);
+                points.emplace_back(value - 3.0f, 0.5f * value, -10.0f - value);
+            }
+
+            std::vector<LibMath::Vector3> result(points.size());
+
+            transform.transformPoints(points, result);
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                glm::vec4 expected = transformGlm * glm::vec4(points[i].m_x, points[i].m_y, points[i].m_z, 1.0f);
+
+                CHECK(result[i].m_x == Catch::Approx(expected.x));
+                CHECK(result[i].m_y == Catch::Approx(expected.y));
+                CHECK(result[i].m_z == Catch::Approx(expected.z));
+            }
+
+            projection.transformPoints(points, result, true);
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                glm::vec4 expected = projectionGlm * glm::vec4(points[i].m_x, points[i].m_y, points[i].m_z, 1.0f);
+
+                CHECK(result[i].m_x == Catch::Approx(expected.x / expected.w));
+                CHECK(result[i].m_y == Catch::Approx(expected.y / expected.w));
+                CHECK(result[i].m_z == Catch::Approx(expected.z / expected.w));
+            }
+
+            transform.transformDirections(points, result);
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                glm::vec4 expected = transformGlm * glm::vec4(points[i].m_x, points[i].m_y, points[i].m_z, 0.0f);
+
+                CHECK(result[i].m_x == Catch::Approx(expected.x));
+                CHECK(result[i].m_y == Catch::Approx(expected.y));
+                CHECK(result[i].m_z == Catch::Approx(expected.z));
+            }
+
+            // in place
+            std::vector<LibMath::Vector3> inPlace = points;
+            transform.transformPoints(inPlace, inPlace);
+            transform.transformPoints(points, result);
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                CHECK(inPlace[i] == result[i]);
+            }
+
+            // same rounding as operator* in every SIMD mode, the library is built without implicit fused multiply add
+            std::vector<LibMath::Vector3> many;
+            for (int i = 0; i < 103; ++i)
+            {
+                float value = static_cast<float>(i);
+                many.emplace_back(std::sin(value) * 37.1f, std::cos(value * 1.3f) * 0.71f, value * 0.173f - 9.f);
+            }
+
+            std::vector<LibMath::Vector3> manyPoints(many.size());
+            std::vector<LibMath::Vector3> manyDirections(many.size());
+            transform.transformPoints(many, manyPoints);
+            transform.transformDirections(many, manyDirections);
+
+            int mismatches = 0;
+            for (size_t i = 0; i < many.size(); ++i)
+            {
+                LibMath::Vector4 point = transform * LibMath::Vector4(many[i].m_x, many[i].m_y, many[i].m_z, 1.0f);
+                LibMath::Vector4 direction = transform * LibMath::Vector4(many[i].m_x, many[i].m_y, many[i].m_z, 0.0f);
+
+                mismatches += manyPoints[i].m_x != point.m_x || manyPoints[i].m_y != point.m_y || manyPoints[i].m_z != point.m_z;
+                mismatches += manyDirections[i].m_x != direction.m_x || manyDirections[i].m_y != direction.m_y || manyDirections[i].m_z != direction.m_z;
+            }
+
+            CHECK(mismatches == 0);
+
+            std::vector<LibMath::Vector3> shorter(3);
+            CHECK_THROWS_AS(transform.transformPoints(points, shorter), std::invalid_argument);
+            CHECK_THROWS_AS(transform.transformDirections(points, shorter), std::invalid_argument);
+        }
+
     }
 
     SECTION("Arithmetic")
@@ -1376,5 +1594,24 @@ TEST_CASE("Matrix4", "[.all][matrix][Matrix4]")
             CHECK_MATRIX4(identityTranspose, identity);
         }
 
+        SECTION("Memory Layout")
+        {
+            // the vectorized kernels load whole columns and vectors with aligned loads
+            CHECK(alignof(LibMath::Matrix4) == 16);
+            CHECK(alignof(LibMath::Vector4) == 16);
+            CHECK(sizeof(LibMath::Matrix4) == 16 * sizeof(float));
+            CHECK(sizeof(LibMath::Vector4) == 4 * sizeof(float));
+
+            LibMath::Matrix4 mat(
+                1.0f, 2.0f, 3.0f, 4.0f,
+                5.0f, 6.0f, 7.0f, 8.0f,
+                9.0f, 10.0f, 11.0f, 12.0f,
+                13.0f, 14.0f, 15.0f, 16.0f
+            );
+
+            CHECK(reinterpret_cast<std::uintptr_t>(mat.data()) % 16 == 0);
+            CHECK(mat.data()[4] == mat[1][0]);
+        }
+
     }
 }
\ No newline at end of file
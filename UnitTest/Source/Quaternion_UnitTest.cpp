@@ -10,10 +10,13 @@
 #include <glm/gtx/matrix_operation.hpp>
 
 #include <iostream>
+#include <stdexcept>
+#include <vector>
 
 #include "LibMath/Quaternion.h"
 #include "LibMath/Vector/Vector3.h"
 #include "LibMath/Matrix/Matrix3.h"
+#include "LibMath/Matrix/Matrix4.h"
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -462,4 +465,232 @@ TEST_CASE("Quaternion", "[.all][quaternion][Quaternion]")
             CHECK(combined.m_z == Catch::Approx(combinedGlm.z).margin(0.0001f));
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Quaternion Rotate", "[.all][quaternion][Quaternion]")
+{
+    // the angle axis constructor expects a unit axis
+    LibMath::Vector3 axis(1.0f, -2.0f, 0.5f);
+    axis.normalize();
+
+    LibMath::Quaternion quat(LibMath::Radian(1.1f), axis);
+    glm::quat quatGlm = glm::angleAxis(1.1f, glm::normalize(glm::vec3(1.0f, -2.0f, 0.5f)));
+
+    std::vector<LibMath::Vector3> vectors;
+    for (int i = 0; i < 11; ++i)
+    {
+        float value = static_cast<float>(i) - 5.0f;
+        vectors.emplace_back(value, 1.0f - value * 0.5f, value * value * 0.1f);
+    }
+
+    SECTION("Sandwich Product")
+    {
+        for (float scale : { 1.0f, 3.0f, 0.25f })
+        {
+            // a non unit quaternion rotates like its normalized version
+            LibMath::Quaternion scaled = quat * scale;
+
+            for (LibMath::Vector3 const& vec : vectors)
+            {
+                LibMath::Vector3 rotated = scaled.rotate(vec);
+                LibMath::Quaternion sandwich = scaled * LibMath::Quaternion(vec) * scaled.inverse();
+
+                CHECK(rotated.m_x == Catch::Approx(sandwich.m_x).margin(0.0001f));
+                CHECK(rotated.m_y == Catch::Approx(sandwich.m_y).margin(0.0001f));
+                CHECK(rotated.m_z == Catch::Approx(sandwich.m_z).margin(0.0001f));
+            }
+        }
+    }
+
+    SECTION("Batch")
+    {
+        // 11 vectors : the SIMD blocks and the scalar tail
+        std::vector<LibMath::Vector3> rotated = vectors;
+        quat.rotate(std::span<LibMath::Vector3>(rotated));
+
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            LibMath::Vector3 single = quat.rotate(vectors[i]);
+            glm::vec3 rotatedGlm = quatGlm * glm::vec3(vectors[i].m_x, vectors[i].m_y, vectors[i].m_z);
+
+            CHECK(rotated[i].m_x == Catch::Approx(single.m_x).margin(0.00001f));
+            CHECK(rotated[i].m_y == Catch::Approx(single.m_y).margin(0.00001f));
+            CHECK(rotated[i].m_z == Catch::Approx(single.m_z).margin(0.00001f));
+
+            CHECK(rotated[i].m_x == Catch::Approx(rotatedGlm.x).margin(0.0001f));
+            CHECK(rotated[i].m_y == Catch::Approx(rotatedGlm.y).margin(0.0001f));
+            CHECK(rotated[i].m_z == Catch::Approx(rotatedGlm.z).margin(0.0001f));
+        }
+
+        std::vector<LibMath::Vector3> empty;
+        CHECK_NOTHROW(quat.rotate(std::span<LibMath::Vector3>(empty)));
+    }
+
+    SECTION("Hamilton Product")
+    {
+        LibMath::Quaternion q1(1.0f, -2.0f, 3.0f, 0.5f);
+        LibMath::Quaternion q2(-0.5f, 4.0f, 1.5f, -2.0f);
+
+        // i j = k, j k = i, k i = j
+        LibMath::Quaternion i(1.0f, 0.0f, 0.0f, 0.0f);
+        LibMath::Quaternion j(0.0f, 1.0f, 0.0f, 0.0f);
+        LibMath::Quaternion k(0.0f, 0.0f, 1.0f, 0.0f);
+        CHECK(i * j == k);
+        CHECK(j * k == i);
+        CHECK(k * i == j);
+        CHECK(i * i == LibMath::Quaternion(0.0f, 0.0f, 0.0f, -1.0f));
+
+        LibMath::Quaternion product = q1 * q2;
+        CHECK(product.m_x == Catch::Approx(0.5f * -0.5f + 1.0f * -2.0f + -2.0f * 1.5f - 3.0f * 4.0f));
+        CHECK(product.m_y == Catch::Approx(0.5f * 4.0f - 1.0f * 1.5f + -2.0f * -2.0f + 3.0f * -0.5f));
+        CHECK(product.m_z == Catch::Approx(0.5f * 1.5f + 1.0f * 4.0f - -2.0f * -0.5f + 3.0f * -2.0f));
+        CHECK(product.m_w == Catch::Approx(0.5f * -2.0f - 1.0f * -0.5f - -2.0f * 4.0f - 3.0f * 1.5f));
+    }
+}
+
+TEST_CASE("Quaternion Interpolation Arrays", "[.all][quaternion][Quaternion]")
+{
+    // 13 blends : the SIMD blocks and the scalar tail, with far apart, close, equal and opposite rotations
+    std::vector<LibMath::Quaternion> starts;
+    std::vector<LibMath::Quaternion> ends;
+    std::vector<float> ts;
+
+    LibMath::Vector3 startAxis(1.0f, 0.5f, -0.25f);
+    LibMath::Vector3 endAxis(-0.5f, 1.0f, 0.75f);
+    startAxis.normalize();
+    endAxis.normalize();
+
+    for (int i = 0; i < 13; ++i)
+    {
+        float angle = static_cast<float>(i) * 0.45f;
+
+        starts.emplace_back(LibMath::Radian(angle), startAxis);
+        ends.emplace_back(LibMath::Radian(angle * -1.3f + 0.2f), endAxis);
+        ts.push_back(static_cast<float>(i % 5) / 4.0f);
+    }
+    ends[3] = starts[3];
+    ends[4] = starts[4] * -1.0f;
+    ends[5] = LibMath::Quaternion::slerp(starts[5], ends[5], 0.001f);
+
+    SECTION("Slerp")
+    {
+        std::vector<LibMath::Quaternion> results(starts.size());
+        LibMath::Quaternion::slerp(starts, ends, ts, results);
+
+        for (size_t i = 0; i < starts.size(); ++i)
+        {
+            LibMath::Quaternion fast = LibMath::Quaternion::slerpFast(starts[i], ends[i], ts[i]);
+            LibMath::Quaternion exact = LibMath::Quaternion::slerp(starts[i], ends[i], ts[i]);
+
+            for (unsigned int component = 0; component < 4; ++component)
+            {
+                CHECK(results[i][component] == Catch::Approx(fast[component]).margin(1e-6f));
+                CHECK(fast[component] == Catch::Approx(exact[component]).margin(4e-5f));
+            }
+        }
+
+        // opposite quaternions are the same rotation, the shortest path stays on the start
+        CHECK(results[4][0] == Catch::Approx(starts[4][0]).margin(1e-6f));
+        CHECK(results[4][3] == Catch::Approx(starts[4][3]).margin(1e-6f));
+    }
+
+    SECTION("Nlerp")
+    {
+        std::vector<LibMath::Quaternion> results(starts.size());
+        LibMath::Quaternion::nlerp(starts, ends, ts, results);
+
+        for (size_t i = 0; i < starts.size(); ++i)
+        {
+            if (i == 4)
+            {
+                // opposite quaternions blended at 0.5 have no direction
+                continue;
+            }
+
+            LibMath::Quaternion single = LibMath::Quaternion::nlerp(starts[i], ends[i], ts[i]);
+
+            for (unsigned int component = 0; component < 4; ++component)
+            {
+                CHECK(results[i][component] == Catch::Approx(single[component]).margin(1e-5f));
+            }
+        }
+    }
+
+    SECTION("Sizes")
+    {
+        std::vector<LibMath::Quaternion> results(starts.size() - 1);
+        std::vector<float> fewerTs(ts.begin(), ts.end() - 1);
+
+        CHECK_THROWS_AS(LibMath::Quaternion::slerp(starts, ends, ts, results), std::invalid_argument);
+        CHECK_THROWS_AS(LibMath::Quaternion::nlerp(starts, ends, fewerTs, results), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Quaternion Matrix Conversion", "[.all][quaternion][Quaternion]")
+{
+    LibMath::Vector3 axis(1.0f, 2.0f, -3.0f);
+    axis.normalize();
+
+    SECTION("To Matrix4")
+    {
+        LibMath::Quaternion quat(LibMath::Radian(1.2f), axis);
+        LibMath::Matrix4 mat = quat.toMatrix4();
+        LibMath::Matrix4 fromMat3 = quat.toMatrix();
+
+        glm::quat quatGlm = glm::angleAxis(1.2f, glm::vec3(axis.m_x, axis.m_y, axis.m_z));
+        glm::mat4 matGlm = glm::mat4_cast(quatGlm);
+
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                CHECK(mat[i][j] == Catch::Approx(matGlm[i][j]).margin(0.0001f));
+                CHECK(mat[i][j] == Catch::Approx(fromMat3[i][j]).margin(0.0001f));
+            }
+        }
+
+        // a non unit quaternion gives the rotation of the normalized one
+        LibMath::Matrix4 scaled = (quat * 3.0f).toMatrix4();
+
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                CHECK(scaled[i][j] == Catch::Approx(mat[i][j]).margin(0.0001f));
+            }
+        }
+    }
+
+    SECTION("From Matrix")
+    {
+        // small angles take the trace branch, angles close to pi around each axis take the x, y and z branches
+        std::vector<LibMath::Quaternion> rotations{
+            LibMath::Quaternion::identity(),
+            LibMath::Quaternion(LibMath::Radian(0.3f), axis),
+            LibMath::Quaternion(LibMath::Radian(3.1f), LibMath::Vector3(1.0f, 0.0f, 0.0f)),
+            LibMath::Quaternion(LibMath::Radian(3.1f), LibMath::Vector3(0.0f, 1.0f, 0.0f)),
+            LibMath::Quaternion(LibMath::Radian(3.1f), LibMath::Vector3(0.0f, 0.0f, 1.0f)),
+            LibMath::Quaternion(LibMath::Radian(static_cast<float>(M_PI)), axis),
+        };
+
+        for (LibMath::Quaternion const& rotation : rotations)
+        {
+            LibMath::Quaternion fromMat3 = LibMath::Quaternion::fromMatrix(rotation.toMatrix());
+            LibMath::Quaternion fromMat4 = LibMath::Quaternion::fromMatrix(rotation.toMatrix4());
+
+            // q and -q are the same rotation
+            float sign = rotation.m_x * fromMat3.m_x + rotation.m_y * fromMat3.m_y + rotation.m_z * fromMat3.m_z + rotation.m_w * fromMat3.m_w < 0.0f ? -1.0f : 1.0f;
+
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                CHECK(sign * fromMat3[i] == Catch::Approx(rotation[i]).margin(1e-6f));
+                CHECK(fromMat4[i] == fromMat3[i]);
+            }
+            CHECK(fromMat3.isUnit());
+        }
+
+        LibMath::Quaternion fromRotationX = LibMath::Quaternion::fromMatrix(LibMath::Matrix4::createRotationX(LibMath::Radian(0.7f)));
+        glm::quat quatGlm = glm::quat_cast(glm::rotate(glm::mat4(1.f), 0.7f, glm::vec3(1.0f, 0.0f, 0.0f)));
+
+        CHECK(fromRotationX.m_x == Catch::Approx(quatGlm.x).margin(1e-6f));
+        CHECK(fromRotationX.m_y == Catch::Approx(quatGlm.y).margin(1e-6f));
+        CHECK(fromRotationX.m_z == Catch::Approx(quatGlm.z).margin(1e-6f));
+        CHECK(fromRotationX.m_w == Catch::Approx(quatGlm.w).margin(1e-6f));
+    }
+}
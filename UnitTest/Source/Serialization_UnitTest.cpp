@@ -0,0 +1,227 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "LibMath/Serialization.h"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace LibMath::Serialization;
+
+TEST_CASE("Serialization", "[.all][serialization]")
+{
+	SECTION("Full Precision")
+	{
+		LibMath::Vector3 const vec3{ 1.f / 3.f, -2.5e-30f, 123456.789f };
+		LibMath::Vector4 const vec4{ 1.f, -2.f, 3.f, std::numeric_limits<float>::infinity() };
+		LibMath::Quaternion const quat{ 0.1f, 0.2f, 0.3f, 0.9f };
+
+		LibMath::Matrix4 mat4;
+		LibMath::Matrix3 mat3;
+		for (int i = 0; i < 16; ++i)
+		{
+			mat4.data()[i] = static_cast<float>(i) / 7.f;
+		}
+		for (int i = 0; i < 9; ++i)
+		{
+			mat3.data()[i] = -static_cast<float>(i) / 3.f;
+		}
+
+		LibMath::Geometry2D::OBB const obb2{ LibMath::Geometry2D::Point(1.f, 2.f), 3.f, 4.f };
+		LibMath::Geometry3D::Capsule const capsule{ LibMath::Geometry3D::Point(1.f, 2.f, 3.f), LibMath::Geometry3D::Point(4.f, 5.f, 6.f), 0.5f };
+		LibMath::Geometry3D::OBB const obb3{ LibMath::Geometry3D::Point(1.f, 2.f, 3.f), 4.f, 5.f, 6.f, LibMath::Quaternion(0.1f, 0.2f, 0.3f, 0.9f) };
+
+		std::vector<std::byte> buffer;
+		BinaryWriter writer(buffer);
+		writer.write(vec3);
+		writer.write(vec4);
+		writer.write(quat);
+		writer.write(mat3);
+		writer.write(mat4);
+		writer.write(obb2);
+		writer.write(capsule);
+		writer.write(obb3);
+
+		CHECK(writer.size() == (3 + 4 + 4 + 9 + 16 + 5 + 7 + 10) * sizeof(float));
+
+		// little endian whatever the host
+		std::uint32_t const firstWord = std::to_integer<std::uint32_t>(buffer[0]) | std::to_integer<std::uint32_t>(buffer[1]) << 8 |
+			std::to_integer<std::uint32_t>(buffer[2]) << 16 | std::to_integer<std::uint32_t>(buffer[3]) << 24;
+		CHECK(firstWord == std::bit_cast<std::uint32_t>(vec3.m_x));
+
+		BinaryReader reader(buffer);
+		LibMath::Vector3 vec3Read;
+		LibMath::Vector4 vec4Read;
+		LibMath::Quaternion quatRead;
+		LibMath::Matrix3 mat3Read;
+		LibMath::Matrix4 mat4Read;
+		LibMath::Geometry2D::OBB obb2Read;
+		LibMath::Geometry3D::Capsule capsuleRead;
+		LibMath::Geometry3D::OBB obb3Read;
+
+		reader.read(vec3Read);
+		reader.read(vec4Read);
+		reader.read(quatRead);
+		reader.read(mat3Read);
+		reader.read(mat4Read);
+		reader.read(obb2Read);
+		reader.read(capsuleRead);
+		reader.read(obb3Read);
+
+		CHECK(reader.remaining() == 0);
+		CHECK(vec3Read == vec3);
+		CHECK(vec4Read == vec4);
+		CHECK(quatRead == quat);
+		CHECK(std::memcmp(mat3Read.data(), mat3.data(), 9 * sizeof(float)) == 0);
+		CHECK(std::memcmp(mat4Read.data(), mat4.data(), 16 * sizeof(float)) == 0);
+		CHECK(obb2Read.m_center == obb2.m_center);
+		CHECK(obb2Read.m_height == obb2.m_height);
+		CHECK(obb2Read.m_width == obb2.m_width);
+		CHECK(capsuleRead.m_pointB.m_z == capsule.m_pointB.m_z);
+		CHECK(capsuleRead.m_radius == capsule.m_radius);
+		CHECK(obb3Read.m_depth == obb3.m_depth);
+		CHECK(obb3Read.m_rotation == obb3.m_rotation);
+	}
+
+	SECTION("Arrays")
+	{
+		std::vector<LibMath::Vector3> positions;
+		std::vector<LibMath::Geometry3D::Sphere> spheres;
+		for (int i = 0; i < 100; ++i)
+		{
+			float value = static_cast<float>(i) * 0.37f;
+
+			positions.emplace_back(value, -value, 1.f / (1.f + value));
+			spheres.emplace_back(LibMath::Geometry3D::Point(value, 0.f, -value), value + 1.f);
+		}
+
+		std::vector<std::byte> buffer;
+		BinaryWriter writer(buffer);
+		writer.writeArray<LibMath::Vector3>(positions);
+		writer.writeArray<LibMath::Geometry3D::Sphere>(spheres);
+		writer.writeArray<LibMath::Vector3>({});
+
+		CHECK(writer.size() == 3 * sizeof(std::uint32_t) + positions.size() * 3 * sizeof(float) + spheres.size() * 4 * sizeof(float));
+
+		std::vector<LibMath::Vector3> positionsRead{ LibMath::Vector3::one() };
+		std::vector<LibMath::Geometry3D::Sphere> spheresRead;
+		std::vector<LibMath::Vector3> emptyRead{ LibMath::Vector3::one() };
+
+		BinaryReader reader(buffer);
+		reader.readArray(positionsRead);
+		reader.readArray(spheresRead);
+		reader.readArray(emptyRead);
+
+		CHECK(reader.remaining() == 0);
+		CHECK(positionsRead == positions);
+		CHECK(emptyRead.empty());
+
+		REQUIRE(spheresRead.size() == spheres.size());
+		bool same = true;
+		for (size_t i = 0; i < spheres.size(); ++i)
+		{
+			same &= spheresRead[i].m_center.toVector3() == spheres[i].m_center.toVector3() && spheresRead[i].m_radius == spheres[i].m_radius;
+		}
+		CHECK(same);
+	}
+
+	SECTION("Quantized")
+	{
+		// every half is read back exactly, and a float is rounded to the nearest half
+		bool exact = true;
+		for (std::uint32_t half = 0; half < 0x7C00; ++half)
+		{
+			exact &= floatToHalf(halfToFloat(static_cast<std::uint16_t>(half))) == half;
+			exact &= floatToHalf(-halfToFloat(static_cast<std::uint16_t>(half))) == (half | 0x8000);
+		}
+		CHECK(exact);
+
+		CHECK(halfToFloat(floatToHalf(1.f / 3.f)) == Catch::Approx(1.f / 3.f).epsilon(1e-3));
+		CHECK(halfToFloat(floatToHalf(65504.f)) == 65504.f);
+		CHECK(std::isinf(halfToFloat(floatToHalf(1e6f))));
+		CHECK(std::isnan(halfToFloat(floatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+		CHECK(halfToFloat(floatToHalf(1e-6f)) == Catch::Approx(1e-6f).epsilon(1e-2));
+
+		LibMath::Quaternion rotation(LibMath::Radian(1.2f), LibMath::Vector3(1.f, 2.f, -3.f));
+		LibMath::Vector3 const position{ 12.5f, -3.25f, 100.f };
+
+		std::vector<std::byte> buffer;
+		BinaryWriter writer(buffer, Precision::Quantized);
+		writer.write(position);
+		writer.write(rotation);
+		writer.write(LibMath::Quaternion());
+		writer.writeArray<LibMath::Quaternion>(std::vector<LibMath::Quaternion>(3, rotation));
+
+		CHECK(writer.size() == 3 * sizeof(std::uint16_t) + 2 * sizeof(std::uint32_t) + sizeof(std::uint32_t) + 3 * sizeof(std::uint32_t));
+
+		BinaryReader reader(buffer, Precision::Quantized);
+		LibMath::Vector3 positionRead;
+		LibMath::Quaternion rotationRead;
+		LibMath::Quaternion identityRead;
+		std::vector<LibMath::Quaternion> rotationsRead;
+
+		reader.read(positionRead);
+		reader.read(rotationRead);
+		reader.read(identityRead);
+		reader.readArray(rotationsRead);
+
+		CHECK(reader.remaining() == 0);
+		CHECK(positionRead == position);
+		CHECK(identityRead == LibMath::Quaternion::identity());
+
+		// same rotation, possibly with the opposite sign
+		rotation.normalize();
+		float const sign = rotation.m_x * rotationRead.m_x + rotation.m_y * rotationRead.m_y + rotation.m_z * rotationRead.m_z + rotation.m_w * rotationRead.m_w < 0.f ? -1.f : 1.f;
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			CHECK(sign * rotationRead[i] == Catch::Approx(rotation[i]).margin(2e-3));
+		}
+		CHECK(rotationRead.isUnit());
+
+		REQUIRE(rotationsRead.size() == 3);
+		CHECK(rotationsRead[2] == rotationRead);
+	}
+
+	SECTION("Truncated")
+	{
+		std::vector<std::byte> buffer;
+		BinaryWriter writer(buffer);
+		writer.write(LibMath::Vector3::one());
+		writer.writeArray<LibMath::Vector3>(std::vector<LibMath::Vector3>(4));
+
+		{
+			BinaryReader reader(std::span<std::byte const>(buffer).first(8));
+			LibMath::Vector3 vec;
+			CHECK_THROWS_AS(reader.read(vec), std::out_of_range);
+			CHECK(reader.position() == 0);
+		}
+
+		{
+			// the count announces more elements than the buffer holds
+			BinaryReader reader(std::span<std::byte const>(buffer).first(buffer.size() - 1));
+			LibMath::Vector3 vec;
+			reader.read(vec);
+
+			std::vector<LibMath::Vector3> values;
+			CHECK_THROWS_AS(reader.readArray(values), std::out_of_range);
+			CHECK(values.empty());
+		}
+
+		{
+			std::vector<std::byte> corrupted(buffer);
+			corrupted[3 * sizeof(float) + 3] = std::byte{ 0xFF };
+
+			BinaryReader reader(corrupted);
+			LibMath::Vector3 vec;
+			reader.read(vec);
+
+			std::vector<LibMath::Vector3> values;
+			CHECK_THROWS_AS(reader.readArray(values), std::out_of_range);
+		}
+	}
+}
@@ -0,0 +1,147 @@
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "LibMath/Angle/Radian.h"
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Transform.h"
+#include "LibMath/TransformHierarchy.h"
+#include "LibMath/Vector/Vector3.h"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+static LibMath::Matrix4 createLocal(int const index)
+{
+	float offset = static_cast<float>(index % 13) * 0.1f;
+
+	return LibMath::Matrix4::createTransform(LibMath::Vector3(offset, 1.f, -offset), LibMath::Radian(offset), LibMath::Vector3(1.f + offset * 0.1f));
+}
+
+static bool sameMatrix(LibMath::Matrix4 const& lhs, LibMath::Matrix4 const& rhs)
+{
+	bool same = true;
+	for (int i = 0; i < 16; ++i)
+	{
+		same &= lhs.data()[i] == Catch::Approx(rhs.data()[i]).margin(1e-4f);
+	}
+	return same;
+}
+
+TEST_CASE("TransformHierarchy", "[.all][transform][TransformHierarchy]")
+{
+	SECTION("Propagation")
+	{
+		//     0        4
+		//    / \       |
+		//   1   3      5
+		//   |
+		//   2
+		LibMath::TransformHierarchy hierarchy;
+		int root = hierarchy.addNode(createLocal(0));
+		int arm = hierarchy.addNode(createLocal(1), root);
+		int hand = hierarchy.addNode(createLocal(2), arm);
+		int leg = hierarchy.addNode(createLocal(3), root);
+		int otherRoot = hierarchy.addNode(createLocal(4));
+		int otherChild = hierarchy.addNode(createLocal(5), otherRoot);
+
+		CHECK(hierarchy.size() == 6);
+		CHECK(hierarchy.getParent(hand) == arm);
+		CHECK(hierarchy.getParent(otherRoot) == LibMath::TransformHierarchy::noParent);
+		CHECK(hierarchy.isDirty(hand));
+
+		hierarchy.update();
+
+		CHECK_FALSE(hierarchy.isDirty(hand));
+		CHECK(sameMatrix(hierarchy.getWorld(root), createLocal(0)));
+		CHECK(sameMatrix(hierarchy.getWorld(hand), createLocal(0) * createLocal(1) * createLocal(2)));
+		CHECK(sameMatrix(hierarchy.getWorld(leg), createLocal(0) * createLocal(3)));
+		CHECK(sameMatrix(hierarchy.getWorld(otherChild), createLocal(4) * createLocal(5)));
+
+		// moving the arm updates the hand, not its sibling
+		LibMath::Transform moved(LibMath::Vector3(5.f, 0.f, 0.f), LibMath::Quaternion(LibMath::Radian(0.5f), LibMath::Vector3(0.f, 1.f, 0.f)), LibMath::Vector3(2.f));
+		hierarchy.setLocal(arm, moved);
+
+		CHECK(hierarchy.isDirty(arm));
+		CHECK_FALSE(hierarchy.isDirty(leg));
+		CHECK(sameMatrix(hierarchy.getLocal(arm), moved.toMatrix()));
+
+		hierarchy.update();
+
+		CHECK(sameMatrix(hierarchy.getWorld(arm), createLocal(0) * moved.toMatrix()));
+		CHECK(sameMatrix(hierarchy.getWorld(hand), createLocal(0) * moved.toMatrix() * createLocal(2)));
+		CHECK(sameMatrix(hierarchy.getWorld(leg), createLocal(0) * createLocal(3)));
+
+		hierarchy.clear();
+		CHECK(hierarchy.size() == 0);
+	}
+
+	SECTION("Parallel")
+	{
+		// 40 roots of 250 nodes each, every node parented to an earlier node of its subtree, enough nodes for 4 threads
+		LibMath::TransformHierarchy sequential;
+		LibMath::TransformHierarchy parallel;
+		std::vector<int> subtreeNodes;
+
+		for (int root = 0; root < 40; ++root)
+		{
+			subtreeNodes.clear();
+			subtreeNodes.push_back(sequential.addNode(createLocal(root)));
+			parallel.addNode(createLocal(root));
+
+			for (int i = 1; i < 250; ++i)
+			{
+				int parent = subtreeNodes[(i * 7) % subtreeNodes.size()];
+				subtreeNodes.push_back(sequential.addNode(createLocal(i), parent));
+				parallel.addNode(createLocal(i), parent);
+			}
+		}
+
+		sequential.update();
+		parallel.updateParallel(4);
+
+		for (int frame = 0; frame < 3; ++frame)
+		{
+			for (int node = frame; node < static_cast<int>(sequential.size()); node += 37)
+			{
+				sequential.setLocal(node, createLocal(node + frame));
+				parallel.setLocal(node, createLocal(node + frame));
+			}
+
+			sequential.update();
+			parallel.updateParallel(4);
+
+			bool same = true;
+			bool clean = true;
+			for (int node = 0; node < static_cast<int>(sequential.size()); ++node)
+			{
+				same &= std::memcmp(sequential.getWorld(node).data(), parallel.getWorld(node).data(), 16 * sizeof(float)) == 0;
+				clean &= !parallel.isDirty(node);
+			}
+			CHECK(same);
+			CHECK(clean);
+		}
+
+		// Too few nodes to start a thread, the update runs on the calling thread
+		int moved = 3;
+		sequential.setLocal(moved, createLocal(100));
+		parallel.setLocal(moved, createLocal(100));
+		sequential.update();
+		parallel.updateParallel(4);
+
+		CHECK(std::memcmp(sequential.getWorld(moved).data(), parallel.getWorld(moved).data(), 16 * sizeof(float)) == 0);
+		CHECK(!parallel.isDirty(moved));
+	}
+
+	SECTION("Invalid Nodes")
+	{
+		LibMath::TransformHierarchy hierarchy;
+		int root = hierarchy.addNode(LibMath::Matrix4::identity());
+
+		CHECK_THROWS_AS(hierarchy.addNode(LibMath::Matrix4::identity(), root + 1), std::out_of_range);
+		CHECK_THROWS_AS(hierarchy.setLocal(-1, LibMath::Matrix4::identity()), std::out_of_range);
+		CHECK_THROWS_AS(hierarchy.getWorld(1), std::out_of_range);
+		CHECK(hierarchy.size() == 1);
+	}
+}
@@ -0,0 +1,98 @@
+#include <stdexcept>
+
+#include "LibMath/Angle/Radian.h"
+#include "LibMath/Matrix/Matrix4.h"
+#include "LibMath/Matrix4Vector4Operation.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Transform.h"
+#include "LibMath/Vector/Vector3.h"
+#include "LibMath/Vector/Vector4.h"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#define CHECK_MATRIX4_NEAR(matrix, expected) do { \
+	for (int i = 0; i < 4; ++i) { \
+		for (int j = 0; j < 4; ++j) { \
+			CHECK(matrix[i][j] == Catch::Approx(expected[i][j]).margin(1e-4f)); \
+		} \
+	} \
+} while (0)
+
+#define CHECK_VECTOR3_NEAR(vector, expected) \
+	CHECK(vector.m_x == Catch::Approx(expected.m_x).margin(1e-4f)); \
+	CHECK(vector.m_y == Catch::Approx(expected.m_y).margin(1e-4f)); \
+	CHECK(vector.m_z == Catch::Approx(expected.m_z).margin(1e-4f))
+
+TEST_CASE("Transform", "[.all][transform][Transform]")
+{
+	LibMath::Vector3 axis(1.f, 2.f, -3.f);
+	axis.normalize();
+
+	LibMath::Transform const parent(LibMath::Vector3(2.f, -3.f, 4.f), LibMath::Quaternion(LibMath::Radian(0.8f), axis), LibMath::Vector3(2.f));
+	LibMath::Transform const child(LibMath::Vector3(-1.f, 0.5f, 3.f), LibMath::Quaternion(LibMath::Radian(-1.7f), LibMath::Vector3(0.f, 1.f, 0.f)), LibMath::Vector3(0.5f, 3.f, 1.5f));
+
+	SECTION("Identity")
+	{
+		LibMath::Transform identity;
+
+		CHECK(identity.m_translation == LibMath::Vector3::zero());
+		CHECK(identity.m_rotation == LibMath::Quaternion::identity());
+		CHECK(identity.m_scale == LibMath::Vector3::one());
+		CHECK_MATRIX4_NEAR(identity.toMatrix(), LibMath::Matrix4::identity());
+		CHECK_MATRIX4_NEAR(LibMath::Transform::identity().toMatrix(), LibMath::Matrix4::identity());
+	}
+
+	SECTION("To Matrix")
+	{
+		LibMath::Matrix4 trs = LibMath::Matrix4::createTranslate(child.m_translation) * child.m_rotation.toMatrix4() * LibMath::Matrix4::createScale(child.m_scale);
+		CHECK_MATRIX4_NEAR(child.toMatrix(), trs);
+
+		LibMath::Transform rotationZ(LibMath::Vector3(1.f, 2.f, 3.f), LibMath::Quaternion(LibMath::Radian(0.6f), LibMath::Vector3(0.f, 0.f, 1.f)), LibMath::Vector3(2.f, 3.f, 0.5f));
+		LibMath::Matrix4 created = LibMath::Matrix4::createTransform(LibMath::Vector3(1.f, 2.f, 3.f), LibMath::Radian(0.6f), LibMath::Vector3(2.f, 3.f, 0.5f));
+		CHECK_MATRIX4_NEAR(rotationZ.toMatrix(), created);
+
+		LibMath::Transform decomposed(created);
+		CHECK_MATRIX4_NEAR(decomposed.toMatrix(), created);
+	}
+
+	SECTION("Transform Point And Direction")
+	{
+		LibMath::Vector3 point(0.3f, -2.f, 5.f);
+		LibMath::Matrix4 mat = child.toMatrix();
+
+		LibMath::Vector4 expectedPoint = mat * LibMath::Vector4(point, 1.f);
+		LibMath::Vector4 expectedDirection = mat * LibMath::Vector4(point, 0.f);
+
+		CHECK_VECTOR3_NEAR(child.transformPoint(point), LibMath::Vector3(expectedPoint.m_x, expectedPoint.m_y, expectedPoint.m_z));
+		CHECK_VECTOR3_NEAR(child.transformDirection(point), LibMath::Vector3(expectedDirection.m_x, expectedDirection.m_y, expectedDirection.m_z));
+	}
+
+	SECTION("Compose")
+	{
+		// uniform parent scale : exact, whatever the child scale
+		LibMath::Transform world = parent * child;
+		CHECK_MATRIX4_NEAR(world.toMatrix(), (parent.toMatrix() * child.toMatrix()));
+
+		LibMath::Vector3 point(0.3f, -2.f, 5.f);
+		CHECK_VECTOR3_NEAR(world.transformPoint(point), parent.transformPoint(child.transformPoint(point)));
+
+		LibMath::Transform chain = parent * LibMath::Transform::identity() * child;
+		CHECK_MATRIX4_NEAR(chain.toMatrix(), world.toMatrix());
+	}
+
+	SECTION("Inverse")
+	{
+		LibMath::Transform inverse = parent.inverse();
+
+		CHECK_MATRIX4_NEAR(inverse.toMatrix(), parent.toMatrix().inverseAffine());
+		CHECK_MATRIX4_NEAR((parent * inverse).toMatrix(), LibMath::Matrix4::identity());
+		CHECK_MATRIX4_NEAR((inverse * parent).toMatrix(), LibMath::Matrix4::identity());
+
+		LibMath::Vector3 point(0.3f, -2.f, 5.f);
+		CHECK_VECTOR3_NEAR(inverse.transformPoint(parent.transformPoint(point)), point);
+
+		LibMath::Transform flat(LibMath::Vector3::zero(), LibMath::Quaternion::identity(), LibMath::Vector3(1.f, 0.f, 1.f));
+		CHECK_THROWS_AS(flat.inverse(), std::runtime_error);
+	}
+}
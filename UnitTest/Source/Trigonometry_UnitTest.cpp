@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
 #include <LibMath/Trigonometry.h>
 
 #include <catch2/catch_test_macros.hpp>
@@ -17,4 +23,130 @@ TEST_CASE("Trigonometry", "[.all]")
 	CHECK(LibMath::acos(0.5f).radian() == Catch::Approx(glm::acos(0.5f)));
 	CHECK(LibMath::atan(0.5f).radian() == Catch::Approx(glm::atan(0.5f)));
 	CHECK(LibMath::atan(1.f, -2.f).radian() == Catch::Approx(glm::atan(1.f, -2.f)));
-}
\ No newline at end of file
+}
+
+TEST_CASE("Fast Trigonometry", "[.all][trigonometry]")
+{
+	SECTION("Sincos")
+	{
+		for (float angle : { -7.f, -1.2f, 0.f, 0.5f, 3.f, 100.f })
+		{
+			LibMath::SinCos result = LibMath::sincos(LibMath::Radian{ angle });
+			CHECK(result.m_sin == LibMath::sin(LibMath::Radian{ angle }));
+			CHECK(result.m_cos == LibMath::cos(LibMath::Radian{ angle }));
+		}
+	}
+
+	SECTION("Error Bounds")
+	{
+		// documented max error against the double precision functions
+		double sinError = 0.0;
+		double cosError = 0.0;
+		bool sameAsSincos = true;
+
+		for (float angle = -8192.f; angle <= 8192.f; angle += 0.0173f)
+		{
+			LibMath::SinCos result = LibMath::sincosFast(LibMath::Radian{ angle });
+			sinError = std::max(sinError, std::abs(result.m_sin - std::sin(static_cast<double>(angle))));
+			cosError = std::max(cosError, std::abs(result.m_cos - std::cos(static_cast<double>(angle))));
+
+			sameAsSincos &= LibMath::sinFast(LibMath::Radian{ angle }) == result.m_sin;
+			sameAsSincos &= LibMath::cosFast(LibMath::Radian{ angle }) == result.m_cos;
+		}
+
+		CHECK(sinError <= 1e-7);
+		CHECK(cosError <= 1e-7);
+		CHECK(sameAsSincos);
+
+		double atanError = 0.0;
+		for (float val = -1000.f; val <= 1000.f; val += 0.0137f)
+		{
+			atanError = std::max(atanError, std::abs(LibMath::atanFast(val).raw() - std::atan(static_cast<double>(val))));
+		}
+
+		CHECK(atanError <= 2e-7);
+
+		double atan2Error = 0.0;
+		for (float val1 = -5.f; val1 <= 5.f; val1 += 0.071f)
+		{
+			for (float val2 = -5.f; val2 <= 5.f; val2 += 0.067f)
+			{
+				atan2Error = std::max(atan2Error, std::abs(LibMath::atanFast(val1, val2).raw() - std::atan2(static_cast<double>(val1), static_cast<double>(val2))));
+			}
+		}
+
+		CHECK(atan2Error <= 3e-7);
+	}
+
+	SECTION("Edge Cases")
+	{
+		CHECK(LibMath::sinFast(LibMath::Radian{ 0.f }) == 0.f);
+		CHECK(LibMath::cosFast(LibMath::Radian{ 0.f }) == 1.f);
+
+		// far angles are wrapped like sin(Radian)
+		CHECK(LibMath::sinFast(LibMath::Radian{ 1.e6f }) == Catch::Approx(LibMath::sin(LibMath::Radian{ 1.e6f })).margin(1e-6));
+		CHECK(LibMath::cosFast(LibMath::Radian{ -1.e6f }) == Catch::Approx(LibMath::cos(LibMath::Radian{ -1.e6f })).margin(1e-6));
+		CHECK(std::isnan(LibMath::sinFast(LibMath::Radian{ std::nanf("") })));
+
+		// NaN like std::sin, never a quadrant converted from a non finite angle
+		float const infinity = std::numeric_limits<float>::infinity();
+		for (float angle : { infinity, -infinity, std::nanf("") })
+		{
+			LibMath::SinCos result = LibMath::sincosFast(LibMath::Radian{ angle });
+			CHECK(std::isnan(result.m_sin));
+			CHECK(std::isnan(result.m_cos));
+			CHECK(std::isnan(LibMath::cosFast(LibMath::Radian{ angle })));
+		}
+
+		CHECK(LibMath::atanFast(0.f, 0.f).raw() == 0.f);
+		CHECK(LibMath::atanFast(1.f, 0.f).raw() == Catch::Approx(LibMath::c_half_pi));
+		CHECK(LibMath::atanFast(-1.f, 0.f).raw() == Catch::Approx(-LibMath::c_half_pi));
+		CHECK(LibMath::atanFast(0.f, -1.f).raw() == Catch::Approx(LibMath::c_pi));
+		CHECK(LibMath::atanFast(1.e30f).raw() == Catch::Approx(LibMath::c_half_pi));
+	}
+
+	SECTION("Arrays")
+	{
+		// 37 angles so the vectorized loop leaves a scalar tail, one far angle takes the wrapped path
+		std::vector<LibMath::Radian> angles;
+		for (int i = 0; i < 37; ++i)
+		{
+			angles.emplace_back(static_cast<float>(i * (i % 2 == 0 ? 1 : -1)) * 0.37f);
+		}
+		angles[6] = LibMath::Radian{ 50000.f };
+
+		std::vector<float> sins(angles.size());
+		std::vector<float> coss(angles.size());
+		std::vector<float> sinsAndCoss(angles.size() * 2);
+
+		LibMath::sin(angles, sins);
+		LibMath::cos(angles, coss);
+		LibMath::sincos(angles, std::span(sinsAndCoss).first(angles.size()), std::span(sinsAndCoss).last(angles.size()));
+
+		for (size_t i = 0; i < angles.size(); ++i)
+		{
+			LibMath::SinCos expected = LibMath::sincosFast(angles[i]);
+
+			CHECK(sins[i] == Catch::Approx(expected.m_sin).margin(1e-7));
+			CHECK(coss[i] == Catch::Approx(expected.m_cos).margin(1e-7));
+			CHECK(sinsAndCoss[i] == sins[i]);
+			CHECK(sinsAndCoss[angles.size() + i] == coss[i]);
+		}
+
+		// non finite angles in a vectorized block and in the scalar tail
+		angles[3] = LibMath::Radian{ std::numeric_limits<float>::infinity() };
+		angles[9] = LibMath::Radian{ std::nanf("") };
+		angles[36] = LibMath::Radian{ -std::numeric_limits<float>::infinity() };
+
+		LibMath::sincos(angles, sins, coss);
+		for (size_t i : { 3u, 9u, 36u })
+		{
+			CHECK(std::isnan(sins[i]));
+			CHECK(std::isnan(coss[i]));
+		}
+		CHECK(sins[4] == Catch::Approx(LibMath::sincosFast(angles[4]).m_sin).margin(1e-7));
+
+		CHECK_THROWS_AS(LibMath::sin(angles, std::span(sins).first(10)), std::invalid_argument);
+		CHECK_THROWS_AS(LibMath::sincos(angles, sins, std::span(coss).first(10)), std::invalid_argument);
+	}
+}
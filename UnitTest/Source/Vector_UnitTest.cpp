@@ -1,6 +1,12 @@
 #include <LibMath/Vector/Vector4.h>
 #include <LibMath/Vector/Vector3.h>
 #include <LibMath/Vector/Vector2.h>
+#include <LibMath/Vector/Vector3Batch.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
@@ -8,6 +14,7 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/vec3.hpp>
 #include <glm/vec2.hpp>
+#include <glm/geometric.hpp>
 #include <glm/gtx/euler_angles.hpp>
 #include <glm/gtx/projection.hpp>
 #include <glm/gtx/transform.hpp>
@@ -489,6 +496,22 @@ TEST_CASE("Vector3", "[.all][vector][Vector3]")
 		CHECK_VECTOR3(LibMath::Vector3::zero(), glm::vec3(0.f, 0.f, 0.f));
 	}
 
+	SECTION("Compile Time")
+	{
+		// trivial operations are constexpr and fold at compile time
+		constexpr LibMath::Vector3 sum = LibMath::Vector3::up() + LibMath::Vector3::right() * 2.f;
+		constexpr LibMath::Vector3 normal = LibMath::Vector3::right().cross(LibMath::Vector3::up());
+
+		STATIC_CHECK(sum == LibMath::Vector3{ 2.f, 1.f, 0.f });
+		STATIC_CHECK(normal == LibMath::Vector3::front());
+		STATIC_CHECK(sum.dot(LibMath::Vector3::one()) == 3.f);
+		STATIC_CHECK(sum.magnitudeSquared() == 5.f);
+		STATIC_CHECK(LibMath::Vector3::lerp(LibMath::Vector3::zero(), sum, .5f) == LibMath::Vector3{ 1.f, .5f, 0.f });
+
+		STATIC_CHECK((LibMath::Vector2{ 1.f, 2.f } + LibMath::Vector2{ 3.f }).dotProduct(LibMath::Vector2{ 1.f }) == 9.f);
+		STATIC_CHECK((LibMath::Vector4{ 1.f, 2.f, 3.f, 4.f } * 2.f).magnitudeSquare() == 120.f);
+	}
+
 	SECTION("Arithmetic")
 	{
 		LibMath::Vector3 const small{ 2.5f, .5f, 2.f };
@@ -838,6 +861,54 @@ TEST_CASE("Vector3", "[.all][vector][Vector3]")
 			CHECK(input.string() == "{2.5,-0.5,2}");
 
 			CHECK(input.stringLong() == "Vector3{ x:2.5, y:-0.5, z:2 }");
+
+			CHECK(LibMath::Vector3(2.96f, -0.f, 123456.f).string() == "{3.0,0,123456}");
+		}
+
+		{
+			char buffer[LibMath::Vector3::c_maxChars];
+			char* last = buffer + sizeof buffer;
+
+			std::to_chars_result written = LibMath::toChars(buffer, last, input);
+			REQUIRE(written.ec == std::errc());
+			CHECK(std::string(buffer, written.ptr) == "{2.5,-0.5,2}");
+
+			// every component is read back bit for bit, even at the longest representation
+			LibMath::Vector3 const exact{ 1.f / 3.f, -1.17549435e-38f, -3.40282347e+38f };
+			written = LibMath::toChars(buffer, last, exact);
+			REQUIRE(written.ec == std::errc());
+
+			LibMath::Vector3 output;
+			std::from_chars_result read = LibMath::fromChars(buffer, written.ptr, output);
+			REQUIRE(read.ec == std::errc());
+			CHECK(read.ptr == written.ptr);
+			CHECK(output == exact);
+
+			std::stringstream stream;
+			stream << exact;
+			CHECK(stream.str() == std::string(buffer, written.ptr));
+
+			CHECK(LibMath::toChars(buffer, buffer + 8, exact).ec == std::errc::value_too_large);
+		}
+
+		{
+			std::string const text = " { 2.5 ,-0.5,\t2 } extra";
+
+			LibMath::Vector3 output;
+			std::from_chars_result read = LibMath::fromChars(text.data(), text.data() + text.size(), output);
+			REQUIRE(read.ec == std::errc());
+			CHECK(output == input);
+			CHECK(std::string(read.ptr) == " extra");
+
+			for (std::string const malformed : { "", "{1,2}", "{1,2,3", "(1,2,3)", "{1,,3}", "{1,2,x}" })
+			{
+				LibMath::Vector3 untouched = input;
+				read = LibMath::fromChars(malformed.data(), malformed.data() + malformed.size(), untouched);
+
+				CHECK(read.ec == std::errc::invalid_argument);
+				CHECK(read.ptr == malformed.data());
+				CHECK(untouched == input);
+			}
 		}
 	}
 
@@ -1040,4 +1111,156 @@ TEST_CASE("Vector4", "[.all][vector][Vector4]")
 		CHECK_THROWS(vec / 0.0f);
 #endif
 	}
-}
\ No newline at end of file
+}
+
+TEST_CASE("Vector3Batch", "[.all][vector][Vector3Batch]")
+{
+	// 19 vectors : one full 16 lanes block and a partial one
+	std::vector<LibMath::Vector3> vectors;
+	std::vector<LibMath::Vector3> others;
+	std::vector<glm::vec3> vectorsGlm;
+	std::vector<glm::vec3> othersGlm;
+
+	for (int i = 0; i < 19; ++i)
+	{
+		float value = static_cast<float>(i);
+
+		vectors.emplace_back(value, 1.f - value, .5f * value);
+		others.emplace_back(2.f, value * .25f, -value);
+		vectorsGlm.emplace_back(value, 1.f - value, .5f * value);
+		othersGlm.emplace_back(2.f, value * .25f, -value);
+	}
+
+	LibMath::Vector3Batch batch(vectors);
+	LibMath::Vector3Batch otherBatch(others);
+
+	SECTION("Instantiation")
+	{
+		LibMath::Vector3Batch empty;
+		CHECK(empty.size() == 0);
+
+		LibMath::Vector3Batch zeros(5);
+		REQUIRE(zeros.size() == 5);
+		CHECK(zeros.get(4) == LibMath::Vector3::zero());
+
+		LibMath::Vector3Batch copy = batch;
+		CHECK(copy.size() == batch.size());
+		CHECK(copy.get(18) == batch.get(18));
+
+		LibMath::Vector3Batch moved = std::move(copy);
+		CHECK(moved.size() == 19);
+		CHECK(moved.get(7) == vectors[7]);
+	}
+
+	SECTION("Accessor")
+	{
+		REQUIRE(batch.size() == 19);
+		CHECK(batch.get(3) == vectors[3]);
+		CHECK(batch.x()[5] == vectors[5].m_x);
+		CHECK(batch.y()[5] == vectors[5].m_y);
+		CHECK(batch.z()[5] == vectors[5].m_z);
+
+		batch.set(3, LibMath::Vector3::one());
+		CHECK(batch.get(3) == LibMath::Vector3::one());
+
+		// each component array is aligned for the widest kernels
+		CHECK(reinterpret_cast<std::uintptr_t>(batch.x().data()) % 64 == 0);
+		CHECK(reinterpret_cast<std::uintptr_t>(batch.y().data()) % 64 == 0);
+		CHECK(reinterpret_cast<std::uintptr_t>(batch.z().data()) % 64 == 0);
+
+		CHECK_THROWS_AS(batch.get(19), std::out_of_range);
+		CHECK_THROWS_AS(batch.set(19, LibMath::Vector3::zero()), std::out_of_range);
+	}
+
+	SECTION("Conversion")
+	{
+		std::vector<LibMath::Vector3> result(batch.size());
+		batch.store(result);
+
+		for (size_t i = 0; i < result.size(); ++i)
+		{
+			CHECK(result[i] == vectors[i]);
+		}
+
+		batch.resize(25);
+		CHECK(batch.get(24) == LibMath::Vector3::zero());
+		CHECK(batch.get(18) == vectors[18]);
+
+		CHECK_THROWS_AS(batch.store(result), std::invalid_argument);
+	}
+
+	SECTION("Arithmetic")
+	{
+		LibMath::Vector3Batch result;
+
+		LibMath::Vector3Batch::add(batch, otherBatch, result);
+		for (size_t i = 0; i < vectors.size(); ++i)
+		{
+			CHECK_VECTOR3(result.get(i), (vectorsGlm[i] + othersGlm[i]));
+		}
+
+		LibMath::Vector3Batch::subtract(batch, otherBatch, result);
+		for (size_t i = 0; i < vectors.size(); ++i)
+		{
+			CHECK_VECTOR3(result.get(i), (vectorsGlm[i] - othersGlm[i]));
+		}
+
+		LibMath::Vector3Batch::scale(batch, 2.5f, result);
+		for (size_t i = 0; i < vectors.size(); ++i)
+		{
+			CHECK_VECTOR3(result.get(i), (vectorsGlm[i] * 2.5f));
+		}
+
+		LibMath::Vector3Batch::lerp(batch, otherBatch, .25f, result);
+		for (size_t i = 0; i < vectors.size(); ++i)
+		{
+			CHECK_VECTOR3(result.get(i), glm::mix(vectorsGlm[i], othersGlm[i], .25f));
+		}
+
+		// result can alias an operand
+		LibMath::Vector3Batch::add(batch, batch, batch);
+		CHECK_VECTOR3(batch.get(18), (vectorsGlm[18] * 2.f));
+
+		LibMath::Vector3Batch shorter(4);
+		CHECK_THROWS_AS(LibMath::Vector3Batch::add(batch, shorter, result), std::invalid_argument);
+	}
+
+	SECTION("Functionality")
+	{
+		std::vector<float> values(batch.size());
+
+		LibMath::Vector3Batch::dot(batch, otherBatch, values);
+		for (size_t i = 0; i < vectors.size(); ++i)
+		{
+			CHECK(values[i] == Catch::Approx(glm::dot(vectorsGlm[i], othersGlm[i])));
+		}
+
+		LibMath::Vector3Batch::length(batch, values);
+		for (size_t i = 0; i < vectors.size(); ++i)
+		{
+			CHECK(values[i] == Catch::Approx(glm::length(vectorsGlm[i])));
+		}
+
+		LibMath::Vector3Batch result;
+		LibMath::Vector3Batch::cross(batch, otherBatch, result);
+		for (size_t i = 0; i < vectors.size(); ++i)
+		{
+			CHECK_VECTOR3(result.get(i), glm::cross(vectorsGlm[i], othersGlm[i]));
+		}
+
+		LibMath::Vector3Batch::cross(batch, otherBatch, batch);
+		CHECK_VECTOR3(batch.get(9), glm::cross(vectorsGlm[9], othersGlm[9]));
+
+		// zero vectors stay zero instead of throwing like Vector3::normalize
+		otherBatch.set(0, LibMath::Vector3::zero());
+		LibMath::Vector3Batch::normalize(otherBatch);
+		CHECK(otherBatch.get(0) == LibMath::Vector3::zero());
+		for (size_t i = 1; i < others.size(); ++i)
+		{
+			CHECK_VECTOR3(otherBatch.get(i), glm::normalize(othersGlm[i]));
+		}
+
+		std::vector<float> tooSmall(3);
+		CHECK_THROWS_AS(LibMath::Vector3Batch::length(batch, tooSmall), std::invalid_argument);
+	}
+}